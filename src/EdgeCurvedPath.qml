@@ -50,12 +50,9 @@ ShapePath {
     strokeStyle: edgeTemplate.dashed
     dashPattern: edgeItem?.style?.dashPattern ?? [4, 2]
     fillColor: Qt.rgba(0,0,0,0)
-    PathCubic {
-        x: edgeItem.p2.x
-        y: edgeItem.p2.y
-        control1X: edgeItem.c1.x
-        control1Y: edgeItem.c1.y
-        control2X: edgeItem.c2.x
-        control2Y: edgeItem.c2.y
+    // Note: Curve is drawn from edge flattened path, shared with edge hit testing and label
+    // position, see qan::EdgeItem::path.
+    PathPolyline {
+        path: edgeItem.path
     }
 }
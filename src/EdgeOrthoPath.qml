@@ -50,12 +50,9 @@ ShapePath {
     strokeStyle: edgeTemplate.dashed
     dashPattern: edgeItem?.style?.dashPattern ?? [4, 2]
     fillColor: Qt.rgba(0,0,0,0)
-    PathLine {
-        x: edgeItem.c1.x
-        y: edgeItem.c1.y
-    }
-    PathLine {
-        x: edgeItem.p2.x
-        y: edgeItem.p2.y
+    // Note: orthoPath is p1 -> c1 -> p2 for default ortho edges, or a multi-bends
+    // polyline when edge is routed around nodes (see Graph.orthoRouting).
+    PathPolyline {
+        path: edgeItem.orthoPath
     }
 }
@@ -43,7 +43,9 @@ Item {
 
     property color color: edgeItem?.style?.lineColor ?? Qt.rgba(0.,0.,0.,1.)
     // Allow direct bypass of style
-    property var    lineType: edgeItem?.style?.lineType ?? Qan.EdgeStyle.Straight
+    // Note: Self loops are always curved, see qan::EdgeItem::getLineType()
+    property var    lineType: edgeItem?.selfLoop ? Qan.EdgeStyle.Curved :
+                                                   edgeItem?.style?.lineType ?? Qan.EdgeStyle.Straight
     property var    dashed  : edgeItem?.style?.dashed ? ShapePath.DashLine : ShapePath.SolidLine
 
     visible: edgeItem.visible && !edgeItem.hidden
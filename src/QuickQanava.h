@@ -63,7 +63,22 @@
 #include "./qanBottomResizer.h"
 #include "./qanNavigablePreview.h"
 #include "./qanAnalysisTimeHeatMap.h"
+#include "./qanLayoutEngines.h"
 #include "./qanTreeLayouts.h"
+#include "./qanSpatialIndex.h"
+#include "./qanIncubator.h"
+#include "./qanLodItem.h"
+#include "./qanRectNodeItem.h"
+#include "./qanEdgeLayer.h"
+#include "./qanPolygonIntersection.h"
+#include "./qanEdgeBundler.h"
+#ifdef QUICK_QANAVA_EDGE_EFFECTS
+#include "./qanEdgeEffectMaterial.h"
+#endif
+#include "./qanFrameScheduler.h"
+#include "./qanOrthoRouter.h"
+#include "./qanCompoundLayout.h"
+#include "./qanMultilevelLayout.h"
 
 struct QuickQanava {
     static void initialize(QQmlEngine* engine) {
@@ -0,0 +1,207 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanCompoundLayout.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <unordered_map>
+
+// QuickQanava headers
+#include "./qanCompoundLayout.h"
+#include "./qanGroupItem.h"
+
+namespace qan { // ::qan
+
+/* CompoundLayout Object Management *///---------------------------------------
+CompoundLayout::CompoundLayout(QObject* parent) noexcept :
+    QObject{parent}
+{
+}
+CompoundLayout::~CompoundLayout() { }
+
+bool    CompoundLayout::setSpacing(qreal spacing) noexcept
+{
+    if (!qFuzzyCompare(1. + spacing, 1. + _spacing)) {
+        _spacing = spacing;
+        emit spacingChanged();
+        return true;
+    }
+    return false;
+}
+
+bool    CompoundLayout::setGroupPadding(qreal groupPadding) noexcept
+{
+    if (!qFuzzyCompare(1. + groupPadding, 1. + _groupPadding)) {
+        _groupPadding = groupPadding;
+        emit groupPaddingChanged();
+        return true;
+    }
+    return false;
+}
+
+bool    CompoundLayout::setParallel(bool parallel) noexcept
+{
+    if (parallel != _parallel) {
+        _parallel = parallel;
+        emit parallelChanged();
+        return true;
+    }
+    return false;
+}
+
+//! Return true if \c group content could be laid out (ie \c group and its ancestors are neither collapsed nor tables).
+static bool isLayoutableGroup(const qan::Group* group) noexcept
+{
+    for (auto g = group; g != nullptr; g = g->get_group()) {
+        if (g->isTable() ||
+            g->getGroupItem() == nullptr ||
+            g->getGroupItem()->getCollapsed())
+            return false;
+    }
+    return true;
+}
+
+void    CompoundLayout::layout(qan::Graph& graph) noexcept
+{
+    std::vector<qan::Node*> roots;
+    for (const auto node: graph.get_nodes())
+        if (node != nullptr &&
+            node->get_group() == nullptr &&
+            node->getItem() != nullptr)
+            roots.push_back(node);
+    layoutHierarchy(graph, roots, /*moveRoots*/true);
+}
+
+void    CompoundLayout::layout(qan::Graph* graph) noexcept
+{
+    if (graph != nullptr)
+        layout(*graph);
+}
+
+void    CompoundLayout::layoutGroup(qan::Group& group) noexcept
+{
+    const auto graph = group.getGraph();
+    if (graph == nullptr ||
+        group.getItem() == nullptr ||
+        !isLayoutableGroup(&group))
+        return;
+    layoutHierarchy(*graph, {&group}, /*moveRoots*/false);
+}
+
+void    CompoundLayout::layoutGroup(qan::Group* group) noexcept
+{
+    if (group != nullptr)
+        layoutGroup(*group);
+}
+//-----------------------------------------------------------------------------
+
+
+/* Hierarchy Layout *///-------------------------------------------------------
+void    CompoundLayout::layoutHierarchy(const qan::Graph& graph, const std::vector<qan::Node*>& roots, bool moveRoots) noexcept
+{
+    // Algorithm:
+    // 1. Generate a data-only snapshot of roots hierarchy, collapsed groups and tables content is not collected.
+    // 2. Map graph edges to snapshot nodes (edges ending in a collapsed group content are mapped to the group).
+    // 3. Compute layout with qan::CompoundLayoutEngine.
+    // 4. Apply nodes positions and groups sizes.
+    std::vector<qan::Node*>                     nodes;
+    std::vector<int>                            parents;
+    std::vector<QPointF>                        containerOffsets;
+    std::unordered_map<const qan::Node*, int>   indexes;
+    qan::LayoutGraph                            layoutGraph;
+    const auto addNode = [&](qan::Node* node, int parent) {
+        const auto item = node->getItem();
+        indexes.emplace(node, static_cast<int>(nodes.size()));
+        nodes.push_back(node);
+        parents.push_back(parent);
+        containerOffsets.push_back(QPointF{0., 0.});
+        layoutGraph.sizes.push_back(QSizeF{item->width(), item->height()});
+        layoutGraph.positions.push_back(item->position());
+    };
+    for (const auto root: roots)                        // 1.
+        addNode(root, -1);
+    for (std::size_t n = 0; n < nodes.size(); n++) {    // Note: nodes grows while iterating, breadth first
+        const auto group = nodes[n]->isGroup() ? qobject_cast<qan::Group*>(nodes[n]) : nullptr;
+        if (group == nullptr ||
+            !isLayoutableGroup(group))
+            continue;
+        const auto groupItem = group->getGroupItem();
+        const auto container = groupItem->getContainer();
+        // Note: Container is usually below group header, take its offset into account.
+        if (container != nullptr)
+            containerOffsets[n] = container->mapToItem(groupItem, QPointF{0., 0.});
+        for (const auto member: group->get_nodes())
+            if (member != nullptr &&
+                member->getItem() != nullptr)
+                addNode(member, static_cast<int>(n));
+    }
+    if (nodes.empty())
+        return;
+
+    const auto getIndex = [&indexes](const qan::Node* node) -> int {    // 2.
+        for (auto n = node; n != nullptr; n = n->get_group()) {
+            const auto index = indexes.find(n);
+            if (index != indexes.end())
+                return index->second;
+        }
+        return -1;
+    };
+    for (const auto edge: graph.get_edges()) {
+        if (edge == nullptr)
+            continue;
+        const auto src = getIndex(edge->get_src());
+        const auto dst = getIndex(edge->get_dst());
+        if (src >= 0 &&
+            dst >= 0 &&
+            src != dst)
+            layoutGraph.edges.emplace_back(src, dst);
+    }
+
+    qan::CompoundLayoutEngine engine;                   // 3.
+    engine.spacing = getSpacing();
+    engine.groupPadding = getGroupPadding();
+    engine.parallel = getParallel();
+    std::vector<QSizeF> sizes;
+    const auto result = engine.layout(layoutGraph, parents, containerOffsets, sizes);
+
+    for (std::size_t n = 0; n < nodes.size(); n++) {    // 4.
+        const auto item = nodes[n]->getItem();
+        if (moveRoots ||
+            parents[n] >= 0)
+            item->setPosition(result.positions[n]);
+        if (sizes[n] != layoutGraph.sizes[n])
+            item->setSize(sizes[n]);
+    }
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,153 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanCompoundLayout.h
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <vector>
+
+// Qt headers
+#include <QObject>
+
+// QuickQanava headers
+#include "./qanGraph.h"
+#include "./qanLayoutEngines.h"
+
+namespace qan { // ::qan
+
+/*! \brief Compound layout for graphs with nested qan::Group hierarchies.
+ *
+ * Groups content is laid out bottom-up: deepest groups content is laid out first, group items
+ * are then resized to fit their content and laid out as super-nodes in their parent group, up to
+ * graph top level nodes and groups.
+ *
+ * Every level (a group content or graph top level nodes) is laid out with qan::LayeredLayoutEngine
+ * (longest path layering of the level edges, edges crossing group borders being mapped
+ * to the level members containing their source and destination), level members without level
+ * edges are laid out in a grid below.
+ *
+ * Layout is computed by qan::CompoundLayoutEngine on a data-only snapshot of the groups hierarchy,
+ * members sizes and edges (groups with the same depth being laid out in parallel), items geometry
+ * is then applied from the calling thread.
+ *
+ * \note Collapsed groups and tables are laid out as opaque super-nodes, their content is left untouched.
+ *
+ * \nosubgrouping
+ */
+class CompoundLayout : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    /*! \name CompoundLayout Object Management *///----------------------------
+    //@{
+public:
+    explicit CompoundLayout(QObject* parent = nullptr) noexcept;
+    virtual ~CompoundLayout() override;
+    CompoundLayout(const CompoundLayout&) = delete;
+    CompoundLayout& operator=(const CompoundLayout&) = delete;
+    CompoundLayout(CompoundLayout&&) = delete;
+    CompoundLayout& operator=(CompoundLayout&&) = delete;
+
+public:
+    //! \copydoc getSpacing()
+    Q_PROPERTY(qreal spacing READ getSpacing WRITE setSpacing NOTIFY spacingChanged FINAL)
+    //! \copydoc getSpacing()
+    bool            setSpacing(qreal spacing) noexcept;
+    //! \brief Horizontal and vertical spacing between level members (default to 40.).
+    qreal           getSpacing() const noexcept { return _spacing; }
+protected:
+    //! \copydoc getSpacing()
+    qreal           _spacing = 40.;
+signals:
+    //! \copydoc getSpacing()
+    void            spacingChanged();
+
+public:
+    //! \copydoc getGroupPadding()
+    Q_PROPERTY(qreal groupPadding READ getGroupPadding WRITE setGroupPadding NOTIFY groupPaddingChanged FINAL)
+    //! \copydoc getGroupPadding()
+    bool            setGroupPadding(qreal groupPadding) noexcept;
+    //! \brief Padding between a group container border and its content (default to 20.).
+    qreal           getGroupPadding() const noexcept { return _groupPadding; }
+protected:
+    //! \copydoc getGroupPadding()
+    qreal           _groupPadding = 20.;
+signals:
+    //! \copydoc getGroupPadding()
+    void            groupPaddingChanged();
+
+public:
+    //! \copydoc getParallel()
+    Q_PROPERTY(bool parallel READ getParallel WRITE setParallel NOTIFY parallelChanged FINAL)
+    //! \copydoc getParallel()
+    bool            setParallel(bool parallel) noexcept;
+    //! \brief Compute independent groups (groups with the same depth) layouts in parallel (default to true).
+    bool            getParallel() const noexcept { return _parallel; }
+protected:
+    //! \copydoc getParallel()
+    bool            _parallel = true;
+signals:
+    //! \copydoc getParallel()
+    void            parallelChanged();
+
+public:
+    //! Apply compound layout to all \c graph nodes and groups.
+    void                layout(qan::Graph& graph) noexcept;
+
+    //! QML invokable version of layout().
+    Q_INVOKABLE void    layout(qan::Graph* graph) noexcept;
+
+    //! Apply compound layout to \c group content (recursively), \c group is resized but not moved.
+    void                layoutGroup(qan::Group& group) noexcept;
+
+    //! QML invokable version of layoutGroup().
+    Q_INVOKABLE void    layoutGroup(qan::Group* group) noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Hierarchy Layout *///--------------------------------------------
+    //@{
+private:
+    /*! \brief Lay out \c roots and their groups content (recursively), \c roots are moved only when \c moveRoots is true.
+     *
+     * Collapsed groups and tables content is ignored, edges ending in their content are mapped to them.
+     */
+    void    layoutHierarchy(const qan::Graph& graph, const std::vector<qan::Node*>& roots, bool moveRoots) noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::CompoundLayout)
@@ -62,11 +62,13 @@ qan::EdgeItem*   Edge::getItem() noexcept { return _item.data(); }
 
 void    Edge::setItem(qan::EdgeItem* edgeItem) noexcept
 {
-    if (edgeItem != nullptr) {
+    if (edgeItem != _item) {
         _item = edgeItem;
-        if (edgeItem->getEdge() != this)
-            edgeItem->setEdge(this);
+        emit itemChanged();
     }
+    if (edgeItem != nullptr &&
+        edgeItem->getEdge() != this)
+        edgeItem->setEdge(this);
 }
 //-----------------------------------------------------------------------------
 
@@ -76,11 +76,15 @@ public:
 public:
     friend class qan::EdgeItem;
 
-    Q_PROPERTY(qan::EdgeItem* item READ getItem CONSTANT)
+    //! Edge visual item, might be nullptr for non visual edges or virtual edges (see qan::Graph::virtualized).
+    Q_PROPERTY(qan::EdgeItem* item READ getItem NOTIFY itemChanged)
     qan::EdgeItem*   getItem() noexcept;
+    //! Set edge visual item, a nullptr \c edgeItem detach edge from its current item.
     virtual void     setItem(qan::EdgeItem* edgeItem) noexcept;
 private:
     QPointer<qan::EdgeItem> _item;
+signals:
+    void             itemChanged();
     //@}
     //-------------------------------------------------------------------------
 
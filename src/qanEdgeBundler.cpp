@@ -0,0 +1,197 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanEdgeBundler.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <functional>   // std::ref
+#include <future>
+
+// QuickQanava headers
+#include "./qanEdgeBundler.h"
+
+namespace qan { // ::qan
+
+/* EdgeBundler Configuration *///----------------------------------------------
+void    EdgeBundler::setStrength(qreal strength) noexcept
+{
+    _strength = std::clamp(strength, 0., 1.);
+}
+
+void    EdgeBundler::setSpanSegments(int spanSegments) noexcept
+{
+    _spanSegments = std::max(1, spanSegments);
+}
+//-----------------------------------------------------------------------------
+
+
+/* Bundling Management *///----------------------------------------------------
+void    EdgeBundler::bundle(const Hierarchy& hierarchy, const std::vector<Edge>& edges,
+                            Polylines& polylines, int threadCount) const noexcept
+{
+    // Algorithm:
+    // 1. Compute groups depth (parents are not expected to be sorted, walk is bounded to protect against cycles).
+    // 2. Bundle edges chunks in parallel, each chunk in its own flat polylines.
+    // 3. Concatenate chunks polylines.
+    polylines.points.clear();
+    polylines.offsets.clear();
+    const auto groupCount = static_cast<int>(hierarchy.parents.size());
+    std::vector<int> depths(hierarchy.parents.size(), -1);
+    for (int g = 0; g < groupCount; g++) {                  // 1.
+        int depth = 0;
+        for (auto parent = hierarchy.parents[g];
+             parent >= 0 && parent < groupCount && depth <= groupCount;
+             parent = hierarchy.parents[parent])
+            ++depth;
+        depths[g] = depth;
+    }
+
+    const auto count = static_cast<int>(edges.size());
+    const auto bundleChunk = [this, &hierarchy, &depths, &edges](int first, int last, Polylines& chunk) {
+        std::vector<QPointF> controls;
+        chunk.offsets.reserve(static_cast<std::size_t>(last - first));
+        for (int e = first; e < last; e++) {
+            chunk.offsets.push_back(chunk.points.size());
+            generateControlPolygon(hierarchy, depths, edges[e], controls);
+            appendFlattenedSpline(controls, chunk.points);
+        }
+    };
+    // Note: Do not spawn threads for small sets, thread creation cost is not worth it.
+    const auto chunkCount = std::max(1, std::min(threadCount, count / 256));
+    const auto chunkSize = (count + chunkCount - 1) / std::max(1, chunkCount);
+    std::vector<Polylines> chunks(static_cast<std::size_t>(chunkCount));
+    if (chunkCount <= 1)
+        bundleChunk(0, count, chunks[0]);
+    else {                                                  // 2.
+        std::vector<std::future<void>> tasks;
+        for (int c = 0; c < chunkCount; c++) {
+            const auto first = c * chunkSize;
+            const auto last = std::min(count, first + chunkSize);
+            if (first < last)
+                tasks.push_back(std::async(std::launch::async, bundleChunk,
+                                           first, last, std::ref(chunks[c])));
+        }
+        for (auto& task: tasks)
+            task.wait();
+    }
+
+    std::size_t pointCount = 0;                             // 3.
+    for (const auto& chunk: chunks)
+        pointCount += chunk.points.size();
+    polylines.points.reserve(pointCount);
+    polylines.offsets.reserve(edges.size() + 1);
+    for (const auto& chunk: chunks) {
+        const auto base = polylines.points.size();
+        for (const auto offset: chunk.offsets)
+            polylines.offsets.push_back(base + offset);
+        polylines.points.insert(polylines.points.end(), chunk.points.begin(), chunk.points.end());
+    }
+    polylines.offsets.push_back(polylines.points.size());
+}
+
+void    EdgeBundler::generateControlPolygon(const Hierarchy& hierarchy, const std::vector<int>& depths,
+                                            const Edge& edge, std::vector<QPointF>& controls) const noexcept
+{
+    // Algorithm:
+    // 1. Walk up deepest end groups until both ends are at the same depth, then walk up both ends
+    //    until lowest common ancestor is found: source path is appended in order, destination path
+    //    is collected in reverse order.
+    // 2. Append lowest common ancestor (if any) and reversed destination path.
+    const auto groupCount = static_cast<int>(hierarchy.parents.size());
+    const auto isGroup = [groupCount](int g) { return g >= 0 && g < groupCount; };
+    const auto depth = [&depths, &isGroup](int g) { return isGroup(g) ? depths[g] : -1; };
+    controls.clear();
+    controls.push_back(edge.p1);
+    std::vector<QPointF> dstPath;
+    auto src = isGroup(edge.src) ? edge.src : -1;
+    auto dst = isGroup(edge.dst) ? edge.dst : -1;
+    while (src != dst) {                                    // 1.
+        if (depth(src) >= depth(dst)) {
+            controls.push_back(hierarchy.centers[src]);
+            src = hierarchy.parents[src];
+            src = isGroup(src) ? src : -1;
+        } else {
+            dstPath.push_back(hierarchy.centers[dst]);
+            dst = hierarchy.parents[dst];
+            dst = isGroup(dst) ? dst : -1;
+        }
+    }
+    if (src >= 0)                                           // 2.
+        controls.push_back(hierarchy.centers[src]);
+    controls.insert(controls.end(), dstPath.rbegin(), dstPath.rend());
+    controls.push_back(edge.p2);
+}
+
+void    EdgeBundler::appendFlattenedSpline(std::vector<QPointF>& controls, std::vector<QPointF>& points) const noexcept
+{
+    // Algorithm:
+    // 1. Straighten control polygon: Pi' = strength * Pi + (1 - strength) * (P0 + i / (N - 1) * (PN-1 - P0)).
+    // 2. Flatten a clamped uniform cubic B-spline (ends control points are tripled, so that curve
+    //    start on P0 and end on PN-1).
+    const auto n = static_cast<int>(controls.size());
+    if (n <= 2) {
+        points.insert(points.end(), controls.begin(), controls.end());
+        return;
+    }
+    const auto p0 = controls.front();
+    const auto pn = controls.back();
+    for (int i = 1; i < n - 1; i++) {                       // 1.
+        const auto t = static_cast<qreal>(i) / (n - 1);
+        controls[i] = _strength * controls[i] + (1. - _strength) * (p0 + t * (pn - p0));
+    }
+
+    const auto control = [&controls, n](int i) -> const QPointF& {      // 2.
+        return controls[static_cast<std::size_t>(std::clamp(i - 2, 0, n - 1))];
+    };
+    const auto spanCount = n + 1;       // (n + 4 padded control points) - 3
+    points.push_back(p0);
+    for (int s = 0; s < spanCount; s++) {
+        const auto& b0 = control(s);
+        const auto& b1 = control(s + 1);
+        const auto& b2 = control(s + 2);
+        const auto& b3 = control(s + 3);
+        for (int k = 1; k <= _spanSegments; k++) {
+            const auto t = static_cast<qreal>(k) / _spanSegments;
+            const auto t2 = t * t;
+            const auto t3 = t2 * t;
+            const auto mt = 1. - t;
+            points.push_back((mt * mt * mt * b0 +
+                              (3. * t3 - 6. * t2 + 4.) * b1 +
+                              (-3. * t3 + 3. * t2 + 3. * t + 1.) * b2 +
+                              t3 * b3) / 6.);
+        }
+    }
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
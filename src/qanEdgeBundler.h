@@ -0,0 +1,112 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanEdgeBundler.h
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <cstddef>
+#include <vector>
+
+// Qt headers
+#include <QPointF>
+
+namespace qan { // ::qan
+
+/*! \brief Hierarchical edge bundling (see Holten, "Hierarchical Edge Bundles", 2006) over qan::Group nesting.
+ *
+ * Bundler works on flat data only: group hierarchy is described by parent indexes and centers, edges
+ * by their ends and their source and destination parent group indexes. An edge control polygon is
+ * built from its source end, up source groups to the lowest common ancestor group, down destination
+ * groups to its destination end. Edges crossing the same groups then share control points. Control
+ * polygon is straightened according to bundling \c strength and flattened as a cubic B-spline.
+ *
+ * Edges are bundled in parallel, bundler has no Qt object dependency and could be used from any thread.
+ */
+class EdgeBundler
+{
+public:
+    EdgeBundler() = default;
+    ~EdgeBundler() = default;
+    EdgeBundler(const EdgeBundler&) = default;
+
+public:
+    //! Group hierarchy, \c parents[g] is the parent group index of group \c g (-1 for root groups).
+    struct Hierarchy {
+        std::vector<int>        parents;
+        std::vector<QPointF>    centers;
+    };
+    //! Bundled edge, \c src and \c dst are source and destination parent group indexes (-1 for root nodes).
+    struct Edge {
+        int     src = -1;
+        int     dst = -1;
+        QPointF p1;
+        QPointF p2;
+    };
+    //! Flattened polylines, edge \c e points are in [offsets[e], offsets[e + 1]).
+    struct Polylines {
+        std::vector<QPointF>        points;
+        std::vector<std::size_t>    offsets;
+    };
+
+    //! Bundling strength in [0, 1], 0 for straight edges, 1 for edges strictly following hierarchy (default to 0.85).
+    inline qreal    getStrength() const noexcept { return _strength; }
+    //! \copydoc getStrength()
+    void            setStrength(qreal strength) noexcept;
+
+    //! Number of flattened segments per B-spline span (default to 6).
+    inline int      getSpanSegments() const noexcept { return _spanSegments; }
+    //! \copydoc getSpanSegments()
+    void            setSpanSegments(int spanSegments) noexcept;
+
+    /*! \brief Bundle \c edges and return their flattened polylines in \c polylines, using up to \c threadCount threads.
+     *
+     * \note Polylines always start on edge \c p1 and end on edge \c p2, edges whose ends share the same
+     * parent group are bent toward this group center.
+     */
+    void            bundle(const Hierarchy& hierarchy, const std::vector<Edge>& edges,
+                           Polylines& polylines, int threadCount) const noexcept;
+
+private:
+    //! Generate \c edge control polygon in \c controls, \c depths are \c hierarchy groups depth.
+    void            generateControlPolygon(const Hierarchy& hierarchy, const std::vector<int>& depths,
+                                           const Edge& edge, std::vector<QPointF>& controls) const noexcept;
+    //! Straighten \c controls and append the flattened B-spline to \c points.
+    void            appendFlattenedSpline(std::vector<QPointF>& controls, std::vector<QPointF>& points) const noexcept;
+
+private:
+    qreal   _strength = 0.85;
+    int     _spanSegments = 6;
+};
+
+} // ::qan
@@ -0,0 +1,177 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanEdgeEffectMaterial.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cstring>
+
+// Qt headers
+#include <QSGMaterialShader>
+#include <QMatrix4x4>
+
+// QuickQanava headers
+#include "./qanEdgeEffectMaterial.h"
+
+namespace qan { // ::qan
+
+namespace impl { // ::qan::impl
+
+/*! \brief Edge effect shader, see shaders/edgeeffect.vert and shaders/edgeeffect.frag.
+ *
+ * Uniform buffer layout (std140):
+ * \code
+ *   0: mat4  qt_Matrix
+ *  64: float qt_Opacity
+ *  68: float time
+ *  72: float speed
+ *  76: int   effect
+ *  80: vec4  color         (premultiplied)
+ *  96: vec4  effectColor   (premultiplied)
+ * 112: vec2  pattern
+ * \endcode
+ */
+class EdgeEffectShader : public QSGMaterialShader
+{
+public:
+    EdgeEffectShader()
+    {
+        setShaderFileName(VertexStage, QStringLiteral(":/QuickQanava/shaders/edgeeffect.vert.qsb"));
+        setShaderFileName(FragmentStage, QStringLiteral(":/QuickQanava/shaders/edgeeffect.frag.qsb"));
+    }
+
+    virtual bool    updateUniformData(RenderState& state, QSGMaterial* newMaterial, QSGMaterial* oldMaterial) override
+    {
+        Q_UNUSED(oldMaterial)
+        auto buffer = state.uniformData();
+        Q_ASSERT(buffer->size() >= 120);
+        auto data = buffer->data();
+        if (state.isMatrixDirty()) {
+            const QMatrix4x4 matrix = state.combinedMatrix();
+            std::memcpy(data, matrix.constData(), 64);
+        }
+        if (state.isOpacityDirty()) {
+            const float opacity = state.opacity();
+            std::memcpy(data + 64, &opacity, 4);
+        }
+        // Note: Effect uniforms are small, always update them (time is modified every frame anyway)
+        const auto material = static_cast<const qan::EdgeEffectMaterial*>(newMaterial);
+        const float time = material->getTime();
+        const float speed = material->getSpeed();
+        const qint32 effect = static_cast<qint32>(material->getEffectType());
+        std::memcpy(data + 68, &time, 4);
+        std::memcpy(data + 72, &speed, 4);
+        std::memcpy(data + 76, &effect, 4);
+        const auto premultiplied = [](const QColor& color, float* rgba) {
+            const auto alpha = static_cast<float>(color.alphaF());
+            rgba[0] = static_cast<float>(color.redF()) * alpha;
+            rgba[1] = static_cast<float>(color.greenF()) * alpha;
+            rgba[2] = static_cast<float>(color.blueF()) * alpha;
+            rgba[3] = alpha;
+        };
+        float colors[8];
+        premultiplied(material->getColor(), colors);
+        premultiplied(material->getEffectColor(), colors + 4);
+        std::memcpy(data + 80, colors, 32);
+        const float pattern[2] = {static_cast<float>(material->getPattern().x()),
+                                  static_cast<float>(material->getPattern().y())};
+        std::memcpy(data + 112, pattern, 8);
+        return true;
+    }
+};
+
+} // ::qan::impl
+
+
+/* EdgeEffectMaterial Object Management *///-----------------------------------
+EdgeEffectMaterial::EdgeEffectMaterial() :
+    QSGMaterial{}
+{
+    setFlag(QSGMaterial::Blending, true);
+}
+
+QSGMaterialType*    EdgeEffectMaterial::type() const
+{
+    static QSGMaterialType type;
+    return &type;
+}
+
+QSGMaterialShader*  EdgeEffectMaterial::createShader(QSGRendererInterface::RenderMode renderMode) const
+{
+    Q_UNUSED(renderMode)
+    return new qan::impl::EdgeEffectShader{};
+}
+
+int     EdgeEffectMaterial::compare(const QSGMaterial* other) const
+{
+    // Note: Materials of different styles never compare equal, there is only one material per style batch.
+    const auto self = reinterpret_cast<quintptr>(this);
+    const auto otherMaterial = reinterpret_cast<quintptr>(other);
+    return self == otherMaterial ? 0 : (self < otherMaterial ? -1 : 1);
+}
+
+bool    EdgeEffectMaterial::setStyle(const qan::EdgeStyle& style)
+{
+    // Algorithm:
+    // 1. Dash pattern is expressed in line width units (see QtQuick.Shape ShapePath.dashPattern),
+    //    convert its first dash and space to pixels.
+    // 2. Update material effect configuration.
+    const auto& dashPattern = style.getDashPattern();   // 1.
+    const auto width = style.getLineWidth();
+    const QPointF pattern{(dashPattern.size() > 0 ? std::max(0., dashPattern.at(0)) : 2.) * width,
+                          (dashPattern.size() > 1 ? std::max(0., dashPattern.at(1)) : 2.) * width};
+    const auto speed = static_cast<float>(style.getEffectSpeed());
+    if (_effectType == style.getEffectType() &&         // 2.
+        _color == style.getLineColor() &&
+        _effectColor == style.getEffectColor() &&
+        qFuzzyCompare(1.f + _speed, 1.f + speed) &&
+        _pattern == pattern)
+        return false;
+    _effectType = style.getEffectType();
+    _color = style.getLineColor();
+    _effectColor = style.getEffectColor();
+    _speed = speed;
+    _pattern = pattern;
+    return true;
+}
+
+bool    EdgeEffectMaterial::setTime(float time)
+{
+    if (qFuzzyCompare(1.f + _time, 1.f + time))
+        return false;
+    _time = time;
+    return true;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,92 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanEdgeEffectMaterial.h
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Qt headers
+#include <QColor>
+#include <QPointF>
+#include <QSGMaterial>
+#include <QSGGeometry>
+
+// QuickQanava headers
+#include "./qanStyle.h"
+
+namespace qan { // ::qan
+
+/*! \brief Scene graph material drawing batched edges with an animated effect (see qan::EdgeStyle::effectType).
+ *
+ * Material use QSGGeometry::TexturedPoint2D vertices: \c x and \c y are vertex position, \c tx is
+ * edge line arc length from source, and \c ty is vertex position across line in [-1, 1]. Edge
+ * ends (arrows) vertices use a \c ty of 2.: only pulse effect is applied to ends.
+ *
+ * Effects are computed in fragment shader from a single \c time uniform: animating effects only
+ * require updating time, with no geometry regeneration.
+ */
+class EdgeEffectMaterial : public QSGMaterial
+{
+public:
+    EdgeEffectMaterial();
+    virtual ~EdgeEffectMaterial() override = default;
+    EdgeEffectMaterial(const EdgeEffectMaterial&) = delete;
+
+public:
+    virtual QSGMaterialType*    type() const override;
+    virtual QSGMaterialShader*  createShader(QSGRendererInterface::RenderMode renderMode) const override;
+    virtual int                 compare(const QSGMaterial* other) const override;
+
+public:
+    //! Configure material from \c style effect, return true if material has been modified.
+    bool            setStyle(const qan::EdgeStyle& style);
+    //! Set effect time in seconds, return true if material has been modified.
+    bool            setTime(float time);
+
+    inline auto     getEffectType() const noexcept -> qan::EdgeStyle::EffectType { return _effectType; }
+    inline auto     getColor() const noexcept -> const QColor& { return _color; }
+    inline auto     getEffectColor() const noexcept -> const QColor& { return _effectColor; }
+    inline auto     getSpeed() const noexcept -> float { return _speed; }
+    //! Dash (or particle) length and space length in pixels.
+    inline auto     getPattern() const noexcept -> const QPointF& { return _pattern; }
+    inline auto     getTime() const noexcept -> float { return _time; }
+
+private:
+    qan::EdgeStyle::EffectType  _effectType = qan::EdgeStyle::EffectType::EffectNone;
+    QColor                      _color;
+    QColor                      _effectColor;
+    float                       _speed = 0.f;
+    QPointF                     _pattern;
+    float                       _time = 0.f;
+};
+
+} // ::qan
@@ -32,21 +32,31 @@
 // \date    2017 03 02
 //-----------------------------------------------------------------------------
 
+// Std headers
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <typeinfo>
+#include <vector>
+
 // Qt headers
 #include <QtGlobal>
 #include <QBrush>
 #include <QPainter>
+#include <QSemaphore>
+#include <QThreadPool>
+#include <qqml.h>       // QQmlPrivate::QQmlElement
 
 // QuickQanava headers
 #include "./qanUtils.h"
 #include "./qanEdgeItem.h"
+#include "./qanEdgePath.h"
+#include "./qanPolygonIntersection.h"
 #include "./qanNodeItem.h"      // Resolve forward declaration
 #include "./qanGroupItem.h"
 #include "./qanGraph.h"
 #include "./qanEdgeDraggableCtrl.h"
 
-#include "./bezier/include/bezier.h"
-
 namespace qan { // ::qan
 
 /* Edge Object Management *///-------------------------------------------------
@@ -71,6 +81,20 @@ EdgeItem::EdgeItem(QQuickItem* parent) :
             this,   &qan::EdgeItem::onWidthChanged);
     connect(this,   &qan::EdgeItem::heightChanged,
             this,   &qan::EdgeItem::onHeightChanged);
+    connect(this,   &qan::EdgeItem::visibleChanged,
+            this,   &qan::EdgeItem::invalidateBatchedGeometry);
+    connect(this,   &qan::EdgeItem::selectedChanged,
+            this,   &qan::EdgeItem::invalidateBatchedGeometry);
+}
+
+EdgeItem::~EdgeItem()
+{
+    // Note: Use _graph directly, edge might already have been destroyed.
+    if (_graph)
+        _graph->removeMultiEdge(*this);
+    if (_graph &&
+        _graph->getEdgeLayer() != nullptr)
+        _graph->getEdgeLayer()->removeEdge(*this);
 }
 
 auto    EdgeItem::getEdge() noexcept -> qan::Edge* { return _edge.data(); }
@@ -79,9 +103,11 @@ auto    EdgeItem::setEdge(qan::Edge* edge) noexcept -> void
 {
     if (_edge != edge) {
         _edge = edge;
-        edge->setItem(this);
+        if (edge != nullptr)
+            edge->setItem(this);
         const auto edgeDraggableCtrl = static_cast<EdgeDraggableCtrl*>(_draggableCtrl.get());
         edgeDraggableCtrl->setTarget(edge);
+        emit edgeChanged();
     }
 }
 
@@ -99,8 +125,12 @@ auto    EdgeItem::getGraph() -> qan::Graph*
 }
 auto    EdgeItem::setGraph(qan::Graph* graph) -> void
 {
+    if (_graph &&
+        _graph != graph)
+        _graph->removeMultiEdge(*this);
     _graph = graph; emit graphChanged();
     qan::Selectable::configure(this, graph);
+    updateMultiEdge();
 }
 //-----------------------------------------------------------------------------
 
@@ -111,7 +141,7 @@ auto    EdgeItem::setSourceItem(qan::NodeItem* source) -> void
         return;
 
     // Connect dst x and y monitored properties change notify signal to slot updateEdge()
-    QMetaMethod updateItemSlot = metaObject()->method( metaObject()->indexOfSlot( "updateItemSlot()" ) );
+    QMetaMethod updateItemSlot = metaObject()->method( metaObject()->indexOfSlot( "scheduleUpdateItem()" ) );
     if ( updateItemSlot.isValid() ) {  // Connect src and dst x and y monitored properties change notify signal to slot updateItemSlot()
         auto srcMetaObj = source->metaObject();
         QMetaProperty srcX      = srcMetaObj->property(srcMetaObj->indexOfProperty("x"));
@@ -142,6 +172,7 @@ auto    EdgeItem::setSourceItem(qan::NodeItem* source) -> void
         connect(source, srcHeight.notifySignal(),  this, updateItemSlot);
         _sourceItem = source;
         emit sourceItemChanged();
+        updateMultiEdge();
         if (source->z() < z())
             setZ(source->z() - 0.5);
         updateItem();
@@ -154,17 +185,33 @@ auto    EdgeItem::setDestinationItem(qan::NodeItem* destination) -> void
         configureDestinationItem(destination);
         _destinationItem = destination;
         emit destinationItemChanged();
+        updateMultiEdge();
     }
     updateItem();
 }
 
+void    EdgeItem::detachItems() noexcept
+{
+    if (_sourceItem) {
+        disconnect(_sourceItem.data(), nullptr, this, nullptr);
+        _sourceItem = nullptr;
+        emit sourceItemChanged();
+    }
+    if (_destinationItem) {
+        disconnect(_destinationItem.data(), nullptr, this, nullptr);
+        _destinationItem = nullptr;
+        emit destinationItemChanged();
+    }
+    updateMultiEdge();
+}
+
 void    EdgeItem::configureDestinationItem(QQuickItem* item)
 {
     if (item == nullptr)
         return;
 
     // Connect dst x and y monitored properties change notify signal to slot updateItemSlot()
-    QMetaMethod updateItemSlot = metaObject()->method(metaObject()->indexOfSlot("updateItemSlot()"));
+    QMetaMethod updateItemSlot = metaObject()->method(metaObject()->indexOfSlot("scheduleUpdateItem()"));
     if (!updateItemSlot.isValid()) {
         qWarning() << "qan::EdgeItem::setDestinationItem(): Error: no access to edge updateItem slot.";
         return;
@@ -201,15 +248,160 @@ void    EdgeItem::configureDestinationItem(QQuickItem* item)
 }
 //-----------------------------------------------------------------------------
 
+/* Multi Edges Management *///-------------------------------------------------
+qan::EdgeStyle::LineType    EdgeItem::getLineType() const noexcept
+{
+    if (_selfLoop)
+        return qan::EdgeStyle::LineType::Curved;
+    return _style ? _style->getLineType() : qan::EdgeStyle::LineType::Straight;
+}
+
+void    EdgeItem::setFan(int index, int count, bool reversed) noexcept
+{
+    if (index != _fanIndex ||
+        count != _fanCount ||
+        reversed != _fanReversed) {
+        _fanIndex = index;
+        _fanCount = count;
+        _fanReversed = reversed;
+        scheduleUpdateItem();
+    }
+}
+
+void    EdgeItem::updateMultiEdge() noexcept
+{
+    const auto selfLoop = _sourceItem != nullptr &&
+                          _sourceItem == _destinationItem;
+    if (selfLoop != _selfLoop) {
+        _selfLoop = selfLoop;
+        emit selfLoopChanged();
+    }
+    if (_graph)
+        _graph->updateMultiEdge(*this);
+}
+//-----------------------------------------------------------------------------
+
+
+/* Flattened Path Management *///----------------------------------------------
+void    EdgeItem::generatePath(GeometryCache& cache) const noexcept
+{
+    // PRECONDITIONS:
+        // cache should be valid
+    if (!cache.isValid())
+        return;
+    cache.path.clear();
+    switch (cache.lineType) {
+    case qan::EdgeStyle::LineType::Undefined:  // [[fallthrough]]
+    case qan::EdgeStyle::LineType::Straight:
+        cache.path << cache.p1 << cache.p2;
+        break;
+    case qan::EdgeStyle::LineType::Curved:
+        cache.path << cache.p1;
+        flattenCubic(cache.p1, cache.c1, cache.c2, cache.p2, /*tolerance*/0.25, /*depth*/10, cache.path);
+        break;
+    case qan::EdgeStyle::LineType::Ortho:
+        if (cache.orthoPath.size() >= 2)
+            cache.path = cache.orthoPath;
+        else
+            cache.path << cache.p1 << cache.c1 << cache.p2;
+        break;
+    }
+    generatePathLengths(cache.path, cache.pathLengths);
+}
+
+void    EdgeItem::setPath(QPolygonF path, std::vector<qreal> pathLengths) noexcept
+{
+    _path = std::move(path);
+    _pathLengths = std::move(pathLengths);
+    _pathBr = _path.boundingRect();
+    emit pathChanged();
+}
+
+QPointF EdgeItem::pointAtPercent(qreal percent) const noexcept
+{
+    return pathPointAtLength(_path, _pathLengths,
+                             std::clamp(percent, 0., 1.) * getPathLength());
+}
+
+qreal   EdgeItem::angleAtPercent(qreal percent) const noexcept
+{
+    if (_path.size() < 2 ||
+        _pathLengths.size() != static_cast<std::size_t>(_path.size()))
+        return -1.;
+    qreal t = 0.;
+    const auto s = pathSegmentAtLength(_pathLengths, std::clamp(percent, 0., 1.) * getPathLength(), t);
+    return lineAngle(QLineF{_path.at(s), _path.at(s + 1)});
+}
+//-----------------------------------------------------------------------------
+
+
 /* Edge Drawing Management *///------------------------------------------------
 void    EdgeItem::setHidden(bool hidden) noexcept
 {
     if (hidden != _hidden) {
         _hidden = hidden;
         emit hiddenChanged();
+        invalidateBatchedGeometry();
+    }
+}
+
+void    EdgeItem::setBatched(bool batched) noexcept
+{
+    if (batched != _batched) {
+        _batched = batched;
+        updateLayerBatch();     // Edge has been added or removed from layer
+        emit batchedChanged();
     }
 }
 
+void    EdgeItem::updateLayerBatch() noexcept
+{
+    const auto graph = getGraph();
+    const auto edgeLayer = graph != nullptr ? graph->getEdgeLayer() : nullptr;
+    if (edgeLayer == nullptr)
+        return;
+    if (_batched &&
+        _edge &&
+        _edge->getItem() == this)   // Note: parked items are not drawn by layer
+        edgeLayer->insertEdge(*this);
+    else
+        edgeLayer->removeEdge(*this);
+}
+
+void    EdgeItem::invalidateBatchedGeometry()
+{
+    if (!_batched)
+        return;
+    const auto graph = getGraph();
+    if (graph != nullptr &&
+        graph->getEdgeLayer() != nullptr)
+        graph->getEdgeLayer()->invalidateEdge(*this);
+}
+
+void    EdgeItem::setCulled(bool culled) noexcept
+{
+    if (culled == _culled)
+        return;
+    _culled = culled;
+    if (_culled) {
+        _culledVisible = isVisible();   // Note: Do not restore edges hidden by user or collapsing
+        if (_culledVisible)
+            setVisible(false);
+    } else if (_culledVisible)
+        setVisible(true);
+    emit culledChanged();
+    if (!_culled)           // Geometry has not been generated while edge was culled
+        updateItem();
+}
+
+void    EdgeItem::setItemVisible(bool visible) noexcept
+{
+    if (_culled)
+        _culledVisible = visible;
+    else
+        setVisible(visible);
+}
+
 void    EdgeItem::setArrowSize( qreal arrowSize ) noexcept
 {
     if (!qFuzzyCompare(1. + arrowSize, 1. + _arrowSize)) {
@@ -249,33 +441,161 @@ void    EdgeItem::updateItem() noexcept
         // 2. generate edge ends:      P1 / P2
         // 3. generate control points: C1 / C2
     auto cache = generateGeometryCache();       // 1.
+    if (!prepareGeometry(cache))
+        return;
+    generateGeometry(cache);                    // 2. and 3.
+
+    // A valid geometry has been generated, generate a bounding box for edge,
+    // and project all geometry in edge CS.
+    commitGeometry(cache);
+}
+
+bool    EdgeItem::prepareGeometry(GeometryCache& cache) noexcept
+{
+    if (_culled) {      // Culled edges only maintain a rough bounding rect, see culled property
+        if (cache.isValid()) {
+            const auto edgeBr = cache.srcBr.united(cache.dstBr);
+            setPosition(edgeBr.topLeft());
+            setSize(edgeBr.size());
+        }
+        return false;
+    }
     if (cache.isValid()) {
-        switch (cache.lineType) {               // 2.
-        case qan::EdgeStyle::LineType::Undefined:       // [[fallthrough]] default to Straight
+        if (cache.lineType == qan::EdgeStyle::LineType::Ortho)
+            cache.routed = generateRoutedOrthoEnds(cache);
+        else if (getGraph() != nullptr &&
+                 getGraph()->getOrthoRouting())
+            getGraph()->getOrthoRouter().removeRoute(getEdge());
+    }
+    return true;
+}
+
+void    EdgeItem::generateGeometry(GeometryCache& cache) const noexcept
+{
+    if (!cache.isValid())
+        return;
+    if (cache.selfLoop)     // Self loops are always curved, see getLineType()
+        generateSelfLoopGeometry(cache);
+    else {
+        switch (cache.lineType) {
+        case qan::EdgeStyle::LineType::Undefined:   // [[fallthrough]] default to Straight
         case qan::EdgeStyle::LineType::Straight: generateStraightEnds(cache); break;
         case qan::EdgeStyle::LineType::Curved:   generateStraightEnds(cache); break;
-        case qan::EdgeStyle::LineType::Ortho:    generateOrthoEnds(cache);    break;
+        case qan::EdgeStyle::LineType::Ortho:
+            if (!cache.routed)
+                generateOrthoEnds(cache);
+            break;
         }
-        if (cache.isValid()) {
-            switch (cache.lineType) {           // 3.
-            case qan::EdgeStyle::LineType::Undefined:   // [[fallthrough]] default to Straight
-            case qan::EdgeStyle::LineType::Straight: /* Nil */                           break;
-            case qan::EdgeStyle::LineType::Curved:   generateCurvedControlPoints(cache); break;
-            case qan::EdgeStyle::LineType::Ortho:    /* Nil */                           break; // Ortho C1 control point is generated in generateOrthoEnds()
-            }
-            generateArrowGeometry(cache);
-            generateLabelPosition(cache);
+    }
+    if (cache.isValid()) {
+        switch (cache.lineType) {
+        case qan::EdgeStyle::LineType::Undefined:   // [[fallthrough]] default to Straight
+        case qan::EdgeStyle::LineType::Straight: /* Nil */                           break;
+        case qan::EdgeStyle::LineType::Curved:
+            if (!cache.selfLoop)
+                generateCurvedControlPoints(cache);
+            break;
+        case qan::EdgeStyle::LineType::Ortho:    /* Nil */                           break; // Ortho C1 control point is generated in generateOrthoEnds()
         }
+        generatePath(cache);
+        generateArrowGeometry(cache);
+        generateLabelPosition(cache);
     }
+}
 
-    // A valid geometry has been generated, generate a bounding box for edge,
-    // and project all geometry in edge CS.
+void    EdgeItem::commitGeometry(const GeometryCache& cache) noexcept
+{
     if (cache.isValid())
         applyGeometry(cache);
     else
         setHidden(true);
 }
 
+void    EdgeItem::updateItems(const std::vector<QPointer<qan::EdgeItem>>& edgeItems, int threadCount) noexcept
+{
+    // Algorithm:
+    // 1. Serially generate geometry caches (items mapping, z and ortho routes need GUI thread).
+    // 2. Generate ends, control points and arrows from caches, in parallel for large sets.
+    // 3. Serially apply caches to items.
+    const auto count = static_cast<int>(edgeItems.size());
+    std::vector<GeometryCache>  caches;
+    std::vector<char>           active(edgeItems.size(), 0);
+    caches.reserve(edgeItems.size());
+    for (int e = 0; e < count; e++) {      // 1.
+        const auto& edgeItem = edgeItems[e];
+        if (!edgeItem) {
+            caches.emplace_back();
+            continue;
+        }
+        edgeItem->_updateScheduled = false;
+        caches.emplace_back(edgeItem->generateGeometryCache());
+        active[e] = edgeItem->prepareGeometry(caches.back()) ? 1 : 0;
+    }
+
+    const auto generate = [&edgeItems, &caches, &active](int first, int last) {     // 2.
+        for (int e = first; e < last; e++)
+            if (active[e] != 0)
+                edgeItems[e]->generateGeometry(caches[e]);
+    };
+    // Note: Do not dispatch small sets, synchronization cost is not worth it.
+    const auto chunkCount = std::max(1, std::min(threadCount, count / 256));
+    if (chunkCount <= 1)
+        generate(0, count);
+    else {
+        // Note: Chunks are run on global thread pool persistent threads, first chunk is generated in
+        // GUI thread, chunks that can't be started when pool is busy are generated synchronously.
+        const auto chunkSize = (count + chunkCount - 1) / chunkCount;
+        QSemaphore  generated;
+        int         chunks = 0;
+        for (int first = chunkSize; first < count; first += chunkSize, ++chunks) {
+            const auto last = std::min(count, first + chunkSize);
+            const auto task = [&generate, &generated, first, last]() {
+                generate(first, last);
+                generated.release();
+            };
+            if (!QThreadPool::globalInstance()->tryStart(task))
+                task();
+        }
+        generate(0, std::min(count, chunkSize));
+        generated.acquire(chunks);
+    }
+
+    for (int e = 0; e < count; e++)         // 3.
+        if (active[e] != 0 &&
+            edgeItems[e])                   // Note: applying geometry might have destroyed an item
+            edgeItems[e]->commitGeometry(caches[e]);
+}
+
+bool    EdgeItem::isConcurrentUpdateEnabled() const noexcept
+{
+    // Note: QML delegates are instantiated as QQmlPrivate::QQmlElement<qan::EdgeItem>, they can't
+    // override updateItem().
+    const auto& type = typeid(*this);
+    return type == typeid(qan::EdgeItem) ||
+           type == typeid(QQmlPrivate::QQmlElement<qan::EdgeItem>);
+}
+
+void    EdgeItem::scheduleUpdateItem() noexcept
+{
+    if (_updateScheduled)
+        return;
+    const auto graph = getGraph();
+    if (graph == nullptr) {
+        updateItemSlot();
+        return;
+    }
+    _updateScheduled = true;
+    graph->scheduleEdgeUpdate(*this);
+}
+
+void    EdgeItem::processScheduledUpdate() noexcept
+{
+    if (_updateScheduled) {
+        _updateScheduled = false;
+        updateItemSlot();
+    }
+}
+
 EdgeItem::GeometryCache::GeometryCache(GeometryCache&& rha) :
     valid{rha.valid},
     lineType{rha.lineType},
@@ -295,6 +615,14 @@ EdgeItem::GeometryCache::GeometryCache(GeometryCache&& rha) :
     srcA3{std::move(rha.srcA3)},
     srcAngle{rha.srcAngle},
     c1{std::move(rha.c1)},          c2{std::move(rha.c2)},
+    orthoPath{std::move(rha.orthoPath)},
+    routed{rha.routed},
+    fanOffset{rha.fanOffset},
+    fanIndex{rha.fanIndex},
+    fanSpacing{rha.fanSpacing},
+    selfLoop{rha.selfLoop},
+    path{std::move(rha.path)},
+    pathLengths{std::move(rha.pathLengths)},
     labelPosition{std::move(rha.labelPosition)}
 {
     srcItem.swap(rha.srcItem);
@@ -374,23 +702,13 @@ EdgeItem::GeometryCache  EdgeItem::generateGeometryCache() const noexcept
         return cache;   // Return invalid cache
 
     // Generate bounding shapes for source and destination in global CS
+    // Note: Use source and destination cached global transform, mapToItem() walk the whole parent chain for every point.
     {
-        if (_sourceItem != nullptr) {        // Generate source bounding shape polygon
-            const auto srcBs = _sourceItem->getBoundingShape();
-            cache.srcBs.resize(srcBs.size());
-            int p = 0;
-            for (const auto& point: srcBs)
-                cache.srcBs[p++] = _sourceItem->mapToItem(graphContainerItem, point);
-        }
+        if (_sourceItem != nullptr)         // Generate source bounding shape polygon
+            cache.srcBs = _sourceItem->getGlobalTransform(graphContainerItem).map(_sourceItem->getBoundingShape());
         // Generate destination bounding shape polygon
-        if (dstNodeItem != nullptr) {        // Regular Node -> Node edge
-            // Update edge z to source or destination maximum x
-            const auto dstBs = dstNodeItem->getBoundingShape();
-            cache.dstBs.resize(dstBs.size());
-            int p = 0;
-            for (const auto& point: dstBs)
-                cache.dstBs[p++] = dstNodeItem->mapToItem(graphContainerItem, point);
-        }
+        if (dstNodeItem != nullptr)         // Regular Node -> Node edge
+            cache.dstBs = dstNodeItem->getGlobalTransform(graphContainerItem).map(dstNodeItem->getBoundingShape());
     }
 
     // Verify source and destination bounding shapes
@@ -401,12 +719,11 @@ EdgeItem::GeometryCache  EdgeItem::generateGeometryCache() const noexcept
     }
 
     // Generate edge geometry Z according to actual src and dst z
-    const qreal srcZ = qan::getItemGlobalZ_rec(srcItem);
-    const qreal dstZ = qan::getItemGlobalZ_rec(dstItem);
+    const qreal srcZ = _sourceItem->getGlobalZ(graphContainerItem);
+    const qreal dstZ = dstNodeItem->getGlobalZ(graphContainerItem);
     cache.z = qMax(srcZ, dstZ) - 0.1;   // Edge z value should be less than src/dst value to ensure port item and selection is on top of edge
 
-    if (_style)
-        cache.lineType = _style->getLineType();
+    cache.lineType = getLineType();
 
     // Generate edge line P1 and P2 in global graph CS
     const auto srcBr = cache.srcBs.boundingRect();
@@ -418,6 +735,15 @@ EdgeItem::GeometryCache  EdgeItem::generateGeometryCache() const noexcept
     cache.srcBrCenter = srcBrCenter;
     cache.dstBrCenter = dstBrCenter;
 
+    // Generate parallel edges fan offset, orthogonal to fan canonical direction
+    cache.selfLoop = _selfLoop;
+    cache.fanIndex = _fanIndex;
+    if (getGraph() != nullptr)
+        cache.fanSpacing = getGraph()->getMultiEdgeSpacing();
+    if (!_selfLoop)
+        cache.fanOffset = _fanReversed ? fanOffset(dstBrCenter, srcBrCenter, _fanIndex, _fanCount, cache.fanSpacing) :
+                                         fanOffset(srcBrCenter, dstBrCenter, _fanIndex, _fanCount, cache.fanSpacing);
+
     cache.valid = true;  // Finally, validate cache
     return cache;        // Expecting RVO
 }
@@ -430,7 +756,8 @@ void    EdgeItem::generateStraightEnds(GeometryCache& cache) const noexcept
     if (!cache.isValid())
         return;
 
-    const QLineF line = getLineIntersection(cache.srcBrCenter, cache.dstBrCenter,
+    // Note: Parallel edges lines are translated by their fan offset (null for single edges).
+    const QLineF line = getLineIntersection(cache.srcBrCenter + cache.fanOffset, cache.dstBrCenter + cache.fanOffset,
                                             cache.srcBs, cache.dstBs);
 
     // Update hidden: Edge is hidden if it's size is less than the src/dst shape size sum
@@ -613,6 +940,38 @@ void    EdgeItem::generateOrthoEnds(GeometryCache& cache) const noexcept
     }
 }
 
+bool    EdgeItem::generateRoutedOrthoEnds(GeometryCache& cache) noexcept
+{
+    // PRECONDITIONS:
+        // cache should be valid
+        // graph ortho routing must be enabled
+        // edge must not be connected to a port
+    if (!cache.isValid())
+        return false;
+    const auto graph = getGraph();
+    const auto edge = getEdge();
+    if (graph == nullptr ||
+        !graph->getOrthoRouting() ||
+        edge == nullptr)
+        return false;
+    if (qobject_cast<const qan::PortItem*>(cache.srcItem) != nullptr ||
+        qobject_cast<const qan::PortItem*>(cache.dstItem) != nullptr) {
+        graph->getOrthoRouter().removeRoute(edge);
+        return false;
+    }
+
+    // Note: Routes are keyed by edge, obstacles by node (see qan::Graph::updateOrthoObstacle()).
+    const auto path = graph->getOrthoRouter().route(edge, edge->get_src(), edge->get_dst(),
+                                                    cache.srcBr, cache.dstBr);
+    if (path.size() < 2)
+        return false;
+    cache.orthoPath = path;
+    cache.p1 = path.first();
+    cache.p2 = path.last();
+    cache.c1 = path.size() > 2 ? path.at(1) : QLineF{cache.p1, cache.p2}.center();
+    return true;
+}
+
 void    EdgeItem::generateArrowGeometry(GeometryCache& cache) const noexcept
 {
     // PRECONDITIONS:
@@ -683,23 +1042,43 @@ void    EdgeItem::generateArrowGeometry(GeometryCache& cache) const noexcept
             cache.srcAngle = generateStraightArrowAngle(cache.p2, cache.p1, srcShape, arrowLength);
             break;
 
-        case qan::EdgeStyle::LineType::Ortho:
-            cache.dstAngle = generateStraightArrowAngle(cache.c1, cache.p2, dstShape, arrowLength);
-            cache.srcAngle = generateStraightArrowAngle(cache.c1, cache.p1, srcShape, arrowLength);
+        case qan::EdgeStyle::LineType::Ortho: {
+            // Note: For routed edges, use first and last bends to orient arrows.
+            const auto pathSize = cache.orthoPath.size();
+            auto srcBend = pathSize > 2 ? cache.orthoPath.at(1) : cache.c1;
+            auto dstBend = pathSize > 2 ? cache.orthoPath.at(pathSize - 2) : cache.c1;
+            cache.dstAngle = generateStraightArrowAngle(dstBend, cache.p2, dstShape, arrowLength);
+            cache.srcAngle = generateStraightArrowAngle(srcBend, cache.p1, srcShape, arrowLength);
+        }
             break;
 
-        case qan::EdgeStyle::LineType::Curved:
-            // Generate source arrow angle (p2 <-> p1 and c2 <-> c1)
-            cache.srcAngle = generateCurvedArrowAngle(cache.p2, cache.p1,
-                                                      cache.c2, cache.c1,
-                                                      srcShape, arrowLength);
-
-            // Generate destination arrow angle
-            cache.dstAngle = generateCurvedArrowAngle(cache.p1, cache.p2,
-                                                      cache.c1, cache.c2,
-                                                      dstShape, arrowLength);
+        case qan::EdgeStyle::LineType::Curved: {
+            // Note: Arrows base are path points at arrowLength from path ends (arc length), arrows
+            // are oriented from their base to path ends, then path is trimmed to arrows base.
+            if (cache.path.size() < 2)
+                break;
+            const auto length = cache.pathLengths.back();
+            const auto srcBase = pathPointAtLength(cache.path, cache.pathLengths, arrowLength);
+            const auto dstBase = pathPointAtLength(cache.path, cache.pathLengths, length - arrowLength);
+            cache.srcAngle = lineAngle(QLineF{srcBase, cache.path.first()});
+            cache.dstAngle = lineAngle(QLineF{dstBase, cache.path.last()});
+
+            trimPath(cache.path, cache.pathLengths,
+                     srcShape != ArrowShape::None ? arrowLength : 0.,
+                     dstShape != ArrowShape::None ? arrowLength : 0.);
+            cache.p1 = cache.path.first();
+            cache.p2 = cache.path.last();
+        }
             break;
     }
+
+    // Straight and ortho arrows have corrected p1 and p2, update path ends
+    if (cache.lineType != qan::EdgeStyle::LineType::Curved &&
+        cache.path.size() >= 2) {
+        cache.path.first() = cache.p1;
+        cache.path.last() = cache.p2;
+        generatePathLengths(cache.path, cache.pathLengths);
+    }
 }
 
 qreal   EdgeItem::generateStraightArrowAngle(QPointF& p1, QPointF& p2,
@@ -714,36 +1093,22 @@ qreal   EdgeItem::generateStraightArrowAngle(QPointF& p1, QPointF& p2,
     return lineAngle(line);
 }
 
-qreal   EdgeItem::generateCurvedArrowAngle(QPointF& p1, QPointF& p2,
-                                           const QPointF& c1, const QPointF& c2,
-                                           const qan::EdgeItem::ArrowShape arrowShape,
-                                           const qreal arrowLength) const noexcept
+void    EdgeItem::generateSelfLoopGeometry(GeometryCache& cache) const noexcept
 {
-    const QLineF line{p1, p2};    // Generate dst arrow line angle
-    qreal angle = 0.;
-
-    // Generate arrow orientation:
-    // General case: get cubic tangent at line end.
-    // Special case: when line length is small (ie less than 4 time arrow length), curve might
-    //               have very sharp orientation, average tangent at curve end AND line angle to avoid
-    //               arrow orientation that does not fit the average curve angle.
-    static constexpr auto averageDstAngleFactor = 4.0;
-    if (line.length() > averageDstAngleFactor * arrowLength)      // General case
-        angle = cubicCurveAngleAt(0.99, p1, p2, c1, c2);
-    else {                                                          // Special case
-        angle = (0.4 * cubicCurveAngleAt(0.99, p1, p2, c1, c2) +
-                 0.6 * lineAngle(line));
-    }
-
-    // Use dst angle to generate an end point translated by -arrowLength except if there is no end shape
-    // Build a (P2, C2) vector
-    if (arrowShape != ArrowShape::None) {
-        QVector2D dstVector{ QPointF{c2.x() - p2.x(), c2.y() - p2.y()} };
-        dstVector.normalize();
-        dstVector *= static_cast<float>(arrowLength);
-        p2 = QPointF{p2} + dstVector.toPointF();
-    }
-   return angle;
+    // PRECONDITIONS:
+        // cache should be valid
+    if (!cache.isValid())
+        return;
+    // Algorithm:
+    // 1. Generate loop arc on source bounding rect, see qan::selfLoopArc().
+    // 2. Project arc ends on source bounding shape, control points are translated with their end.
+    const auto arc = selfLoopArc(cache.srcBr, cache.fanIndex, cache.fanSpacing);     // 1.
+    const auto outside = [&cache](const QPointF& p) { return p + (p - cache.srcBrCenter) * 0.1; };
+    cache.p1 = getLineIntersection(outside(arc.p1), cache.srcBrCenter, cache.srcBs);   // 2.
+    cache.p2 = getLineIntersection(outside(arc.p2), cache.srcBrCenter, cache.srcBs);
+    cache.c1 = cache.p1 + (arc.c1 - arc.p1);
+    cache.c2 = cache.p2 + (arc.c2 - arc.p2);
+    cache.hidden = false;
 }
 
 void    EdgeItem::generateCurvedControlPoints(GeometryCache& cache) const noexcept
@@ -795,10 +1160,12 @@ void    EdgeItem::generateCurvedControlPoints(GeometryCache& cache) const noexce
         const QPointF center{ ( cache.p1.x() + cache.p2.x() ) / 2.,           // (P1,P2) Line center
                               ( cache.p1.y() + cache.p2.y() ) / 2. };
 
+        // Parallel edges: bend fan edges away from each other
+        const auto fanOffset = cache.fanOffset * 2.;
         if ( srcPort == nullptr )
-            cache.c1 = center + offset;
+            cache.c1 = center + offset + fanOffset;
         if ( dstPort == nullptr )
-            cache.c2 = center - offset;
+            cache.c2 = center - offset + fanOffset;
     }
     if ( srcPort != nullptr ||      // If there is a connection to a port item, generate a control point for it
          dstPort != nullptr ) {
@@ -929,15 +1296,19 @@ void    EdgeItem::generateLabelPosition(GeometryCache& cache) const noexcept
     if ( !cache.isValid() )
         return;
 
-    const QLineF line{cache.p1, cache.p2};
-    if ( cache.lineType == qan::EdgeStyle::LineType::Straight ) {
-        cache.labelPosition = line.pointAt(0.5) + QPointF{10., 10.};
-    } else if ( cache.lineType == qan::EdgeStyle::LineType::Curved ) {
+    // Note: Curved edges label keep their historical position at control polygon bounding rect
+    // center, other line types label is positioned at path arc length middle.
+    if ( cache.lineType == qan::EdgeStyle::LineType::Curved ) {
         // Get the barycenter of polygon p1/p2/c1/c2
         QPolygonF p{ {cache.p1, cache.p2, cache.c1, cache.c2 } };
         if (!p.isEmpty())
             cache.labelPosition = p.boundingRect().center();
+        return;
     }
+    if (cache.pathLengths.empty())
+        return;
+    const auto middle = pathPointAtLength(cache.path, cache.pathLengths, cache.pathLengths.back() / 2.);
+    cache.labelPosition = middle + QPointF{10., 10.};
 }
 
 void    EdgeItem::applyGeometry(const GeometryCache& cache) noexcept
@@ -961,12 +1332,19 @@ void    EdgeItem::applyGeometry(const GeometryCache& cache) noexcept
         edgeBrPolygon << cache.p1 << cache.p2;
         if (cache.lineType == qan::EdgeStyle::LineType::Curved)
             edgeBrPolygon << cache.c1 << cache.c2;
+        else if (cache.lineType == qan::EdgeStyle::LineType::Ortho)
+            edgeBrPolygon << cache.orthoPath;
         const QRectF edgeBr = edgeBrPolygon.boundingRect();
-        setPosition(edgeBr.topLeft());    // Note: setPosition() call must occurs before mapFromItem()
+        setPosition(edgeBr.topLeft());    // Note: setPosition() call must occurs before mapping to edge CS
         setSize(edgeBr.size());
 
-        _p1 = mapFromItem(graphContainerItem, cache.p1);
-        _p2 = mapFromItem(graphContainerItem, cache.p2);
+        // Map global geometry to edge CS with a single container -> edge transform
+        bool ok = false;
+        auto toEdge = graphContainerItem->itemTransform(this, &ok);
+        if (!ok)
+            toEdge = QTransform::fromTranslate(-edgeBr.left(), -edgeBr.top());
+        _p1 = toEdge.map(cache.p1);
+        _p2 = toEdge.map(cache.p2);
         emit lineGeometryChanged();
 
         {   // Apply arrow geometry
@@ -991,21 +1369,32 @@ void    EdgeItem::applyGeometry(const GeometryCache& cache) noexcept
             // For otho edge: 3 points for a line P1 -> C1 -> P2
             // For Curved edge: a cubic spline with C1 and C2
         if (cache.lineType == qan::EdgeStyle::LineType::Ortho) {
-            _c1 = mapFromItem(graphContainerItem, cache.c1);
+            _c1 = toEdge.map(cache.c1);
+            // Note: p1 and p2 might have been corrected for arrow geometry, use them as path ends.
+            _orthoPath.clear();
+            _orthoPath << _p1;
+            if (cache.orthoPath.size() >= 2) {
+                for (int p = 1; p < cache.orthoPath.size() - 1; p++)
+                    _orthoPath << toEdge.map(cache.orthoPath.at(p));
+            } else
+                _orthoPath << _c1;
+            _orthoPath << _p2;
             emit controlPointsChanged();
         } else if (cache.lineType == qan::EdgeStyle::LineType::Curved) { // Apply control point geometry
-            _c1 = mapFromItem(graphContainerItem, cache.c1);
-            _c2 = mapFromItem(graphContainerItem, cache.c2);
+            _c1 = toEdge.map(cache.c1);
+            _c2 = toEdge.map(cache.c2);
             emit controlPointsChanged();
         }
+        setPath(toEdge.map(cache.path), cache.pathLengths);
 
         setZ(cache.z);
-        setLabelPos(mapFromItem(graphContainerItem, cache.labelPosition));
+        setLabelPos(toEdge.map(cache.labelPosition));
     }
 
     // Edge item geometry is now valid, set the item visibility to true and "unhide" it
     //setVisible(true);
     setHidden(false);
+    invalidateBatchedGeometry();
 }
 
 qreal   EdgeItem::lineAngle(const QLineF& line) const noexcept
@@ -1027,45 +1416,27 @@ void    EdgeItem::setLine( QPoint src, QPoint dst )
     _p1 = src;
     _p2 = dst;
     emit lineGeometryChanged();
+    QPolygonF path{ {_p1, _p2} };
+    std::vector<qreal> pathLengths;
+    generatePathLengths(path, pathLengths);
+    setPath(std::move(path), std::move(pathLengths));
 }
 
 QPointF  EdgeItem::getLineIntersection(const QPointF& p1, const QPointF& p2,
                                        const QPolygonF& polygon) const noexcept
 {
-    const QLineF line{p1, p2};
     QPointF source{p1};
-    QPointF intersection;
-    for (auto p = 0; p < polygon.length() - 1 ; ++p) {
-        const QLineF polyLine(polygon[p], polygon[p + 1]);
-        if (line.intersects(polyLine, &intersection) == QLineF::BoundedIntersection ) {
-            source = intersection;
-            break;
-        }
-    }
+    qan::polygonLineIntersection(p1, p2, polygon, source);  // Note: source is left unmodified when there is no intersection
     return source;
 }
 
 QLineF  EdgeItem::getLineIntersection( const QPointF& p1, const QPointF& p2,
                                        const QPolygonF& srcBp, const QPolygonF& dstBp ) const noexcept
 {
-    const QLineF line{p1, p2};
     QPointF source{p1};
-    QPointF intersection;
-    for (auto p = 0; p < srcBp.length() - 1 ; ++p) {
-        const QLineF polyLine(srcBp[p], srcBp[p + 1]);
-        if (line.intersects(polyLine, &intersection) == QLineF::BoundedIntersection ) {
-            source = intersection;
-            break;
-        }
-    }
+    qan::polygonLineIntersection(p1, p2, srcBp, source);
     QPointF destination{p2};
-    for (auto p = 0; p < dstBp.length() - 1 ; ++p) {
-        const QLineF polyLine(dstBp[p], dstBp[p + 1]);
-        if (line.intersects(polyLine, &intersection) == QLineF::BoundedIntersection) {
-            destination = intersection;
-            break;
-        }
-    }
+    qan::polygonLineIntersection(p1, p2, dstBp, destination);
     return QLineF{source, destination};
 }
 //-----------------------------------------------------------------------------
@@ -1225,6 +1596,8 @@ void    EdgeItem::setStyle(EdgeStyle* style) noexcept
                     this,      &EdgeItem::styleModified);
         }
         emit styleChanged();
+        if (_batched)       // Edge move from a layer style batch to another
+            updateLayerBatch();
         updateItem();   // Force initial style settings
     }
 }
@@ -1289,47 +1662,34 @@ void    EdgeItem::setAcceptDrops(bool acceptDrops)
     emit acceptDropsChanged();
 }
 
+//! Distance between \c p and segment \c a \c b (distance to the closest segment end if projection is outside segment).
+static inline qreal distanceFromSegment(const QPointF& p, const QPointF& a, const QPointF& b) noexcept
+{
+    const QPointF ab = b - a;
+    const qreal   l2 = QPointF::dotProduct(ab, ab);
+    const qreal   u = l2 > 0.0000001 ? std::clamp(QPointF::dotProduct(p - a, ab) / l2, 0., 1.) : 0.;
+    const QPointF d = p - (a + u * ab);
+    return std::sqrt(QPointF::dotProduct(d, d));
+}
+
 bool    EdgeItem::contains(const QPointF& point) const
 {
-    const auto lineType = _style ? _style->getLineType() : qan::EdgeStyle::LineType::Straight;
-    bool r = false;
-    qreal d = 0.;
-    switch (lineType) {
-    case qan::EdgeStyle::LineType::Undefined:  // [[fallthrough]]
-    case qan::EdgeStyle::LineType::Straight:
-        d = distanceFromLine(point, QLineF{_p1, _p2});
-        r = (d > -0.001 && d < 6.001);
-        break;
-    case qan::EdgeStyle::LineType::Curved: {
-        bezier::Bezier<3> cubicBezier({{static_cast<float>(_p1.x()), static_cast<float>(_p1.y())},
-                                       {static_cast<float>(_c1.x()), static_cast<float>(_c1.y())},
-                                       {static_cast<float>(_c2.x()), static_cast<float>(_c2.y())},
-                                       {static_cast<float>(_p2.x()), static_cast<float>(_p2.y())}});
-        // FIXME: check p in cubicBezier.tbb() (aka Tight bounding box)
-        // FIXME: At least, adapt steps to tbb.length() / thresold (here 6)
-        const auto steps = 25;
-        const auto dStep = 1.0 / static_cast<float>(steps);
-        for (int step = 0; step < steps; step++) {
-            const auto pos = dStep * step;
-            auto curveP = cubicBezier.valueAt(pos);
-            const auto d = QLineF{point, QPointF{curveP.x, curveP.y}}.length();
-            if (d > -0.001 && d < 6.001) {
-                r = true;
-                break;
-            }
-        }
-    }
-        break;
-    case qan::EdgeStyle::LineType::Ortho:
-        d = distanceFromLine(point, QLineF{_p1, _c1});
-        r = (d > -0.001 && d < 6.001);
-        if (!r) {
-            const qreal d2 = distanceFromLine(point, QLineF{_p2, _c1});
-            r = (d2 > -0.001 && d2 < 6.001);
-        }
-        break;
-    }
-    return r;
+    // Algorithm:
+    // 1. Reject points outside flattened path tight bounding rect inflated by hit distance.
+    // 2. Look for a path segment within hit distance.
+
+    // 1.
+    if (_path.isEmpty() ||
+        !_pathBr.adjusted(-hitDistance, -hitDistance, hitDistance, hitDistance).contains(point))
+        return false;
+
+    // 2.
+    if (_path.size() == 1)
+        return QLineF{point, _path.first()}.length() < hitDistance + 0.001;
+    for (int p = 0; p < _path.size() - 1; p++)
+        if (distanceFromSegment(point, _path.at(p), _path.at(p + 1)) < hitDistance + 0.001)
+            return true;
+    return false;
 }
 
 void    EdgeItem::dragEnterEvent(QDragEnterEvent* event)
@@ -1396,4 +1756,28 @@ void    EdgeItem::dropEvent( QDropEvent* event )
 }
 //-----------------------------------------------------------------------------
 
+
+/* Delegates Pool Management *///----------------------------------------------
+void    EdgeItem::componentComplete()
+{
+    QQuickItem::componentComplete();
+    _poolState = PoolState{z(), opacity(), isEnabled(), getArrowSize(), getSrcShape(), getDstShape(),
+                           getSelectable(), getDraggable(), getAcceptDrops()};
+}
+
+void    EdgeItem::resetForPool() noexcept
+{
+    setZ(_poolState.z);
+    setOpacity(_poolState.opacity);
+    setEnabled(_poolState.enabled);
+    setArrowSize(_poolState.arrowSize);
+    setSrcShape(_poolState.srcShape);
+    setDstShape(_poolState.dstShape);
+    setSelectable(_poolState.selectable);
+    setDraggable(_poolState.draggable);
+    setAcceptDrops(_poolState.acceptDrops);
+    setDragged(false);
+}
+//-----------------------------------------------------------------------------
+
 } // ::qan
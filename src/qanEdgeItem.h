@@ -34,8 +34,12 @@
 
 #pragma once
 
+// Std headers
+#include <vector>
+
 // Qt headers
 #include <QLineF>
+#include <QPolygonF>
 
 // QuickQanava headers
 #include "./qanStyle.h"
@@ -64,16 +68,19 @@ class EdgeItem : public QQuickItem,
     Q_INTERFACES(qan::Selectable)
 public:
     explicit EdgeItem(QQuickItem* parent = nullptr);
-    virtual ~EdgeItem() override = default;
+    virtual ~EdgeItem() override;
     EdgeItem(const EdgeItem&) = delete;
 
 public:
-    Q_PROPERTY(qan::Edge* edge READ getEdge CONSTANT FINAL)
+    //! Item edge, modified only when a pooled item is reused for another edge (see qan::Graph::virtualized).
+    Q_PROPERTY(qan::Edge* edge READ getEdge NOTIFY edgeChanged FINAL)
     auto        getEdge() noexcept -> qan::Edge*;
     auto        getEdge() const noexcept -> const qan::Edge*;
     auto        setEdge(qan::Edge* edge) noexcept -> void;
 private:
     QPointer<qan::Edge>    _edge;
+signals:
+    void        edgeChanged();
 
 public:
     Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged)
@@ -112,6 +119,53 @@ signals:
 protected:
     //! Configure either a node or an edge (for hyper edges) item.
     void            configureDestinationItem(QQuickItem* item);
+
+public:
+    //! Disconnect edge from its source and destination items and reset them to nullptr (used when edge item is parked in graph delegates pool).
+    void            detachItems() noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Multi Edges Management *///--------------------------------------
+    //@{
+public:
+    /*! \brief True when edge source and destination items are the same item (read-only).
+     *
+     * Self loops are always drawn as a curved arc around source item top right corner, whatever
+     * their style line type is.
+     */
+    Q_PROPERTY(bool selfLoop READ getSelfLoop NOTIFY selfLoopChanged FINAL)
+    //! \copydoc selfLoop
+    inline bool     getSelfLoop() const noexcept { return _selfLoop; }
+private:
+    //! \copydoc selfLoop
+    bool            _selfLoop = false;
+signals:
+    //! \copydoc selfLoop
+    void            selfLoopChanged();
+
+public:
+    //! Return edge effective line type: style line type, or qan::EdgeStyle::LineType::Curved for self loops.
+    qan::EdgeStyle::LineType    getLineType() const noexcept;
+
+    /*! \brief Set this edge position in its fan of parallel edges (edges sharing the same source and destination items, in any direction).
+     *
+     * Called by qan::Graph when an edge sharing this edge ends is inserted or removed, parallel edges are
+     * then offset by qan::Graph::multiEdgeSpacing around the line between their ends centers, and self loops
+     * are nested. \c reversed is true when edge direction is reversed compared to fan canonical direction.
+     */
+    void            setFan(int index, int count, bool reversed) noexcept;
+    //! \copydoc setFan()
+    inline int      getFanIndex() const noexcept { return _fanIndex; }
+    //! \copydoc setFan()
+    inline int      getFanCount() const noexcept { return _fanCount; }
+private:
+    //! Update self loop state and register this edge in graph multi edges fans.
+    void            updateMultiEdge() noexcept;
+
+    int             _fanIndex = 0;
+    int             _fanCount = 1;
+    bool            _fanReversed = false;
     //@}
     //-------------------------------------------------------------------------
 
@@ -131,6 +185,54 @@ signals:
 private:
     bool        _hidden = false;
 
+public:
+    /*! \brief True when the edge is culled: it is outside graph cull rect and hidden (see qan::Graph::setCullRect()).
+     *
+     * Culled edges are invisible and their geometry is no longer generated: updateItem() only
+     * maintain a rough bounding rect (source and destination bounding rects union) used to restore
+     * the edge when it enter the cull rect again.
+     *
+     * Culling only restore visibility of edges that were visible when they were culled, use
+     * setItemVisible() to modify a potentially culled edge visibility.
+     */
+    Q_PROPERTY(bool culled READ getCulled NOTIFY culledChanged FINAL)
+    inline bool     getCulled() const noexcept { return _culled; }
+    virtual void    setCulled(bool culled) noexcept;
+    //! Visibility restored when edge is no longer culled (meaningless when edge is not culled).
+    inline bool     getCulledVisible() const noexcept { return _culledVisible; }
+
+    //! Set edge visibility, when edge is culled \c visible is applied when the edge is restored.
+    void            setItemVisible(bool visible) noexcept;
+private:
+    bool            _culled = false;
+    bool            _culledVisible = true;
+signals:
+    void            culledChanged();
+
+public:
+    /*! \brief True when this edge is drawn by graph edge layer instead of its own visual delegate (default to false).
+     *
+     * Batched edges are lightweight logical and hit-test items with no visual content, their geometry
+     * and arrows are rendered with all other batched edges in a few scene graph nodes by
+     * qan::EdgeLayer (see qan::Graph::batchedEdges).
+     */
+    Q_PROPERTY(bool batched READ getBatched WRITE setBatched NOTIFY batchedChanged FINAL)
+    //! \copydoc batched
+    inline bool     getBatched() const noexcept { return _batched; }
+    //! \copydoc batched
+    void            setBatched(bool batched) noexcept;
+private:
+    //! \copydoc batched
+    bool            _batched = false;
+    //! Insert (or move to its style sub batch) this edge in graph edge layer when it is batched and attached to its edge, remove it otherwise.
+    void            updateLayerBatch() noexcept;
+signals:
+    //! \copydoc batched
+    void            batchedChanged();
+protected slots:
+    //! Notify graph edge layer that this edge geometry or appearance has changed (no-op if edge is not batched).
+    void            invalidateBatchedGeometry();
+
 public:
     Q_PROPERTY(qreal arrowSize READ getArrowSize WRITE setArrowSize NOTIFY arrowSizeChanged FINAL)
     void            setArrowSize( qreal arrowSize ) noexcept;
@@ -172,6 +274,21 @@ signals:
 public slots:
     //! Call updateItem() (override updateItem() to an empty method for invisible edges).
     virtual void        updateItemSlot() { updateItem(); }
+
+    /*! \brief Schedule a coalesced updateItemSlot() call, source and destination x, y, z, width and height notify signals are connected to this slot.
+     *
+     * Scheduled edges are updated once per frame by their graph just before scene graph
+     * synchronization (see qan::Graph::updateScheduledEdges()), whatever the number of source and
+     * destination geometry changes. Edge is updated synchronously if it has no graph.
+     */
+    void                scheduleUpdateItem() noexcept;
+public:
+    //! Call updateItemSlot() if an update has been scheduled with scheduleUpdateItem().
+    void                processScheduledUpdate() noexcept;
+    //! True when an update has been scheduled with scheduleUpdateItem() and not yet processed.
+    inline bool         isUpdateScheduled() const noexcept { return _updateScheduled; }
+private:
+    bool                _updateScheduled = false;
 public:
     /*! \brief Update edge bounding box according to source and destination item actual position and size.
      *
@@ -180,6 +297,25 @@ public:
      */
     virtual void        updateItem() noexcept;
 
+    /*! \brief Update \c edgeItems geometry in one pass, with data only geometry generation running in parallel.
+     *
+     * Geometry is generated in three stages: source and destination bounding shapes and routes are
+     * collected in GUI thread, edges ends, control points and arrows are then generated from these flat
+     * geometry caches on \c threadCount threads, final geometry is finally applied to items in GUI thread.
+     *
+     * \note Items scheduled with scheduleUpdateItem() are no longer scheduled. updateItem() and updateItemSlot()
+     * overrides are not called, only items where isConcurrentUpdateEnabled() is true should be updated with this method.
+     */
+    static void         updateItems(const std::vector<QPointer<qan::EdgeItem>>& edgeItems, int threadCount) noexcept;
+
+    /*! \brief Return true if this edge geometry could be updated with updateItems() instead of updateItemSlot().
+     *
+     * Default implementation return true only for qan::EdgeItem instances (including QML delegates), C++ sub classes
+     * might override updateItem() or updateItemSlot() and are always updated with updateItemSlot().
+     * \note Override to return true in a sub class that does not override updateItem() or updateItemSlot().
+     */
+    virtual bool        isConcurrentUpdateEnabled() const noexcept;
+
 protected:
      /*! Cache current edge geometry state.
       *
@@ -217,6 +353,24 @@ protected:
 
         QPointF c1, c2;
 
+        //! Routed ortho edge polyline from p1 to p2 (empty for non routed edges).
+        QPolygonF   orthoPath;
+        //! True when ortho ends and path have been generated by graph ortho router.
+        bool        routed = false;
+
+        //! Parallel edges fan offset applied to line ends (see setFan()).
+        QPointF     fanOffset;
+        //! Index of this edge in its fan (self loop index for self loops).
+        int         fanIndex = 0;
+        //! Graph multi edge spacing (see qan::Graph::multiEdgeSpacing).
+        qreal       fanSpacing = 12.;
+        bool        selfLoop = false;
+
+        //! Edge line flattened to a polyline from p1 to p2 (see generatePath()).
+        QPolygonF           path;
+        //! Cumulative arc length at each path vertex.
+        std::vector<qreal>  pathLengths;
+
         QPointF labelPosition;
     };
     inline GeometryCache    generateGeometryCache() const noexcept;
@@ -227,6 +381,13 @@ protected:
     //! \brief Generate P1 and P2 for ortho edge style.
     void                    generateOrthoEnds(GeometryCache& cache) const noexcept;
 
+    /*! \brief Generate P1, P2 and ortho path using graph ortho router.
+     *
+     * \return false if graph ortho routing is disabled or if no route could be found, geometry
+     * should then be generated with generateOrthoEnds().
+     */
+    bool                    generateRoutedOrthoEnds(GeometryCache& cache) noexcept;
+
     /*! \brief FIXME
      *
      * \note Line geometry may (cache.p1 and cache.p2) could be modified to fit arrow geometry.
@@ -238,21 +399,39 @@ protected:
                                                        const qan::EdgeStyle::ArrowShape arrowShape,
                                                        const qreal arrowLength) const noexcept;
 
-    //! Generate arrow angle for a curved edge points.
-    inline qreal            generateCurvedArrowAngle(QPointF& p1, QPointF& p2,
-                                                     const QPointF& c1, const QPointF& c2,
-                                                     const qan::EdgeStyle::ArrowShape arrowShape,
-                                                     const qreal arrowLength) const noexcept;
-
     //! Generate edge line control points when edge has curved style (GeometryCache::c1 and GeometryCache::c2).
     inline void             generateCurvedControlPoints(GeometryCache& cache) const noexcept;
 
+    //! Generate self loop P1, P2, C1 and C2: an arc around source top right corner, nested according to loop fan index.
+    void                    generateSelfLoopGeometry(GeometryCache& cache) const noexcept;
+
+    /*! \brief Flatten edge line to GeometryCache::path and generate its arc lengths.
+     *
+     * Curved edges are flattened with an adaptive subdivision of the cubic curve: segments are
+     * subdivided until their control points are within a fraction of pixel of their chord.
+     * Path is generated before arrow geometry, that trims its ends to fit arrows.
+     */
+    void                    generatePath(GeometryCache& cache) const noexcept;
+
     //! Generate edge line label position.
     inline void             generateLabelPosition(GeometryCache& cache) const noexcept;
 
     //! Apply a final valid geometry cache to this.
     inline void             applyGeometry(const GeometryCache& cache) noexcept;
 
+    /*! \brief GUI thread geometry stage: update culled edge rough geometry or generate routed ortho ends.
+     *
+     * \return false if no further geometry should be generated for \c cache (edge is culled).
+     */
+    bool                    prepareGeometry(GeometryCache& cache) noexcept;
+    /*! \brief Data only geometry stage: generate ends, control points, arrows and label position.
+     *
+     * \note Only read \c cache and this edge immutable configuration, could be called concurrently for different edges.
+     */
+    void                    generateGeometry(GeometryCache& cache) const noexcept;
+    //! GUI thread geometry stage: apply \c cache or hide edge if \c cache is invalid.
+    void                    commitGeometry(const GeometryCache& cache) noexcept;
+
     /*! Return line angle on line \c line.
      *
      * \return angle in degree or a value < 0.0 if an error occurs.
@@ -289,6 +468,11 @@ public:
     Q_PROPERTY(QPointF c2 READ getC2() NOTIFY controlPointsChanged FINAL)
     //! \copydoc c2
     inline  auto    getC2() const noexcept -> const QPointF& { return _c2; }
+public:
+    //! Ortho edge polyline in item CS from p1 to p2 (p1, c1, p2 when edge is not routed around nodes).
+    Q_PROPERTY(QPolygonF orthoPath READ getOrthoPath NOTIFY controlPointsChanged FINAL)
+    //! \copydoc orthoPath
+    inline  auto    getOrthoPath() const noexcept -> const QPolygonF& { return _orthoPath; }
 signals:
     //! \copydoc c1
     void            controlPointsChanged();
@@ -297,6 +481,8 @@ private:
     QPointF         _c1;
     //! \copydoc c2
     QPointF         _c2;
+    //! \copydoc orthoPath
+    QPolygonF       _orthoPath;
 
 protected:
     /*! Return cubic curve angle at position \c pos between [0.; 1.] on curve defined by \c start, \c end and controls points \c c1 and \c c2.
@@ -378,6 +564,41 @@ signals:
     //@}
     //-------------------------------------------------------------------------
 
+    /*! \name Flattened Path Management *///-----------------------------------
+    //@{
+public:
+    /*! \brief Edge line flattened to a polyline in item CS from p1 to p2.
+     *
+     * Path is generated once per geometry update and shared by rendering, hit testing (see
+     * contains()), straight and ortho edges label position and arrows orientation. Path ends are trimmed to fit arrows.
+     */
+    Q_PROPERTY(QPolygonF path READ getPath NOTIFY pathChanged FINAL)
+    //! \copydoc path
+    inline  auto    getPath() const noexcept -> const QPolygonF& { return _path; }
+    //! Edge path arc length.
+    Q_PROPERTY(qreal pathLength READ getPathLength NOTIFY pathChanged FINAL)
+    //! \copydoc pathLength
+    inline  auto    getPathLength() const noexcept -> qreal { return _pathLengths.empty() ? 0. : _pathLengths.back(); }
+
+    //! Return point on path at \c percent of its arc length, \c percent in [0.; 1.].
+    Q_INVOKABLE QPointF pointAtPercent(qreal percent) const noexcept;
+    //! Return path angle in degree at \c percent of its arc length, \c percent in [0.; 1.].
+    Q_INVOKABLE qreal   angleAtPercent(qreal percent) const noexcept;
+signals:
+    //! \copydoc path
+    void            pathChanged();
+private:
+    //! \copydoc path
+    QPolygonF           _path;
+    //! Cumulative arc length at each \c _path vertex.
+    std::vector<qreal>  _pathLengths;
+    //! \c _path tight bounding rect.
+    QRectF              _pathBr;
+    //! Set \c _path and its arc lengths \c pathLengths, update path bounding rect.
+    void                setPath(QPolygonF path, std::vector<qreal> pathLengths) noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
     /*! \name Mouse Management *///--------------------------------------------
     //@{
 protected:
@@ -511,10 +732,15 @@ private:
 signals:
     void            acceptDropsChanged();
 
-protected:
-    //! Return true if point is actually on the edge (not only in edge bounding rect).
+public:
+    //! Maximum distance between a point and edge line for contains() to return true.
+    static constexpr qreal  hitDistance = 6.;
+
+    //! Return true if point is actually on the edge flattened path (not only in edge bounding rect), within \c hitDistance.
     virtual bool    contains(const QPointF& point) const override;
 
+protected:
+
     /*! \brief Internally used to manage drag and drop over nodes, override with caution, and call base class implementation.
      *
      * Drag enter event are not restricted to the edge bounding rect but to the edge line with a distance delta, computing
@@ -529,6 +755,35 @@ protected:
     virtual void    dropEvent(QDropEvent* event) override;
     //@}
     //-------------------------------------------------------------------------
+
+    /*! \name Delegates Pool Management *///-----------------------------------
+    //@{
+protected:
+    //! Save item delegate default z and flags, restored by resetForPool().
+    virtual void    componentComplete() override;
+
+public:
+    /*! \brief Restore item delegate default z and flags, called when item is parked in graph delegates pool.
+     *
+     * \sa qan::Graph::delegatesPoolCapacity
+     */
+    virtual void    resetForPool() noexcept;
+private:
+    struct PoolState {
+        qreal       z = 0.;
+        qreal       opacity = 1.;
+        bool        enabled = true;
+        qreal       arrowSize = 4.;
+        ArrowShape  srcShape = ArrowShape::None;
+        ArrowShape  dstShape = ArrowShape::Arrow;
+        bool        selectable = true;
+        bool        draggable = true;
+        bool        acceptDrops = true;
+    };
+    //! Delegate default state, saved on component completion.
+    PoolState       _poolState;
+    //@}
+    //-------------------------------------------------------------------------
 };
 
 } // ::qan
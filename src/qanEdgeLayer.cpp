@@ -0,0 +1,930 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanEdgeLayer.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <thread>
+#include <vector>
+
+// Qt headers
+#include <QtMath>
+#include <QLineF>
+#include <QSGNode>
+#include <QSGGeometryNode>
+#include <QSGFlatColorMaterial>
+#include <QQuickWindow>
+
+// QuickQanava headers
+#include "./qanEdgeLayer.h"
+#ifdef QUICK_QANAVA_EDGE_EFFECTS
+#include "./qanEdgeEffectMaterial.h"
+#endif
+#include "./qanEdgeItem.h"
+#include "./qanGraph.h"
+#include "./qanGroup.h"
+#include "./qanGroupItem.h"
+
+namespace qan { // ::qan
+
+/* EdgeLayer Object Management *///--------------------------------------------
+EdgeLayer::EdgeLayer(QQuickItem* parent) :
+    QQuickItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+    _effectsClock.start();
+}
+
+void    EdgeLayer::setGraph(qan::Graph* graph) noexcept
+{
+    if (graph == _graph)
+        return;
+    if (_graph)
+        disconnect(_graph.data(), nullptr, this, nullptr);
+    _graph = graph;
+    if (_graph)
+        connect(_graph.data(),  &qan::Graph::selectionColorChanged,
+                this,           &qan::EdgeLayer::invalidateSelection);
+    invalidate();
+    emit graphChanged();
+}
+//-----------------------------------------------------------------------------
+
+
+/* Rendering Management *///---------------------------------------------------
+void    EdgeLayer::invalidate()
+{
+    _allDirty = true;
+    _selectionDirty = true;
+    if (_bundled)
+        invalidateBundles();
+    update();
+}
+
+void    EdgeLayer::invalidateStyle(const qan::EdgeStyle* style)
+{
+    _dirtyStyles.insert(style);
+    _selectionDirty = true;     // Note: selection hilight geometry follow edges geometry
+    update();
+}
+
+void    EdgeLayer::invalidateEdge(const qan::EdgeItem& edgeItem)
+{
+    _dirtyEdges.insert(&edgeItem);
+    _selectionDirty = true;     // Note: selection hilight geometry follow edges geometry
+    if (_bundled)               // Note: Groups geometry might have changed, modified bundles are detected in updatePolish()
+        invalidateBundles();
+    update();
+}
+
+void    EdgeLayer::insertEdge(const qan::EdgeItem& edgeItem)
+{
+    _insertedEdges.insert(&edgeItem);
+    _selectionDirty = true;
+    if (_bundled)
+        invalidateBundles();
+    update();
+}
+
+void    EdgeLayer::removeEdge(const qan::EdgeItem& edgeItem)
+{
+    _insertedEdges.erase(&edgeItem);
+    _dirtyEdges.erase(&edgeItem);
+    _removedEdges.insert(&edgeItem);
+    _selectionDirty = true;
+    if (_bundled)
+        invalidateBundles();
+    update();
+}
+
+void    EdgeLayer::invalidateSelection()
+{
+    _selectionDirty = true;
+    update();
+}
+
+void    EdgeLayer::onStyleModified()
+{
+    invalidateStyle(qobject_cast<const qan::EdgeStyle*>(sender()));
+}
+
+using Vertices = std::vector<QSGGeometry::Point2D>;
+
+static inline void  appendVertex(Vertices& vertices, const QPointF& p)
+{
+    QSGGeometry::Point2D v;
+    v.set(static_cast<float>(p.x()), static_cast<float>(p.y()));
+    vertices.push_back(v);
+}
+
+static inline void  appendTriangle(Vertices& vertices, const QPointF& a, const QPointF& b, const QPointF& c)
+{
+    appendVertex(vertices, a);
+    appendVertex(vertices, b);
+    appendVertex(vertices, c);
+}
+
+//! Append a \c width thick quad from \c a to \c b, eventually extended by \c extA before a and \c extB after b.
+static void appendSegment(Vertices& vertices, const QPointF& a, const QPointF& b,
+                          qreal width, qreal extA = 0., qreal extB = 0.)
+{
+    const auto d = b - a;
+    const auto length = std::sqrt(QPointF::dotProduct(d, d));
+    if (length < 0.0001)
+        return;
+    const QPointF u{d / length};
+    const QPointF n{-u.y() * width / 2., u.x() * width / 2.};
+    const auto a2 = a - u * extA;
+    const auto b2 = b + u * extB;
+    appendTriangle(vertices, a2 + n, b2 + n, a2 - n);
+    appendTriangle(vertices, a2 - n, b2 + n, b2 - n);
+}
+
+//! Append \c polyline stroke, interior joints are filled by extending segments by half width.
+static void appendPolyline(Vertices& vertices, const std::vector<QPointF>& polyline, qreal width)
+{
+    const auto count = polyline.size();
+    for (std::size_t s = 0; s + 1 < count; s++)
+        appendSegment(vertices, polyline[s], polyline[s + 1], width,
+                      s > 0 ? width / 2. : 0., s + 2 < count ? width / 2. : 0.);
+}
+
+/*! \brief Append \c polyline stroke using a Qt dash \c pattern (dash and space lengths in \c width units).
+ *
+ * Pattern unit is clamped so that a full pattern is at least 4 pixels long, thin lines would
+ * otherwise generate a huge number of dashes.
+ */
+static void appendDashedPolyline(Vertices& vertices, const std::vector<QPointF>& polyline,
+                                 qreal width, const QVector<qreal>& pattern)
+{
+    // PRECONDITIONS:
+        // width must be > 0.
+    if (width <= 0.)
+        return;
+    // Algorithm:
+    // 1. Walk polyline segments, consuming current pattern entry length.
+    // 2. Emit a segment for dash entries (even index) and skip space entries (odd index).
+    constexpr qreal minimumPatternLength = 4.;
+    qreal patternLength = 0.;
+    for (const auto l : pattern)
+        patternLength += std::max(0., l);
+    if (pattern.size() < 2 ||
+        patternLength <= 0.) {
+        appendPolyline(vertices, polyline, width);
+        return;
+    }
+    const auto unit = std::max(width, minimumPatternLength / patternLength);
+    int     entry = 0;
+    qreal   remaining = std::max(0., pattern.at(0)) * unit;
+    for (std::size_t s = 0; s + 1 < polyline.size(); s++) {
+        auto a = polyline[s];
+        const auto& b = polyline[s + 1];
+        auto segmentLength = QLineF{a, b}.length();
+        while (segmentLength > 0.) {        // 1.
+            const auto step = std::min(remaining, segmentLength);
+            const auto p = a + (b - a) * (step / segmentLength);
+            if (entry % 2 == 0)             // 2.
+                appendSegment(vertices, a, p, width);
+            a = p;
+            segmentLength -= step;
+            remaining -= step;
+            if (remaining <= 0.) {
+                entry = (entry + 1) % pattern.size();
+                remaining = std::max(0., pattern.at(entry)) * unit;
+            }
+        }
+    }
+}
+
+#ifdef QUICK_QANAVA_EDGE_EFFECTS
+using EffectVertices = std::vector<QSGGeometry::TexturedPoint2D>;
+
+static inline void  appendEffectVertex(EffectVertices& vertices, const QPointF& p, qreal arc, qreal across)
+{
+    QSGGeometry::TexturedPoint2D v;
+    v.set(static_cast<float>(p.x()), static_cast<float>(p.y()),
+          static_cast<float>(arc), static_cast<float>(across));
+    vertices.push_back(v);
+}
+
+/*! \brief Append \c polyline stroke with effect coordinates (see qan::EdgeEffectMaterial).
+ *
+ * Interior joints are filled by extending segments by half width, extensions arc length is
+ * extrapolated from their segment.
+ */
+static void appendEffectPolyline(EffectVertices& vertices, const std::vector<QPointF>& polyline, qreal width)
+{
+    const auto count = polyline.size();
+    qreal arc = 0.;
+    for (std::size_t s = 0; s + 1 < count; s++) {
+        const auto d = polyline[s + 1] - polyline[s];
+        const auto length = std::sqrt(QPointF::dotProduct(d, d));
+        if (length < 0.0001)
+            continue;
+        const auto extA = s > 0 ? width / 2. : 0.;
+        const auto extB = s + 2 < count ? width / 2. : 0.;
+        const QPointF u{d / length};
+        const QPointF n{-u.y() * width / 2., u.x() * width / 2.};
+        const auto a = polyline[s] - u * extA;
+        const auto b = polyline[s + 1] + u * extB;
+        const auto arcA = arc - extA;
+        const auto arcB = arc + length + extB;
+        appendEffectVertex(vertices, a + n, arcA, 1.);
+        appendEffectVertex(vertices, b + n, arcB, 1.);
+        appendEffectVertex(vertices, a - n, arcA, -1.);
+        appendEffectVertex(vertices, a - n, arcA, -1.);
+        appendEffectVertex(vertices, b + n, arcB, 1.);
+        appendEffectVertex(vertices, b - n, arcB, -1.);
+        arc += length;
+    }
+}
+
+//! Copy \c edgeItem flattened path (see qan::EdgeItem::path) to \c polyline in graph container CS.
+static void flattenEdge(const qan::EdgeItem& edgeItem, std::vector<QPointF>& polyline)
+{
+    polyline.clear();
+    const auto offset = edgeItem.position();    // Edge items are direct children of graph container item
+    const auto& path = edgeItem.getPath();
+    polyline.reserve(path.size());
+    for (const auto& p : path)
+        polyline.push_back(offset + p);
+}
+
+//! Append an edge end \c shape defined in a local CS at \c origin rotated by \c angle degrees (see qan::EdgeItem::dstA1).
+static void appendEdgeEnd(Vertices& vertices, qan::EdgeStyle::ArrowShape shape,
+                          const QPointF& origin, qreal angle,
+                          const QPointF& a1, const QPointF& a2, const QPointF& a3,
+                          qreal lineWidth, std::vector<QPointF>& outline)
+{
+    using ArrowShape = qan::EdgeStyle::ArrowShape;
+    if (shape == ArrowShape::None)
+        return;
+    const auto radians = qDegreesToRadians(angle);
+    const auto cosA = std::cos(radians);
+    const auto sinA = std::sin(radians);
+    const auto map = [&](const QPointF& p) -> QPointF {
+        return QPointF{origin.x() + p.x() * cosA - p.y() * sinA,
+                       origin.y() + p.x() * sinA + p.y() * cosA};
+    };
+    outline.clear();
+    switch (shape) {
+    case ArrowShape::Arrow:
+    case ArrowShape::ArrowOpen:
+        outline = {map(a1), map(a2), map(a3)};
+        break;
+    case ArrowShape::Rect:
+    case ArrowShape::RectOpen:
+        outline = {map(a1), map(QPointF{0., 0.}), map(a3), map(a2)};
+        break;
+    case ArrowShape::Circle:
+    case ArrowShape::CircleOpen: {
+        constexpr int   segments = 16;
+        constexpr qreal twoPi = 6.283185307179586;
+        const auto center = a2 / 2.;
+        const auto radius = a1.x();
+        for (int s = 0; s < segments; s++) {
+            const auto t = twoPi * s / segments;
+            outline.push_back(map(center + QPointF{radius * std::cos(t), radius * std::sin(t)}));
+        }
+    } break;
+    case ArrowShape::None:
+        return;
+    }
+    const auto open = shape == ArrowShape::ArrowOpen ||
+                      shape == ArrowShape::RectOpen ||
+                      shape == ArrowShape::CircleOpen;
+    if (open) {
+        outline.push_back(outline.front());     // Close outline
+        appendPolyline(vertices, outline, lineWidth);
+    } else {
+        for (std::size_t p = 1; p + 1 < outline.size(); p++)   // Shapes are convex, fill with a fan
+            appendTriangle(vertices, outline[0], outline[p], outline[p + 1]);
+    }
+}
+
+//! Return \c a to \c b angle in degrees (see qan::EdgeItem::lineAngle()).
+static inline qreal segmentAngle(const QPointF& a, const QPointF& b)
+{
+    const auto angle = qRadiansToDegrees(std::atan2(b.y() - a.y(), b.x() - a.x()));
+    return angle < 0. ? angle + 360. : angle;
+}
+
+//! Append \c edgeItem ends triangles, oriented along \c polyline ends when \c bundled is true.
+static void appendEdgeEnds(Vertices& vertices, const qan::EdgeItem& edgeItem, qreal lineWidth,
+                           const std::vector<QPointF>& polyline, std::vector<QPointF>& outline, bool bundled)
+{
+    const auto offset = edgeItem.position();
+    const auto count = polyline.size();
+    const auto dstAngle = bundled ? segmentAngle(polyline[count - 2], polyline[count - 1]) : edgeItem.getDstAngle();
+    const auto srcAngle = bundled ? segmentAngle(polyline[1], polyline[0]) : edgeItem.getSrcAngle();
+    appendEdgeEnd(vertices, edgeItem.getDstShape(), offset + edgeItem.getP2(), dstAngle,
+                  edgeItem.getDstA1(), edgeItem.getDstA2(), edgeItem.getDstA3(), lineWidth, outline);
+    appendEdgeEnd(vertices, edgeItem.getSrcShape(), offset + edgeItem.getP1(), srcAngle,
+                  edgeItem.getSrcA1(), edgeItem.getSrcA2(), edgeItem.getSrcA3(), lineWidth, outline);
+}
+
+/*! \brief Append \c edgeItem line and ends triangles, ends are omitted when \c withEnds is false.
+ *
+ * When \c bundled is true, \c polyline already contains edge bundled line and ends are oriented along
+ * \c polyline ends, otherwise \c polyline is generated from \c edgeItem geometry.
+ */
+static void appendEdge(Vertices& vertices, const qan::EdgeItem& edgeItem, qreal lineWidth, bool withEnds,
+                       std::vector<QPointF>& polyline, std::vector<QPointF>& outline, bool bundled = false)
+{
+    const auto style = edgeItem.getStyle();
+    if (!bundled)
+        flattenEdge(edgeItem, polyline);
+    if (withEnds &&
+        style != nullptr &&
+        style->getDashed())
+        appendDashedPolyline(vertices, polyline, lineWidth, style->getDashPattern());
+    else
+        appendPolyline(vertices, polyline, lineWidth);
+    if (withEnds)
+        appendEdgeEnds(vertices, edgeItem, lineWidth, polyline, outline, bundled);
+}
+
+/*! \brief Append \c edgeItem line and ends triangles with effect coordinates (see qan::EdgeEffectMaterial).
+ *
+ * Line is never dashed on CPU, dashes are drawn by material for qan::EdgeStyle::EffectType::EffectDash.
+ */
+static void appendEffectEdge(EffectVertices& vertices, const qan::EdgeItem& edgeItem, qreal lineWidth,
+                             std::vector<QPointF>& polyline, std::vector<QPointF>& outline,
+                             Vertices& ends, bool bundled = false)
+{
+    if (!bundled)
+        flattenEdge(edgeItem, polyline);
+    appendEffectPolyline(vertices, polyline, lineWidth);
+    ends.clear();
+    appendEdgeEnds(ends, edgeItem, lineWidth, polyline, outline, bundled);
+    for (const auto& end : ends) {
+        QSGGeometry::TexturedPoint2D v;
+        v.set(end.x, end.y, 0.f, 2.f);     // Ends are out of line, see qan::EdgeEffectMaterial
+        vertices.push_back(v);
+    }
+}
+#endif
+
+//! Create a flat color geometry node, or an animated effect node when \c effect is true (see qan::EdgeEffectMaterial).
+static QSGGeometryNode* createGeometryNode(bool effect = false)
+{
+    auto geometry = new QSGGeometry{effect ? QSGGeometry::defaultAttributes_TexturedPoint2D() :
+                                             QSGGeometry::defaultAttributes_Point2D(), 0};
+    geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+    geometry->setVertexDataPattern(QSGGeometry::DynamicPattern);
+    auto node = new QSGGeometryNode{};
+    node->setGeometry(geometry);
+    node->setFlag(QSGNode::OwnsGeometry);
+#ifdef QUICK_QANAVA_EDGE_EFFECTS
+    if (effect)
+        node->setMaterial(new qan::EdgeEffectMaterial{});
+    else
+#endif
+        node->setMaterial(new QSGFlatColorMaterial{});
+    node->setFlag(QSGNode::OwnsMaterial);
+    return node;
+}
+
+#ifdef QUICK_QANAVA_EDGE_EFFECTS
+static inline auto  getEffectMaterial(QSGNode* node) -> qan::EdgeEffectMaterial*
+{
+    return dynamic_cast<qan::EdgeEffectMaterial*>(static_cast<QSGGeometryNode*>(node)->material());
+}
+#endif
+
+//! Return true if \c node is drawn with an animated effect material.
+static inline bool  isEffectNode(QSGNode* node)
+{
+#ifdef QUICK_QANAVA_EDGE_EFFECTS
+    return getEffectMaterial(node) != nullptr;
+#else
+    Q_UNUSED(node)
+    return false;
+#endif
+}
+
+//! Return true if \c style edges are drawn with an animated effect, always false when QuickQanava is built without Qt ShaderTools.
+static inline bool  isEffectStyle(const qan::EdgeStyle* style)
+{
+#ifdef QUICK_QANAVA_EDGE_EFFECTS
+    return style != nullptr &&
+           style->getEffectType() != qan::EdgeStyle::EffectType::EffectNone;
+#else
+    Q_UNUSED(style)
+    return false;
+#endif
+}
+
+static void updateGeometryNode(QSGGeometryNode& node, const Vertices& vertices, const QColor& color)
+{
+    auto geometry = node.geometry();
+    geometry->allocate(static_cast<int>(vertices.size()));
+    if (!vertices.empty())
+        std::memcpy(geometry->vertexDataAsPoint2D(), vertices.data(),
+                    vertices.size() * sizeof(QSGGeometry::Point2D));
+    node.markDirty(QSGNode::DirtyGeometry);
+    auto material = static_cast<QSGFlatColorMaterial*>(node.material());
+    if (material->color() != color) {
+        material->setColor(color);
+        node.markDirty(QSGNode::DirtyMaterial);
+    }
+}
+
+#ifdef QUICK_QANAVA_EDGE_EFFECTS
+static void updateEffectNode(QSGGeometryNode& node, const EffectVertices& vertices, const qan::EdgeStyle& style)
+{
+    auto geometry = node.geometry();
+    geometry->allocate(static_cast<int>(vertices.size()));
+    if (!vertices.empty())
+        std::memcpy(geometry->vertexDataAsTexturedPoint2D(), vertices.data(),
+                    vertices.size() * sizeof(QSGGeometry::TexturedPoint2D));
+    node.markDirty(QSGNode::DirtyGeometry);
+    auto material = static_cast<qan::EdgeEffectMaterial*>(node.material());
+    if (material->setStyle(style))
+        node.markDirty(QSGNode::DirtyMaterial);
+}
+#endif
+
+//! Return true if batched \c edgeItem must be drawn.
+static inline bool  isEdgeDrawn(const qan::EdgeItem& edgeItem)
+{
+    return edgeItem.isVisible() &&
+           !edgeItem.getHidden();
+}
+
+QSGNode*    EdgeLayer::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data)
+    if (!_graph) {
+        delete oldNode;
+        _batches.clear();
+        _edgeBatches.clear();
+        _animated = false;
+        return nullptr;
+    }
+    // Algorithm:
+    // 1. Create root node with a selection hilight geometry node (first child, drawn below edges).
+    // 2. When all layer is dirty, dispatch batched edges in sub batches of at most batchCapacity
+    //    edges sharing the same style, existing geometry nodes are reused. Otherwise, remove removed
+    //    edges from their sub batch, insert inserted edges in a sub batch of their style, and mark
+    //    modified sub batches, sub batches of dirty styles and of dirty edges as dirty.
+    // 3. Regenerate dirty sub batches geometry nodes, empty sub batches nodes are released.
+    // 4. Regenerate selection hilight from graph selected edges.
+    // 5. Update animated effects time, next frame is scheduled from onFrameSwapped() while there
+    //    are animated batches.
+    auto root = oldNode;
+    // 1.
+    if (root == nullptr) {
+        root = new QSGNode{};
+        root->appendChildNode(createGeometryNode());
+        _batches.clear();
+        _edgeBatches.clear();
+        _allDirty = _selectionDirty = true;
+    }
+    if (!_allDirty &&
+        !_selectionDirty &&
+        _dirtyStyles.empty() &&
+        _dirtyEdges.empty() &&
+        _insertedEdges.empty() &&
+        _removedEdges.empty()) {
+        _animated = updateEffectsTime();     // 5.
+        return root;
+    }
+
+    // 2.
+    if (_allDirty) {
+        std::vector<QSGGeometryNode*> nodes;
+        nodes.reserve(_batches.size());
+        for (const auto& batch : _batches)
+            if (batch.node != nullptr)
+                nodes.push_back(batch.node);
+        _batches.clear();
+        _edgeBatches.clear();
+        std::unordered_map<const qan::EdgeStyle*, std::size_t> styleBatches;   // Last sub batch of every style
+        for (const auto edge : _graph->get_edges()) {
+            const auto edgeItem = edge != nullptr ? edge->getItem() : nullptr;
+            if (edgeItem == nullptr ||
+                !edgeItem->getBatched())
+                continue;
+            const auto batchIndex = dispatchEdge(*edgeItem, styleBatches);
+            if (_batches[batchIndex].node == nullptr &&
+                batchIndex < nodes.size())                  // Reuse existing nodes
+                _batches[batchIndex].node = nodes[batchIndex];
+        }
+        for (auto n = _batches.size(); n < nodes.size(); n++) {     // Remove unused nodes
+            root->removeChildNode(nodes[n]);
+            delete nodes[n];
+        }
+    } else {
+        for (const auto edgeItem : _removedEdges)   // Note: removed edges are never dereferenced
+            removeBatchedEdge(edgeItem);
+        if (!_insertedEdges.empty()) {
+            std::unordered_map<const qan::EdgeStyle*, std::size_t> styleBatches;   // Non full sub batch of every style
+            for (std::size_t b = 0; b < _batches.size(); b++)
+                if (_batches[b].edgeItems.size() < batchCapacity)
+                    styleBatches.insert_or_assign(_batches[b].style, b);
+            for (const auto edgeItem : _insertedEdges) {
+                const auto edgeBatch = _edgeBatches.find(edgeItem);
+                if (edgeBatch != _edgeBatches.end()) {
+                    if (_batches[edgeBatch->second].style == edgeItem->getStyle())
+                        continue;                   // Already batched with its actual style
+                    removeBatchedEdge(edgeItem);    // Style changed, move edge to a new style sub batch
+                }
+                if (edgeItem->getBatched())
+                    dispatchEdge(*edgeItem, styleBatches);
+            }
+        }
+        if (!_dirtyStyles.empty())
+            for (auto& batch : _batches)
+                if (_dirtyStyles.find(batch.style) != _dirtyStyles.end())
+                    batch.dirty = true;
+        for (const auto edgeItem : _dirtyEdges) {   // Note: dirty edges are never dereferenced
+            const auto edgeBatch = _edgeBatches.find(edgeItem);
+            if (edgeBatch != _edgeBatches.end())
+                _batches[edgeBatch->second].dirty = true;
+        }
+    }
+    _allDirty = false;
+    _dirtyStyles.clear();
+    _dirtyEdges.clear();
+    _insertedEdges.clear();
+    _removedEdges.clear();
+
+    // 3.
+    Vertices vertices;
+#ifdef QUICK_QANAVA_EDGE_EFFECTS
+    EffectVertices effectVertices;
+    Vertices ends;
+#endif
+    std::vector<QPointF> polyline;
+    std::vector<QPointF> outline;
+    for (auto& batch : _batches) {
+        if (!batch.dirty)
+            continue;
+        batch.dirty = false;
+        if (batch.edgeItems.empty()) {  // Note: empty sub batch style might have been destroyed, never dereference it
+            if (batch.node != nullptr) {
+                root->removeChildNode(batch.node);
+                delete batch.node;
+                batch.node = nullptr;
+            }
+            continue;
+        }
+        const auto style = batch.style;
+        const auto effect = isEffectStyle(style);
+        if (batch.node != nullptr &&
+            isEffectNode(batch.node) != effect) {     // Effect toggled, material must change
+            root->removeChildNode(batch.node);
+            delete batch.node;
+            batch.node = nullptr;
+        }
+        if (batch.node == nullptr) {
+            batch.node = createGeometryNode(effect);
+            root->appendChildNode(batch.node);
+        }
+        const auto lineWidth = style != nullptr ? style->getLineWidth() : 2.;
+#ifdef QUICK_QANAVA_EDGE_EFFECTS
+        if (effect) {
+            effectVertices.clear();
+            for (const auto edgeItem : batch.edgeItems)
+                if (isEdgeDrawn(*edgeItem))
+                    appendEffectEdge(effectVertices, *edgeItem, lineWidth, polyline, outline, ends,
+                                     getBundledPolyline(*edgeItem, polyline));
+            updateEffectNode(*batch.node, effectVertices, *style);
+            continue;
+        }
+#endif
+        vertices.clear();
+        for (const auto edgeItem : batch.edgeItems)
+            if (isEdgeDrawn(*edgeItem))
+                appendEdge(vertices, *edgeItem, lineWidth, true, polyline, outline,
+                           getBundledPolyline(*edgeItem, polyline));
+        updateGeometryNode(*batch.node, vertices,
+                           style != nullptr ? style->getLineColor() : QColor{Qt::black});
+    }
+
+    // 4.
+    if (_selectionDirty) {
+        vertices.clear();
+        for (const auto& edge : _graph->getSelectedEdges()) {
+            const auto edgeItem = edge ? edge->getItem() : nullptr;
+            if (edgeItem == nullptr ||
+                !edgeItem->getBatched() ||
+                !isEdgeDrawn(*edgeItem))
+                continue;
+            const auto style = edgeItem->getStyle();
+            appendEdge(vertices, *edgeItem, (style != nullptr ? style->getLineWidth() : 2.) + 2.,
+                       false, polyline, outline, getBundledPolyline(*edgeItem, polyline));
+        }
+        updateGeometryNode(*static_cast<QSGGeometryNode*>(root->firstChild()), vertices,
+                           _graph->getSelectionColor());
+        _selectionDirty = false;
+    }
+    _animated = updateEffectsTime();         // 5.
+    return root;
+}
+
+std::size_t EdgeLayer::dispatchEdge(const qan::EdgeItem& edgeItem,
+                                    std::unordered_map<const qan::EdgeStyle*, std::size_t>& styleBatches)
+{
+    const auto style = edgeItem.getStyle();
+    auto styleBatch = styleBatches.find(style);
+    if (styleBatch == styleBatches.end() ||
+        _batches[styleBatch->second].style != style ||      // Note: an empty sub batch might have been reused for another style
+        _batches[styleBatch->second].edgeItems.size() >= batchCapacity) {
+        if (style != nullptr)
+            connect(style,  &qan::EdgeStyle::styleModified,
+                    this,   &qan::EdgeLayer::onStyleModified, Qt::UniqueConnection);
+        auto batchIt = std::find_if(_batches.begin(), _batches.end(),
+                                    [](const auto& batch) { return batch.edgeItems.empty(); });
+        if (batchIt == _batches.end()) {
+            _batches.emplace_back();
+            batchIt = std::prev(_batches.end());
+            batchIt->edgeItems.reserve(batchCapacity);
+        }
+        batchIt->style = style;
+        styleBatch = styleBatches.insert_or_assign(style, static_cast<std::size_t>(batchIt - _batches.begin())).first;
+    }
+    auto& batch = _batches[styleBatch->second];
+    batch.edgeItems.push_back(&edgeItem);
+    batch.dirty = true;
+    _edgeBatches.insert_or_assign(&edgeItem, styleBatch->second);
+    return styleBatch->second;
+}
+
+void    EdgeLayer::removeBatchedEdge(const qan::EdgeItem* edgeItem)
+{
+    const auto edgeBatch = _edgeBatches.find(edgeItem);
+    if (edgeBatch == _edgeBatches.end())
+        return;
+    auto& batch = _batches[edgeBatch->second];
+    const auto edgeIt = std::find(batch.edgeItems.begin(), batch.edgeItems.end(), edgeItem);
+    if (edgeIt != batch.edgeItems.end()) {      // Note: edges order in a sub batch is irrelevant
+        *edgeIt = batch.edgeItems.back();
+        batch.edgeItems.pop_back();
+    }
+    batch.dirty = true;
+    _edgeBatches.erase(edgeBatch);
+}
+
+bool    EdgeLayer::updateEffectsTime()
+{
+#ifndef QUICK_QANAVA_EDGE_EFFECTS
+    return false;   // Note: QuickQanava built without Qt ShaderTools, there is no animated batch
+#else
+    const auto time = static_cast<float>(_effectsClock.elapsed()) / 1000.f;
+    bool animated = false;
+    for (const auto& batch : _batches) {
+        auto material = batch.node != nullptr ? getEffectMaterial(batch.node) : nullptr;
+        if (material == nullptr)
+            continue;
+        animated = true;
+        if (material->setTime(time))
+            batch.node->markDirty(QSGNode::DirtyMaterial);
+    }
+    return animated;
+#endif
+}
+
+void    EdgeLayer::itemChange(ItemChange change, const ItemChangeData& data)
+{
+    if (change == QQuickItem::ItemSceneChange) {
+        if (_window)
+            disconnect(_window.data(), nullptr, this, nullptr);
+        _window = data.window;
+        if (_window)    // Note: frameSwapped() is emitted from render thread, connection is queued with threaded render loop
+            connect(_window.data(), &QQuickWindow::frameSwapped,
+                    this,           &qan::EdgeLayer::onFrameSwapped);
+    }
+    QQuickItem::itemChange(change, data);
+}
+
+void    EdgeLayer::onFrameSwapped()
+{
+    if (_animated)
+        update();
+}
+//-----------------------------------------------------------------------------
+
+
+/* Edge Bundling Management *///-----------------------------------------------
+void    EdgeLayer::setBundled(bool bundled) noexcept
+{
+    if (bundled != _bundled) {
+        _bundled = bundled;
+        clearBundles();
+        invalidate();
+        emit bundledChanged();
+    }
+}
+
+void    EdgeLayer::setBundlingStrength(qreal bundlingStrength) noexcept
+{
+    const auto strength = _bundler.getStrength();
+    _bundler.setStrength(bundlingStrength);
+    if (!qFuzzyCompare(1. + strength, 1. + _bundler.getStrength())) {
+        clearBundles();
+        invalidate();
+        emit bundlingStrengthChanged();
+    }
+}
+
+void    EdgeLayer::invalidateBundles()
+{
+    _bundlesDirty = true;
+    polish();
+}
+
+void    EdgeLayer::clearBundles()
+{
+    _bundles = qan::EdgeBundler::Polylines{};
+    _bundlesIndex.clear();
+    _bundledEdges.clear();
+    _bundledGroups.clear();
+}
+
+void    EdgeLayer::updatePolish()
+{
+    if (!_bundled ||
+        !_bundlesDirty ||
+        !_graph)
+        return;
+    // Algorithm:
+    // 1. Collect visible batched edges, register their ends parent groups (and groups ancestors)
+    //    in bundler hierarchy, with groups center in graph container item CS.
+    // 2. Tag groups whose parent or center changed since last bundling, and their sub groups
+    //    (parents are registered before their childs in hierarchy).
+    // 3. Bundle in parallel edges that are new, whose ends moved or whose ends groups are tagged.
+    // 4. Merge bundled polylines with unmodified edges previous polylines, index resulting polylines
+    //    by edge item and invalidate bundled edges sub batches.
+    _bundlesDirty = false;
+    const auto containerItem = _graph->getContainerItem();
+    qan::EdgeBundler::Hierarchy hierarchy;
+    std::vector<const qan::Group*> hierarchyGroups;
+    std::unordered_map<const qan::Node*, int> groupsIndex;
+    const auto groupIndex = [&](qan::Node* node, const auto& self) -> int {
+        const auto group = node != nullptr ? qobject_cast<qan::Group*>(node->get_group()) : nullptr;
+        if (group == nullptr ||
+            group->getGroupItem() == nullptr)
+            return -1;
+        const auto groupIt = groupsIndex.find(group);
+        if (groupIt != groupsIndex.end())
+            return groupIt->second;
+        const auto parent = self(group, self);
+        const auto groupItem = group->getGroupItem();
+        const auto center = groupItem->getGlobalTransform(containerItem).map(
+                                QRectF{0., 0., groupItem->width(), groupItem->height()}.center());
+        const auto index = static_cast<int>(hierarchy.parents.size());
+        hierarchy.parents.push_back(parent);
+        hierarchy.centers.push_back(center);
+        hierarchyGroups.push_back(group);
+        groupsIndex.emplace(group, index);
+        return index;
+    };
+
+    std::vector<qan::EdgeBundler::Edge> edges;                  // 1.
+    std::vector<const qan::EdgeItem*>   edgeItems;
+    std::vector<BundledEdge>            bundledEdges;
+    for (const auto edge : _graph->get_edges()) {
+        const auto edgeItem = edge != nullptr ? edge->getItem() : nullptr;
+        if (edgeItem == nullptr ||
+            !edgeItem->getBatched() ||
+            !isEdgeDrawn(*edgeItem))
+            continue;
+        const auto offset = edgeItem->position();   // Edge items are direct children of graph container item
+        qan::EdgeBundler::Edge bundledEdge;
+        bundledEdge.src = groupIndex(edge->get_src(), groupIndex);
+        bundledEdge.dst = groupIndex(edge->get_dst(), groupIndex);
+        bundledEdge.p1 = offset + edgeItem->getP1();
+        bundledEdge.p2 = offset + edgeItem->getP2();
+        edges.push_back(bundledEdge);
+        edgeItems.push_back(edgeItem);
+        bundledEdges.push_back(BundledEdge{bundledEdge.src >= 0 ? hierarchyGroups[bundledEdge.src] : nullptr,
+                                           bundledEdge.dst >= 0 ? hierarchyGroups[bundledEdge.dst] : nullptr,
+                                           bundledEdge.p1, bundledEdge.p2});
+    }
+
+    const auto groupCount = hierarchy.parents.size();           // 2.
+    std::vector<bool> groupModified(groupCount, false);
+    std::unordered_map<const qan::Group*, BundledGroup> bundledGroups;
+    bundledGroups.reserve(groupCount);
+    for (std::size_t g = 0; g < groupCount; g++) {
+        const auto parentIndex = hierarchy.parents[g];
+        const auto parent = parentIndex >= 0 ? hierarchyGroups[parentIndex] : nullptr;
+        const auto previous = _bundledGroups.find(hierarchyGroups[g]);
+        groupModified[g] = previous == _bundledGroups.end() ||
+                           previous->second.parent != parent ||
+                           previous->second.center != hierarchy.centers[g] ||
+                           (parentIndex >= 0 && groupModified[parentIndex]);
+        bundledGroups.emplace(hierarchyGroups[g], BundledGroup{parent, hierarchy.centers[g]});
+    }
+    _bundledGroups = std::move(bundledGroups);
+
+    constexpr auto modified = std::numeric_limits<std::size_t>::max();  // 3.
+    std::vector<std::size_t> previousIndexes(edges.size(), modified);
+    std::vector<qan::EdgeBundler::Edge> modifiedEdges;
+    for (std::size_t e = 0; e < edges.size(); e++) {
+        const auto previous = _bundlesIndex.find(edgeItems[e]);
+        if (previous == _bundlesIndex.end() ||
+            previous->second >= _bundledEdges.size() ||
+            previous->second + 1 >= _bundles.offsets.size()) {
+            modifiedEdges.push_back(edges[e]);
+            continue;
+        }
+        const auto& previousEdge = _bundledEdges[previous->second];
+        const auto& edge = bundledEdges[e];
+        if (previousEdge.src != edge.src ||
+            previousEdge.dst != edge.dst ||
+            previousEdge.p1 != edge.p1 ||
+            previousEdge.p2 != edge.p2 ||
+            (edges[e].src >= 0 && groupModified[edges[e].src]) ||
+            (edges[e].dst >= 0 && groupModified[edges[e].dst]))
+            modifiedEdges.push_back(edges[e]);
+        else
+            previousIndexes[e] = previous->second;
+    }
+    qan::EdgeBundler::Polylines modifiedBundles;
+    if (!modifiedEdges.empty()) {
+        const auto threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        _bundler.bundle(hierarchy, modifiedEdges, modifiedBundles, threadCount);
+    }
+
+    qan::EdgeBundler::Polylines bundles;                        // 4.
+    bundles.points.reserve(_bundles.points.size());
+    bundles.offsets.reserve(edges.size() + 1);
+    _bundlesIndex.clear();
+    _bundlesIndex.reserve(edgeItems.size());
+    std::size_t m = 0;
+    for (std::size_t e = 0; e < edges.size(); e++) {
+        const auto isModified = previousIndexes[e] == modified;
+        const auto& source = isModified ? modifiedBundles : _bundles;
+        const auto index = isModified ? m++ : previousIndexes[e];
+        bundles.offsets.push_back(bundles.points.size());
+        bundles.points.insert(bundles.points.end(),
+                              source.points.begin() + static_cast<std::ptrdiff_t>(source.offsets[index]),
+                              source.points.begin() + static_cast<std::ptrdiff_t>(source.offsets[index + 1]));
+        _bundlesIndex.emplace(edgeItems[e], e);
+        if (isModified)
+            _dirtyEdges.insert(edgeItems[e]);
+    }
+    bundles.offsets.push_back(bundles.points.size());
+    _bundles = std::move(bundles);
+    _bundledEdges = std::move(bundledEdges);
+    if (!modifiedEdges.empty()) {
+        _selectionDirty = true;
+        update();
+    }
+}
+
+bool    EdgeLayer::getBundledPolyline(const qan::EdgeItem& edgeItem, std::vector<QPointF>& polyline) const
+{
+    if (!_bundled)
+        return false;
+    const auto bundleIt = _bundlesIndex.find(&edgeItem);
+    if (bundleIt == _bundlesIndex.end() ||
+        bundleIt->second + 1 >= _bundles.offsets.size())
+        return false;
+    const auto first = _bundles.points.begin() + static_cast<std::ptrdiff_t>(_bundles.offsets[bundleIt->second]);
+    const auto last = _bundles.points.begin() + static_cast<std::ptrdiff_t>(_bundles.offsets[bundleIt->second + 1]);
+    if (last - first < 2)
+        return false;
+    polyline.assign(first, last);
+    return true;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,269 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanEdgeLayer.h
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <atomic>
+#include <cstddef>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Qt headers
+#include <QQuickItem>
+#include <QQuickWindow>
+#include <QPointer>
+#include <QElapsedTimer>
+#include <QSGGeometryNode>
+
+// QuickQanava headers
+#include "./qanStyle.h"
+#include "./qanEdgeBundler.h"
+
+namespace qan { // ::qan
+
+class Graph;
+class Group;
+class EdgeItem;
+
+/*! \brief Graph level layer drawing all batched edges in a few scene graph nodes.
+ *
+ * Lines (straight, curved and ortho) and arrows of every qan::EdgeItem with \c batched property
+ * set to true are triangulated in flat color geometry nodes, each node batching at most
+ * 256 edges sharing the same qan::EdgeStyle. Selected edges are hilighted with graph selection
+ * color in an extra geometry node drawn below. Batched edges items are lightweight logical and
+ * hit-test objects with no visual content.
+ *
+ * Geometry is regenerated lazily: an edge geometry modification only regenerates its sub batch
+ * (see invalidateEdge()), a style modification regenerates sub batches using this style (see
+ * invalidateStyle()). Edges insertion, removal or style change only regenerate the sub batches they
+ * are added to or removed from (see insertEdge() and removeEdge()).
+ *
+ * Layer is created by qan::Graph when qan::Graph::batchedEdges is set to true, all batched
+ * edges share layer \c z: default to 0, ie below all nodes and groups.
+ *
+ * When \c bundled is set, edges lines are bundled with hierarchical edge bundling over
+ * groups nesting (see qan::EdgeBundler) instead of using their line type. Only edges whose
+ * ends or ends groups have been modified are bundled again.
+ *
+ * Styles with an animated effect (see qan::EdgeStyle::effectType) are drawn with a
+ * qan::EdgeEffectMaterial: while such a batch exists, layer only update effects time uniform
+ * every frame, batches geometry is not regenerated. Effects are available only when QuickQanava
+ * is built with Qt ShaderTools (\c QUICK_QANAVA_EDGE_EFFECTS defined).
+ *
+ * \note Curved edges are flattened to polylines, lines are drawn with flat caps and no
+ * antialiasing.
+ * \nosubgrouping
+ */
+class EdgeLayer : public QQuickItem
+{
+    /*! \name EdgeLayer Object Management *///---------------------------------
+    //@{
+    Q_OBJECT
+    QML_NAMED_ELEMENT(EdgeLayer)
+public:
+    explicit EdgeLayer(QQuickItem* parent = nullptr);
+    virtual ~EdgeLayer() override = default;
+    EdgeLayer(const EdgeLayer&) = delete;
+
+public:
+    //! Graph whose batched edges are drawn by this layer.
+    Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged FINAL)
+    //! \copydoc graph
+    inline qan::Graph*  getGraph() const noexcept { return _graph.data(); }
+    //! \copydoc graph
+    void                setGraph(qan::Graph* graph) noexcept;
+private:
+    //! \copydoc graph
+    QPointer<qan::Graph> _graph;
+signals:
+    //! \copydoc graph
+    void                graphChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Rendering Management *///----------------------------------------
+    //@{
+public slots:
+    //! Invalidate all layer geometry, all batched edges are dispatched again in new sub batches.
+    void            invalidate();
+    //! Invalidate geometry of edges using \c style (nullptr for edges with no style).
+    void            invalidateStyle(const qan::EdgeStyle* style);
+    //! Invalidate selected edges hilight geometry.
+    void            invalidateSelection();
+public:
+    //! Invalidate \c edgeItem geometry, only \c edgeItem sub batch is regenerated.
+    void            invalidateEdge(const qan::EdgeItem& edgeItem);
+    //! Insert \c edgeItem in a sub batch of its style, or move it to a sub batch of its new style.
+    void            insertEdge(const qan::EdgeItem& edgeItem);
+    //! Remove \c edgeItem from its sub batch, \c edgeItem is never dereferenced (might be called from edge item destructor).
+    void            removeEdge(const qan::EdgeItem& edgeItem);
+protected slots:
+    //! Invalidate a style batch when one of its properties is modified.
+    void            onStyleModified();
+
+protected:
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+    virtual void        itemChange(ItemChange change, const ItemChangeData& data) override;
+
+protected slots:
+    //! Schedule a new frame while some batches have an animated effect.
+    void            onFrameSwapped();
+
+private:
+    //! Update animated effects batches time uniform, return true if there is at least one animated batch.
+    bool            updateEffectsTime();
+
+    //! Effects time origin.
+    QElapsedTimer               _effectsClock;
+    //! True while some batches have an animated effect (written in updatePaintNode(), while GUI thread is blocked).
+    std::atomic<bool>           _animated{false};
+    //! Window whose frames drive effects animation.
+    QPointer<QQuickWindow>      _window;
+
+    //! True when edges must be dispatched again in sub batches, and all sub batches regenerated.
+    bool            _allDirty = true;
+    //! True when selection hilight must be regenerated.
+    bool            _selectionDirty = true;
+    //! Styles whose sub batches must be regenerated in next updatePaintNode().
+    std::unordered_set<const qan::EdgeStyle*>   _dirtyStyles;
+    //! Edges whose sub batch must be regenerated in next updatePaintNode().
+    std::unordered_set<const qan::EdgeItem*>    _dirtyEdges;
+    //! Edges to insert (or move) in a sub batch of their style in next updatePaintNode(), removed edges are never dereferenced.
+    std::unordered_set<const qan::EdgeItem*>    _insertedEdges;
+    //! Edges to remove from their sub batch in next updatePaintNode(), removed before \c _insertedEdges are inserted.
+    std::unordered_set<const qan::EdgeItem*>    _removedEdges;
+
+    //! Maximum number of edges in a sub batch.
+    static constexpr std::size_t    batchCapacity = 256;
+    //! Sub batch of edges sharing the same style, drawn with a single geometry node.
+    struct Batch {
+        const qan::EdgeStyle*               style = nullptr;
+        std::vector<const qan::EdgeItem*>   edgeItems;
+        QSGGeometryNode*                    node = nullptr;
+        bool                                dirty = true;
+    };
+    //! Sub batches (accessed only in updatePaintNode(), while GUI thread is blocked).
+    std::vector<Batch>  _batches;
+    //! Index of edge items sub batch in \c _batches (accessed only in updatePaintNode()).
+    std::unordered_map<const qan::EdgeItem*, std::size_t>   _edgeBatches;
+
+    /*! \brief Add \c edgeItem to a non full sub batch of its style registered in \c styleBatches, return \c edgeItem sub batch index.
+     *
+     * A new sub batch is created (or an empty one reused) when there is no sub batch with room for
+     * \c edgeItem style, added sub batch is marked dirty.
+     */
+    std::size_t     dispatchEdge(const qan::EdgeItem& edgeItem,
+                                 std::unordered_map<const qan::EdgeStyle*, std::size_t>& styleBatches);
+    //! Remove \c edgeItem from its sub batch and mark sub batch dirty, \c edgeItem is never dereferenced.
+    void            removeBatchedEdge(const qan::EdgeItem* edgeItem);
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Edge Bundling Management *///-----------------------------------
+    //@{
+public:
+    /*! \brief Bundle batched edges lines along their groups hierarchy (default to false).
+     *
+     * Bundles are computed in parallel during item polish, in GUI thread, at most once per frame after
+     * batched edges geometry changes: only edges whose ends moved, or whose ends parent groups (or
+     * groups ancestors) moved, are bundled again. Edges ends keep their geometry and are oriented along
+     * bundled line ends.
+     */
+    Q_PROPERTY(bool bundled READ getBundled WRITE setBundled NOTIFY bundledChanged FINAL)
+    //! \copydoc bundled
+    inline bool     getBundled() const noexcept { return _bundled; }
+    //! \copydoc bundled
+    void            setBundled(bool bundled) noexcept;
+private:
+    //! \copydoc bundled
+    bool            _bundled = false;
+signals:
+    //! \copydoc bundled
+    void            bundledChanged();
+
+public:
+    //! \brief Bundling strength in [0, 1], 0 for straight edges, 1 for edges strictly following groups hierarchy (default to 0.85).
+    Q_PROPERTY(qreal bundlingStrength READ getBundlingStrength WRITE setBundlingStrength NOTIFY bundlingStrengthChanged FINAL)
+    //! \copydoc bundlingStrength
+    inline qreal    getBundlingStrength() const noexcept { return _bundler.getStrength(); }
+    //! \copydoc bundlingStrength
+    void            setBundlingStrength(qreal bundlingStrength) noexcept;
+signals:
+    //! \copydoc bundlingStrength
+    void            bundlingStrengthChanged();
+
+protected:
+    //! Generate bundled polylines when bundles are invalid.
+    virtual void    updatePolish() override;
+
+private:
+    //! Request bundles update in next polish.
+    void            invalidateBundles();
+    //! Clear all bundles, every edge will be bundled again in next polish.
+    void            clearBundles();
+    //! Return \c edgeItem bundled polyline in \c polyline, false if \c edgeItem is not bundled.
+    bool            getBundledPolyline(const qan::EdgeItem& edgeItem, std::vector<QPointF>& polyline) const;
+
+    qan::EdgeBundler                                _bundler;
+    //! True when bundles must be updated in next updatePolish().
+    bool                                            _bundlesDirty = true;
+    qan::EdgeBundler::Polylines                     _bundles;
+    //! Index of edge items polyline in \c _bundles.
+    std::unordered_map<const qan::EdgeItem*, std::size_t>   _bundlesIndex;
+
+    //! Bundled edge ends and ends parent groups, used to detect edges modifications.
+    struct BundledEdge {
+        const qan::Group*   src = nullptr;
+        const qan::Group*   dst = nullptr;
+        QPointF             p1;
+        QPointF             p2;
+    };
+    //! Bundled edges, indexed like \c _bundles polylines.
+    std::vector<BundledEdge>                        _bundledEdges;
+    //! Bundled group parent and center, used to detect groups modifications.
+    struct BundledGroup {
+        const qan::Group*   parent = nullptr;
+        QPointF             center;
+    };
+    //! Groups of last bundling hierarchy.
+    std::unordered_map<const qan::Group*, BundledGroup>    _bundledGroups;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::EdgeLayer)
@@ -0,0 +1,161 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanEdgePath.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <iterator>
+
+// Qt headers
+#include <QLineF>
+
+// QuickQanava headers
+#include "./qanEdgePath.h"
+
+namespace qan { // ::qan
+
+void    flattenCubic(const QPointF& p1, const QPointF& c1, const QPointF& c2, const QPointF& p2,
+                     qreal tolerance, int depth, QPolygonF& path) noexcept
+{
+    // Curve is flat enough when control points max deviation from chord is below tolerance
+    // (deviation bound is 3/4 of control point distance to their chord "ideal" position).
+    const QPointF u = 3. * c1 - 2. * p1 - p2;
+    const QPointF v = 3. * c2 - p1 - 2. * p2;
+    const qreal flatness = std::max(u.x() * u.x(), v.x() * v.x()) +
+                           std::max(u.y() * u.y(), v.y() * v.y());
+    if (depth <= 0 ||
+        flatness <= 16. * tolerance * tolerance) {
+        path << p2;
+        return;
+    }
+    // De Casteljau subdivision at t=0.5
+    const QPointF p12 = (p1 + c1) / 2.;
+    const QPointF p23 = (c1 + c2) / 2.;
+    const QPointF p34 = (c2 + p2) / 2.;
+    const QPointF p123 = (p12 + p23) / 2.;
+    const QPointF p234 = (p23 + p34) / 2.;
+    const QPointF m = (p123 + p234) / 2.;
+    flattenCubic(p1, p12, p123, m, tolerance, depth - 1, path);
+    flattenCubic(m, p234, p34, p2, tolerance, depth - 1, path);
+}
+
+void    generatePathLengths(const QPolygonF& path, std::vector<qreal>& lengths) noexcept
+{
+    lengths.resize(path.size());
+    qreal length = 0.;
+    for (int p = 0; p < path.size(); p++) {
+        if (p > 0)
+            length += QLineF{path.at(p - 1), path.at(p)}.length();
+        lengths[p] = length;
+    }
+}
+
+int     pathSegmentAtLength(const std::vector<qreal>& lengths, qreal length, qreal& t) noexcept
+{
+    // Note: Lengths out of path are clamped to first or last segment.
+    const auto vertex = std::upper_bound(lengths.cbegin() + 1, lengths.cend() - 1, length);
+    const auto segment = static_cast<int>(std::distance(lengths.cbegin(), vertex)) - 1;
+    const auto segmentLength = lengths[segment + 1] - lengths[segment];
+    t = segmentLength > 0.0000001 ? std::clamp((length - lengths[segment]) / segmentLength, 0., 1.) : 0.;
+    return segment;
+}
+
+QPointF pathPointAtLength(const QPolygonF& path, const std::vector<qreal>& lengths, qreal length) noexcept
+{
+    if (path.isEmpty() ||
+        lengths.size() != static_cast<std::size_t>(path.size()))
+        return QPointF{};
+    if (path.size() == 1)
+        return path.first();
+    qreal t = 0.;
+    const auto s = pathSegmentAtLength(lengths, length, t);
+    return path.at(s) + t * (path.at(s + 1) - path.at(s));
+}
+
+QPolygonF   subPath(const QPolygonF& path, const std::vector<qreal>& lengths, qreal from, qreal to) noexcept
+{
+    if (path.size() < 2 ||
+        lengths.size() != static_cast<std::size_t>(path.size()))
+        return path;
+    qreal tFrom = 0.;
+    qreal tTo = 0.;
+    const auto sFrom = pathSegmentAtLength(lengths, from, tFrom);
+    const auto sTo = pathSegmentAtLength(lengths, to, tTo);
+    QPolygonF section;
+    section.reserve(sTo - sFrom + 2);
+    section << path.at(sFrom) + tFrom * (path.at(sFrom + 1) - path.at(sFrom));
+    for (int p = sFrom + 1; p <= sTo; p++)
+        section << path.at(p);
+    if (tTo > 0.)
+        section << path.at(sTo) + tTo * (path.at(sTo + 1) - path.at(sTo));
+    if (section.size() < 2)
+        section << section.first();
+    return section;
+}
+
+void    trimPath(QPolygonF& path, std::vector<qreal>& lengths, qreal srcLength, qreal dstLength) noexcept
+{
+    if (path.size() < 2 ||
+        lengths.size() != static_cast<std::size_t>(path.size()))
+        return;
+    const auto length = lengths.back();
+    const auto from = std::clamp(srcLength, 0., length);
+    const auto to = std::max(from, length - std::max(0., dstLength));
+    path = subPath(path, lengths, from, to);
+    generatePathLengths(path, lengths);
+}
+
+QPointF fanOffset(const QPointF& src, const QPointF& dst, int index, int count, qreal spacing) noexcept
+{
+    const QLineF fanLine{src, dst};
+    const auto fanLineLength = fanLine.length();
+    if (count <= 1 ||
+        fanLineLength <= 0.0001)
+        return QPointF{0., 0.};
+    const QPointF normal = QPointF{-fanLine.dy(), fanLine.dx()} / fanLineLength;
+    return normal * ((index - (count - 1) / 2.) * spacing);
+}
+
+SelfLoopArc selfLoopArc(const QRectF& br, int index, qreal spacing) noexcept
+{
+    SelfLoopArc arc;
+    const auto anchor = std::max(4., std::min(br.width(), br.height()) / 4.);
+    arc.p1 = QPointF{br.right() - anchor, br.top()};
+    arc.p2 = QPointF{br.right(), br.top() + anchor};
+    const auto extent = std::max(3. * spacing, 2. * anchor) + index * spacing * 1.5;
+    arc.c1 = arc.p1 + QPointF{0., -extent};
+    arc.c2 = arc.p2 + QPointF{extent, 0.};
+    return arc;
+}
+
+} // ::qan
@@ -0,0 +1,97 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanEdgePath.h
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <vector>
+
+// Qt headers
+#include <QPointF>
+#include <QPolygonF>
+#include <QRectF>
+
+namespace qan { // ::qan
+
+/*! \brief Append cubic curve \c p1 \c c1 \c c2 \c p2 flattened with \c tolerance to \c path (\c p1 excluded).
+ *
+ * Curve is recursively subdivided (at most \c depth times) until its control points deviation from
+ * the chord is below \c tolerance.
+ */
+void        flattenCubic(const QPointF& p1, const QPointF& c1, const QPointF& c2, const QPointF& p2,
+                         qreal tolerance, int depth, QPolygonF& path) noexcept;
+
+//! Generate \c path cumulative arc lengths in \c lengths.
+void        generatePathLengths(const QPolygonF& path, std::vector<qreal>& lengths) noexcept;
+
+//! Return index of the path segment at arc \c length, with \c length local position in segment in \c t (\c lengths must have at least 2 vertices).
+int         pathSegmentAtLength(const std::vector<qreal>& lengths, qreal length, qreal& t) noexcept;
+
+//! Return point on \c path at arc \c length, lengths out of path are clamped to path ends.
+QPointF     pathPointAtLength(const QPolygonF& path, const std::vector<qreal>& lengths, qreal length) noexcept;
+
+//! Return \c path section between arc lengths \c from and \c to (with \c from <= \c to).
+QPolygonF   subPath(const QPolygonF& path, const std::vector<qreal>& lengths, qreal from, qreal to) noexcept;
+
+/*! \brief Trim \c srcLength and \c dstLength arc lengths from \c path ends, \c lengths are updated.
+ *
+ * Used to trim curved edges paths to their arrows base. When \c path is shorter than the trimmed
+ * length, source trim has priority and trimmed path is collapsed to a single point (with 2 vertices).
+ */
+void        trimPath(QPolygonF& path, std::vector<qreal>& lengths, qreal srcLength, qreal dstLength) noexcept;
+
+/*! \brief Return offset of parallel edge \c index in a fan of \c count edges between \c src and \c dst.
+ *
+ * Offset is orthogonal to (\c src, \c dst) fan line, fan edges are centered on fan line and separated by
+ * \c spacing. Offset is null for single edges and when \c src and \c dst are equal.
+ */
+QPointF     fanOffset(const QPointF& src, const QPointF& dst, int index, int count, qreal spacing) noexcept;
+
+//! Self loop cubic arc, with \c p1 and \c p2 ends and \c c1 and \c c2 control points.
+struct SelfLoopArc {
+    QPointF p1;
+    QPointF c1;
+    QPointF c2;
+    QPointF p2;
+};
+
+/*! \brief Return self loop \c index arc for an item with \c br bounding rect, loops being separated by \c spacing.
+ *
+ * Loop leaves item top side and enters item right side, ends are at a quarter of \c br smallest dimension
+ * from its top right corner. Control points are offset vertically from \c p1 and horizontally from \c p2,
+ * offset grows with \c index: loops of the same item are nested.
+ */
+SelfLoopArc selfLoopArc(const QRectF& br, int index, qreal spacing) noexcept;
+
+} // ::qan
@@ -0,0 +1,221 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanFrameScheduler.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+
+// QuickQanava headers
+#include "./qanFrameScheduler.h"
+
+namespace qan { // ::qan
+
+/* FrameScheduler Object Management *///---------------------------------------
+FrameScheduler::FrameScheduler(QObject* parent) :
+    QObject{parent}
+{
+}
+
+void    FrameScheduler::setItem(QQuickItem* item) noexcept
+{
+    _item = item;
+    if (hasPendingTasks()) {
+        _frameRequested = false;
+        requestFrame();
+    }
+}
+//-----------------------------------------------------------------------------
+
+
+/* Tasks Management *///-------------------------------------------------------
+void    FrameScheduler::schedule(const void* key, Task task, Priority priority)
+{
+    if (!task)
+        return;
+    enqueue(PendingTask{key,
+                        [task = std::move(task)](const QDeadlineTimer&) { task(); return true; },
+                        priority, -1});
+}
+
+void    FrameScheduler::scheduleIncremental(const void* key, IncrementalTask task,
+                                            Priority priority, int budget)
+{
+    if (!task)
+        return;
+    enqueue(PendingTask{key, std::move(task), priority, std::max(0, budget)});
+}
+
+void    FrameScheduler::enqueue(PendingTask&& pendingTask)
+{
+    // Algorithm:
+    // 1. If task key is pending with the same priority, replace pending task in place.
+    // 2. Otherwise cancel pending task and append task to its priority queue.
+    const auto key = pendingTask.key;
+    if (key != nullptr) {
+        const auto keyIt = _keys.find(key);
+        if (keyIt != _keys.end()) {
+            if (keyIt->second->priority == pendingTask.priority) {   // 1.
+                *keyIt->second = std::move(pendingTask);
+                return;
+            }
+            keyIt->second->task = nullptr;                          // 2.
+            _keys.erase(keyIt);
+        }
+    }
+    auto& queue = _queues[static_cast<std::size_t>(pendingTask.priority)];
+    queue.push_back(std::move(pendingTask));
+    if (key != nullptr)
+        _keys[key] = &queue.back();
+    requestFrame();
+}
+
+void    FrameScheduler::cancel(const void* key) noexcept
+{
+    const auto keyIt = _keys.find(key);
+    if (keyIt != _keys.end()) {
+        keyIt->second->task = nullptr;  // Note: Cancelled tasks are skipped in processTasks()
+        _keys.erase(keyIt);
+    }
+}
+
+void    FrameScheduler::clear() noexcept
+{
+    for (auto& queue : _queues)
+        for (auto& pendingTask : queue)     // Note: Queues might be processed, do not modify them
+            pendingTask.task = nullptr;
+    _keys.clear();
+}
+
+bool    FrameScheduler::hasPendingTasks() const noexcept
+{
+    return std::any_of(_queues.cbegin(), _queues.cend(), [](const auto& queue) {
+        return std::any_of(queue.cbegin(), queue.cend(), [](const auto& pendingTask) {
+            return static_cast<bool>(pendingTask.task);
+        });
+    });
+}
+
+void    FrameScheduler::setFrameBudget(int frameBudget) noexcept
+{
+    frameBudget = std::max(0, frameBudget);
+    if (frameBudget != _frameBudget) {
+        _frameBudget = frameBudget;
+        emit frameBudgetChanged();
+    }
+}
+
+void    FrameScheduler::processTasks() noexcept
+{
+    // PRECONDITIONS:
+        // Not reentrant (a task might process events)
+    if (_processing)
+        return;
+    _frameRequested = false;
+    // Algorithm:
+    // 1. Run High priority tasks, including High priority tasks they schedule (passes are
+    //    bounded to avoid looping on tasks rescheduling themselves).
+    // 2. Run Normal then Low priority tasks present at frame start until frame budget expire.
+    // 3. Request a new frame if some tasks are carried into next frame.
+    _processing = true;
+    const QDeadlineTimer frameDeadline{static_cast<qint64>(_frameBudget)};
+    auto& high = _queues[static_cast<std::size_t>(Priority::High)];
+    static constexpr int maxHighPasses = 8;
+    for (int pass = 0; pass < maxHighPasses && !high.empty(); pass++) {    // 1.
+        auto count = high.size();   // Note: Tasks scheduled in this pass are run in next pass
+        while (count-- > 0)
+            runFront(high, QDeadlineTimer{QDeadlineTimer::Forever});
+    }
+    for (const auto priority : {Priority::Normal, Priority::Low}) {           // 2.
+        auto& queue = _queues[static_cast<std::size_t>(priority)];
+        auto count = queue.size();
+        while (count-- > 0 &&
+               !queue.empty() &&
+               !frameDeadline.hasExpired())
+            runFront(queue, frameDeadline);
+    }
+    _processing = false;
+    for (auto& queue : _queues)     // Drop cancelled tasks at queues front
+        while (!queue.empty() &&
+               !queue.front().task)
+            queue.pop_front();
+    if (hasPendingTasks())                                                  // 3.
+        requestFrame();
+}
+
+void    FrameScheduler::runFront(std::deque<PendingTask>& queue, const QDeadlineTimer& deadline)
+{
+    auto pendingTask = std::move(queue.front());
+    queue.pop_front();
+    if (!pendingTask.task)          // Cancelled or coalesced task
+        return;
+    if (pendingTask.key != nullptr)
+        _keys.erase(pendingTask.key);
+    auto taskDeadline = deadline;
+    if (pendingTask.budget >= 0) {
+        const auto remaining = deadline.remainingTime();
+        taskDeadline = QDeadlineTimer{remaining < 0 ? static_cast<qint64>(pendingTask.budget) :
+                                                      std::min(remaining, static_cast<qint64>(pendingTask.budget))};
+    }
+    if (pendingTask.task(taskDeadline))
+        return;
+    // Note: An unfinished incremental task is dropped if it has been scheduled again while running.
+    if (pendingTask.key != nullptr &&
+        _keys.find(pendingTask.key) != _keys.end())
+        return;
+    enqueue(std::move(pendingTask));
+}
+
+void    FrameScheduler::requestFrame() noexcept
+{
+    // Note: Frame is requested when processing is over, see processTasks().
+    if (_frameRequested ||
+        _processing)
+        return;
+    _frameRequested = true;
+    auto window = _item ? _item->window() : nullptr;
+    if (window != nullptr) {
+        if (window != _window) {
+            if (_window)
+                disconnect(_window.data(), &QQuickWindow::afterAnimating,
+                           this,           &qan::FrameScheduler::processTasks);
+            _window = window;
+            connect(window, &QQuickWindow::afterAnimating,
+                    this,   &qan::FrameScheduler::processTasks);
+        }
+        window->update();
+    } else
+        QMetaObject::invokeMethod(this, &qan::FrameScheduler::processTasks, Qt::QueuedConnection);
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
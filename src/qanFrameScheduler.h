@@ -0,0 +1,175 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanFrameScheduler.h
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <array>
+#include <deque>
+#include <functional>
+#include <unordered_map>
+
+// Qt headers
+#include <QObject>
+#include <QPointer>
+#include <QQuickItem>
+#include <QQuickWindow>
+#include <QDeadlineTimer>
+
+namespace qan { // ::qan
+
+/*! \brief Frame budgeted deferred tasks scheduler.
+ *
+ * Tasks are run in GUI thread on \c item window afterAnimating() signal, just before items polish
+ * and scene graph synchronization, or from event loop when \c item has no window.
+ *
+ * Tasks are run by priority:
+ *  - \c High priority tasks are frame critical (for example dragged nodes edges), they are all
+ *    run in current frame, including high priority tasks they schedule.
+ *  - \c Normal then \c Low priority tasks are run until \c frameBudget is exhausted, remaining
+ *    tasks and unfinished incremental tasks are carried into next frame.
+ *
+ * Tasks scheduled with a \c key that is already pending are coalesced: pending task is replaced
+ * and keep its queue position, a key scheduled many times in a frame is run only once.
+ *
+ * \note Keys are only compared, they are never dereferenced: tasks must guard the objects they
+ * capture (with a QPointer for example).
+ * \nosubgrouping
+ */
+class FrameScheduler : public QObject
+{
+    /*! \name FrameScheduler Object Management *///----------------------------
+    //@{
+    Q_OBJECT
+    QML_ELEMENT
+public:
+    explicit FrameScheduler(QObject* parent = nullptr);
+    virtual ~FrameScheduler() override = default;
+    FrameScheduler(const FrameScheduler&) = delete;
+
+public:
+    //! Item whose window frames drive tasks processing.
+    void                setItem(QQuickItem* item) noexcept;
+    //! \copydoc setItem()
+    inline QQuickItem*  getItem() const noexcept { return _item.data(); }
+private:
+    //! \copydoc setItem()
+    QPointer<QQuickItem>    _item;
+    //! Window whose afterAnimating() signal trigger processTasks().
+    QPointer<QQuickWindow>  _window;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Tasks Management *///--------------------------------------------
+    //@{
+public:
+    //! Task priority, see qan::FrameScheduler.
+    enum class Priority : unsigned int {
+        //! Frame critical task, always run in next frame.
+        High    = 0,
+        //! Budgeted task.
+        Normal  = 1,
+        //! Budgeted task, run after normal priority tasks.
+        Low     = 2
+    };
+    Q_ENUM(Priority)
+
+    //! One shot task.
+    using Task = std::function<void()>;
+    //! Incremental task, called once per frame with its deadline until it returns true.
+    using IncrementalTask = std::function<bool(const QDeadlineTimer&)>;
+
+    //! Schedule a one shot \c task, tasks with a pending \c key are coalesced (tasks with a nullptr \c key are never coalesced).
+    void            schedule(const void* key, Task task, Priority priority = Priority::Normal);
+    /*! \brief Schedule an incremental \c task, called with a deadline of at most \c budget ms every frame until it returns true.
+     *
+     * Deadline is also bounded by remaining frame budget for Normal and Low priority tasks.
+     */
+    void            scheduleIncremental(const void* key, IncrementalTask task,
+                                        Priority priority = Priority::Normal, int budget = 2);
+    //! Cancel pending task scheduled with \c key.
+    void            cancel(const void* key) noexcept;
+    //! Cancel all pending tasks.
+    void            clear() noexcept;
+    //! Return true if there are pending tasks.
+    bool            hasPendingTasks() const noexcept;
+
+public:
+    //! Maximum time in ms spent running Normal and Low priority tasks per frame (default to 4ms).
+    Q_PROPERTY(int frameBudget READ getFrameBudget WRITE setFrameBudget NOTIFY frameBudgetChanged FINAL)
+    //! \copydoc frameBudget
+    inline int      getFrameBudget() const noexcept { return _frameBudget; }
+    //! \copydoc frameBudget
+    void            setFrameBudget(int frameBudget) noexcept;
+private:
+    //! \copydoc frameBudget
+    int             _frameBudget = 4;
+signals:
+    //! \copydoc frameBudget
+    void            frameBudgetChanged();
+
+public slots:
+    //! Run pending tasks, within frame budget (usually called from item window afterAnimating()).
+    void            processTasks() noexcept;
+
+private:
+    struct PendingTask {
+        const void*     key = nullptr;
+        //! Empty for cancelled or coalesced tasks.
+        IncrementalTask task;
+        Priority        priority = Priority::Normal;
+        //! Task budget in ms, -1 for one shot tasks.
+        int             budget = -1;
+    };
+    //! Enqueue \c pendingTask, coalescing it with a pending task using the same key.
+    void            enqueue(PendingTask&& pendingTask);
+    //! Run \c queue front task with \c deadline, unfinished incremental tasks are enqueued again.
+    void            runFront(std::deque<PendingTask>& queue, const QDeadlineTimer& deadline);
+    //! Request a frame on item window (or a processTasks() call from event loop when there is no window).
+    void            requestFrame() noexcept;
+
+    //! Pending tasks queues, by priority.
+    //! \note Tasks are never erased from queues middle, so keys references stay valid.
+    std::array<std::deque<PendingTask>, 3>          _queues;
+    //! Pending keyed tasks.
+    std::unordered_map<const void*, PendingTask*>   _keys;
+    bool            _frameRequested = false;
+    bool            _processing = false;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::FrameScheduler)
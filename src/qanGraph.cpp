@@ -34,9 +34,14 @@
 
 // Std headers
 #include <memory>
+#include <algorithm>
 
 // Qt headers
 #include <QQmlProperty>
+#include <QQmlIncubationController>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <QThreadPool>
 #include <QVariant>
 #include <QQmlEngine>
 #include <QQmlComponent>
@@ -76,6 +81,8 @@ Graph::~Graph()
         node->disconnect(node, 0, 0, 0);
     for (const auto edge: get_edges())
         edge->disconnect(edge, 0, 0, 0);
+    cancelIncubations();
+    clearDelegatesPool();
 }
 
 void    Graph::classBegin()
@@ -148,6 +155,9 @@ void    Graph::setContainerItem(QQuickItem* containerItem)
     if (containerItem != nullptr &&
         containerItem != _containerItem.data()) {
         _containerItem = containerItem;
+        _frameScheduler.setItem(containerItem);
+        if (_edgeLayer)
+            _edgeLayer->setParentItem(containerItem);
         emit containerItemChanged();
     }
 }
@@ -164,67 +174,98 @@ void    Graph::clear() noexcept
     _selectedNodes.clear();
     _selectedGroups.clear();
     _selectedEdges.clear();
+    _orthoRouter.clear();
+    _spatialIndex.clear();
+    _groupsIndex.clear();
+    _multiEdges.clear();
+    _multiEdgesKeys.clear();
+    cancelIncubations();
+    _virtualPrimitives.clear();
+    _virtualNodesIndex.clear();
+    _virtualEdgesIndex.clear();
+    clearDelegatesPool();
     super_t::clear();
     _styleManager.clear();
 }
 
 QQuickItem* Graph::graphChildAt(qreal x, qreal y) const
 {
-    if (getContainerItem() == nullptr)
+    // Algorithm:
+        // 1. Query spatial index for items whose bounding rect contains (x, y)
+        // 2. Keep items containing (x, y), using item contains() shape test
+        // 3. Find top most graph container child
+        // 4. For tables, look in table cells, for groups, look in group container top most child
+    const auto containerItem = getContainerItem();
+    if (containerItem == nullptr)
         return nullptr;
-    const auto childrens = getContainerItem()->childItems();
-    for (int i = childrens.count() - 1; i >= 0; --i) {
-        QQuickItem* child = childrens.at(i);
-        const QPointF point = mapToItem(child, QPointF{x, y});  // Map coordinates to the child element's coordinate space
-        if (child != nullptr &&
-            child->isVisible() &&
-            child->contains(point) &&    // Note 20160508: childAt do not call contains()
-            point.x() > -0.0001 &&
-            child->width() > point.x() &&
-            point.y() > -0.0001 &&
-            child->height() > point.y()) {
-            if (child->inherits("qan::TableGroupItem")) {
-                const auto tableGroupItem = static_cast<qan::TableGroupItem*>(child);
-                if (tableGroupItem != nullptr) {
-                    for (const auto cell: tableGroupItem->getCells()) {
-                        const auto point = mapToItem(cell, QPointF(x, y)); // Map coordinates to group child element's coordinate space
-                        if (cell->isVisible() &&
-                            cell->contains(point) &&
-                            point.x() > -0.0001 &&
-                            cell->width() > point.x() &&
-                            point.y() > -0.0001 &&
-                            cell->height() > point.y()) {
-                            QQmlEngine::setObjectOwnership(cell->getItem(), QQmlEngine::CppOwnership);
-                            return cell->getItem();
-                        }
-                    }
-                }
+    const auto containsPoint = [this, x, y](QQuickItem* item) -> bool {
+        const QPointF point = mapToItem(item, QPointF{x, y});  // Map coordinates to the child element's coordinate space
+        return item != nullptr &&
+               item->isVisible() &&
+               item->contains(point) &&    // Note 20160508: childAt do not call contains()
+               point.x() > -0.0001 &&
+               item->width() > point.x() &&
+               point.y() > -0.0001 &&
+               item->height() > point.y();
+    };
+    // Return top most item in items that is a direct child of parent: items are
+    // painted ordered by z, then by parent childs order.
+    const auto getTopMostChild = [](const QQuickItem* parent, const std::vector<QQuickItem*>& items) -> QQuickItem* {
+        QQuickItem* topMost = nullptr;
+        QList<QQuickItem*> childs;
+        for (const auto item: items) {
+            if (item->parentItem() != parent)
+                continue;
+            if (topMost == nullptr ||
+                item->z() > topMost->z())
+                topMost = item;
+            else if (qFuzzyCompare(1. + item->z(), 1. + topMost->z())) {
+                if (childs.isEmpty())
+                    childs = parent->childItems();
+                if (childs.indexOf(item) > childs.indexOf(topMost))
+                    topMost = item;
             }
-            if (child->inherits("qan::GroupItem")) {  // For group, look in group childs
-                const auto groupItem = qobject_cast<qan::GroupItem*>(child);
-                if (groupItem != nullptr &&
-                    groupItem->getContainer() != nullptr) {
-                    const QList<QQuickItem *> groupChildren = groupItem->getContainer()->childItems();
-                    for (int gc = groupChildren.count() - 1; gc >= 0; --gc) {
-                        QQuickItem* groupChild = groupChildren.at(gc);
-                        const auto point = mapToItem(groupChild, QPointF(x, y)); // Map coordinates to group child element's coordinate space
-                        if (groupChild->isVisible() &&
-                            groupChild->contains(point) &&
-                            point.x() > -0.0001 &&
-                            groupChild->width() > point.x() &&
-                            point.y() > -0.0001 &&
-                            groupChild->height() > point.y()) {
-                            QQmlEngine::setObjectOwnership(groupChild, QQmlEngine::CppOwnership);
-                            return groupChild;
-                        }
-                    }
+        }
+        return topMost;
+    };
+
+    // 1. and 2.
+    auto items = queryItems(QRectF{mapToItem(containerItem, QPointF{x, y}), QSizeF{0., 0.}});
+    items.erase(std::remove_if(items.begin(), items.end(), [&containsPoint](QQuickItem* item) {
+                    return !containsPoint(item);
+                }), items.end());
+
+    // 3.
+    const auto child = getTopMostChild(containerItem, items);
+    if (child == nullptr)
+        return nullptr;
+
+    // 4.
+    if (child->inherits("qan::TableGroupItem")) {
+        const auto tableGroupItem = static_cast<qan::TableGroupItem*>(child);
+        if (tableGroupItem != nullptr) {
+            for (const auto cell: tableGroupItem->getCells()) {
+                if (cell != nullptr &&
+                    containsPoint(cell)) {
+                    QQmlEngine::setObjectOwnership(cell->getItem(), QQmlEngine::CppOwnership);
+                    return cell->getItem();
                 }
             }
-            QQmlEngine::setObjectOwnership(child, QQmlEngine::CppOwnership);
-            return child;
         }
     }
-    return nullptr;
+    if (child->inherits("qan::GroupItem")) {  // For group, look in group childs
+        const auto groupItem = qobject_cast<qan::GroupItem*>(child);
+        if (groupItem != nullptr &&
+            groupItem->getContainer() != nullptr) {
+            const auto groupChild = getTopMostChild(groupItem->getContainer(), items);
+            if (groupChild != nullptr) {
+                QQmlEngine::setObjectOwnership(groupChild, QQmlEngine::CppOwnership);
+                return groupChild;
+            }
+        }
+    }
+    QQmlEngine::setObjectOwnership(child, QQmlEngine::CppOwnership);
+    return child;
 }
 
 qan::Group* Graph::groupAt(const QPointF& p, const QSizeF& s, const QQuickItem* except) const
@@ -234,58 +275,46 @@ qan::Group* Graph::groupAt(const QPointF& p, const QSizeF& s, const QQuickItem*
         // except can be nullptr
     if (!s.isValid())
         return nullptr;
+    if (getContainerItem() == nullptr)
+            return nullptr;
 
     // Algorithm:
-        // 1. Copy internal group list
-        // 2. Order the container of group from maximum to minimum z
-        // 3. Return the first group containing rect(p,s)
+        // 1. Query groups spatial index for groups intersecting rect(p,s)
+        // 2. Return the group with maximum cached global z containing rect(p,s)
 
     // 1.
-    std::vector<qan::Group*> groups;
-    groups.reserve(static_cast<unsigned int>(get_groups().size()));
-    for (const auto group : std::as_const(get_groups().getContainer())) {
-        if (group != nullptr)
-            groups.push_back(group);
-    }
+    std::vector<qan::SpatialIndex::Key> keys;
+    _groupsIndex.query(QRectF{p, s}, keys);
 
     // 2.
-    std::sort(groups.begin(), groups.end(), [](const auto g1, const auto g2) -> bool {
-        if (g1 == nullptr || g2 == nullptr)
-            return false;
-        const auto g1Item = g1->getItem();
-        const auto g2Item = g2->getItem();
-        if (g1Item == nullptr ||
-            g2Item == nullptr)
-            return false;
-        const auto g1GlobalZ = qan::getItemGlobalZ_rec(g1Item);
-        const auto g2GlobalZ = qan::getItemGlobalZ_rec(g2Item);
-        return g1GlobalZ > g2GlobalZ;
-    });
-
-    // 3.
-    if (getContainerItem() == nullptr)
-            return nullptr;
-    for (const auto group : std::as_const(groups)) {
-        if (group &&
-            group->getItem() != nullptr &&
-            group->getItem() != except) {
-            const auto groupItem = group->getGroupItem();
-            if (groupItem == nullptr)
-                continue;
-            if (groupItem->getCollapsed())
-                continue;  // Do not return collapsed groups
-
-            const auto groupRect =  QRectF{groupItem->mapToItem(getContainerItem(), QPointF{0., 0.}),
-                                           QSizeF{groupItem->width(), groupItem->height()}};
-            const auto targetSize = groupItem->getStrictDrop() ? s :            // In non-strict mode (ie for TableGroup) target has not
-                                                                 QSizeF{1,1};   // to be fully contained by group to trigger a drop.
-            if (groupRect.contains(QRectF{p, targetSize})) {
-                QQmlEngine::setObjectOwnership(group, QQmlEngine::CppOwnership);
-                return group;
-            }
+    qan::Group* topMostGroup = nullptr;
+    qreal topMostZ = 0.;
+    for (const auto key : keys) {
+        // Note: Groups index keys are QObject pointers of alive group items.
+        const auto groupItem = qobject_cast<qan::GroupItem*>(const_cast<QObject*>(static_cast<const QObject*>(key)));
+        if (groupItem == nullptr ||
+            groupItem == except ||
+            groupItem->getGroup() == nullptr)
+            continue;
+        if (groupItem->getCollapsed())
+            continue;  // Do not return collapsed groups
+
+        const auto groupRect = _groupsIndex.getRect(key);
+        const auto targetSize = groupItem->getStrictDrop() ? s :            // In non-strict mode (ie for TableGroup) target has not
+                                                             QSizeF{1,1};   // to be fully contained by group to trigger a drop.
+        if (groupRect == nullptr ||
+            !groupRect->contains(QRectF{p, targetSize}))
+            continue;
+        const auto z = groupItem->getGlobalZ(getContainerItem());
+        if (topMostGroup == nullptr ||
+            z > topMostZ) {
+            topMostGroup = groupItem->getGroup();
+            topMostZ = z;
         }
-    } // for all groups
-    return nullptr;
+    }
+    if (topMostGroup != nullptr)
+        QQmlEngine::setObjectOwnership(topMostGroup, QQmlEngine::CppOwnership);
+    return topMostGroup;
 }
 //-----------------------------------------------------------------------------
 
@@ -414,23 +443,7 @@ QQuickItem* Graph::createFromComponent(QQmlComponent* component,
         qWarning() << "qan::Graph::createFromComponent(): Error called with a nullptr delegate component.";
         return nullptr;
     }
-    QQuickItem* item = nullptr;
-    try {
-        if (!component->isReady())
-            throw qan::Error{ "Error delegate component is not ready." };
-
-        const auto rootContext = qmlContext(this);
-        if (rootContext == nullptr)
-            throw qan::Error{ "Error can't access to local QML context." };
-        QObject* object = component->beginCreate(rootContext);
-        if (object == nullptr ||
-            component->isError()) {
-            if (object != nullptr)
-                object->deleteLater();
-            throw qan::Error{ "Failed to create a concrete QQuickItem from QML component:\n\t" +
-                              component->errorString() };
-        }
-        // No error occurs
+    const auto configureObject = [this, component, &style, node, edge, group](QObject* object) {
         if (node != nullptr) {
             const auto nodeItem = qobject_cast<qan::NodeItem*>(object);
             if (nodeItem != nullptr) {
@@ -462,6 +475,32 @@ QQuickItem* Graph::createFromComponent(QQmlComponent* component,
             if (nodeItem != nullptr)                                    // is a preview item, but now actual underlining node.
                 nodeItem->setItemStyle(&style);
         }
+    };
+    // Reuse a parked item if one is available in delegates pool
+    auto item = acquirePooledItem(component);
+    if (item != nullptr) {
+        configureObject(item);
+        item->setParentItem(getContainerItem());
+        item->setVisible(true);
+        return item;
+    }
+    try {
+        if (!component->isReady())
+            throw qan::Error{ "Error delegate component is not ready." };
+
+        const auto rootContext = qmlContext(this);
+        if (rootContext == nullptr)
+            throw qan::Error{ "Error can't access to local QML context." };
+        QObject* object = component->beginCreate(rootContext);
+        if (object == nullptr ||
+            component->isError()) {
+            if (object != nullptr)
+                object->deleteLater();
+            throw qan::Error{ "Failed to create a concrete QQuickItem from QML component:\n\t" +
+                              component->errorString() };
+        }
+        // No error occurs
+        configureObject(object);
         component->completeCreate();
         if (!component->isError()) {
             QQmlEngine::setObjectOwnership(object, QQmlEngine::CppOwnership);
@@ -529,7 +568,9 @@ QQuickItem* Graph::createSelectionItem(QQuickItem* parent)
     const auto edgeItem = qobject_cast<qan::EdgeItem*>(parent);
     if (edgeItem != nullptr)    // Edge selection item is managed directly in EdgeTemplate.qml
         return nullptr;
-    const auto selectionItem = createItemFromComponent(_selectionDelegate.get());
+    auto selectionItem = acquirePooledItem(_selectionDelegate.get());
+    if (selectionItem == nullptr)
+        selectionItem = createItemFromComponent(_selectionDelegate.get());
     if (selectionItem != nullptr) {
         selectionItem->setEnabled(false); // Avoid node/edge/group selection problems
         selectionItem->setState("UNSELECTED");
@@ -655,35 +696,16 @@ bool    Graph::insertNode(Node* node, QQmlComponent* nodeComponent, qan::NodeSty
         if (nodeComponent != nullptr &&
             nodeStyle != nullptr) {
             _styleManager.setStyleComponent(nodeStyle, nodeComponent);
-            nodeItem = static_cast<qan::NodeItem*>(createFromComponent(nodeComponent,
-                                                                       *nodeStyle,
-                                                                       node));
+            if (!virtualizeNode(*node, *nodeComponent, *nodeStyle))   // Virtual node item is created later
+                nodeItem = static_cast<qan::NodeItem*>(createFromComponent(nodeComponent,
+                                                                           *nodeStyle,
+                                                                           node));
         }
         if (nodeItem != nullptr) {
             nodeItem->setNode(node);
             nodeItem->setGraph(this);
             node->setItem(nodeItem);
-            auto notifyNodeClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
-                if ( nodeItem != nullptr && nodeItem->getNode() != nullptr )
-                    emit this->nodeClicked(nodeItem->getNode(), p);
-            };
-            connect(nodeItem,   &qan::NodeItem::nodeClicked,
-                    this,       notifyNodeClicked);
-
-            auto notifyNodeRightClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
-                if ( nodeItem != nullptr && nodeItem->getNode() != nullptr )
-                    emit this->nodeRightClicked(nodeItem->getNode(), p);
-            };
-            connect(nodeItem,   &qan::NodeItem::nodeRightClicked,
-                    this,       notifyNodeRightClicked);
-
-            auto notifyNodeDoubleClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
-                if ( nodeItem != nullptr && nodeItem->getNode() != nullptr )
-                    emit this->nodeDoubleClicked(nodeItem->getNode(), p);
-            };
-            connect(nodeItem, &qan::NodeItem::nodeDoubleClicked,
-                    this,     notifyNodeDoubleClicked);
-            node->setItem(nodeItem);
+            connectNodeItem(*nodeItem);
             {   // Send item to front
                 const auto z = nextMaxZ();
                 nodeItem->setZ(z);
@@ -699,12 +721,40 @@ bool    Graph::insertNode(Node* node, QQmlComponent* nodeComponent, qan::NodeSty
         return false; // node eventually destroyed by shared_ptr
     }
     if (node != nullptr) {       // Notify user.
+        if (node->getItem() != nullptr)
+            configureSpatialItem(*node->getItem());
+        if (_orthoRouting)
+            configureOrthoObstacle(*node);
         onNodeInserted(*node);
         emit nodeInserted(node);
     }
     return true;
 }
 
+void    Graph::connectNodeItem(qan::NodeItem& nodeItem)
+{
+    auto notifyNodeClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
+        if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
+            emit this->nodeClicked(nodeItem->getNode(), p);
+    };
+    connect(&nodeItem, &qan::NodeItem::nodeClicked,
+            this,      notifyNodeClicked);
+
+    auto notifyNodeRightClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
+        if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
+            emit this->nodeRightClicked(nodeItem->getNode(), p);
+    };
+    connect(&nodeItem, &qan::NodeItem::nodeRightClicked,
+            this,      notifyNodeRightClicked);
+
+    auto notifyNodeDoubleClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
+        if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
+            emit this->nodeDoubleClicked(nodeItem->getNode(), p);
+    };
+    connect(&nodeItem, &qan::NodeItem::nodeDoubleClicked,
+            this,      notifyNodeDoubleClicked);
+}
+
 bool    Graph::removeNode(qan::Node* node, bool force)
 {
     // PRECONDITIONS:
@@ -721,6 +771,21 @@ bool    Graph::removeNode(qan::Node* node, bool force)
     emit nodeRemoved(node);
     if (_selectedNodes.contains(node))
         _selectedNodes.removeAll(node);
+    removeSpatialItem(node->getItem());
+    if (_orthoRouting) {
+        _frameScheduler.cancel(node);   // Cancel pending obstacle update (see onOrthoObstacleModified())
+        for (const auto inEdge: node->get_in_edges())
+            _orthoRouter.removeRoute(inEdge);
+        for (const auto outEdge: node->get_out_edges())
+            _orthoRouter.removeRoute(outEdge);
+        for (const auto route: _orthoRouter.removeObstacle(node)) {
+            const auto edge = const_cast<qan::Edge*>(static_cast<const qan::Edge*>(route));
+            if (edge->getItem() != nullptr)
+                edge->getItem()->scheduleUpdateItem();
+        }
+    }
+    if (_delegatesPoolCapacity > 0)
+        recycleNodeItem(*node);
     return super_t::remove_node(node);  // warning node pointer now invalid
 }
 
@@ -861,15 +926,28 @@ bool    Graph::configureEdge(qan::Edge& edge, QQmlComponent& edgeComponent, qan:
                              qan::Node& src, qan::Node* dst)
 {
     _styleManager.setStyleComponent(&style, &edgeComponent);
+    if (virtualizeEdge(edge, edgeComponent, style, src, dst))  // Edge item will be created when src and dst are materialized
+        return true;
     auto edgeItem = qobject_cast< qan::EdgeItem* >(createFromComponent(&edgeComponent, style, nullptr, &edge));
     if (edgeItem == nullptr) {
         qWarning() << "qan::Graph::insertEdge(): Warning: Edge creation from QML delegate failed.";
         return false;
     }
-    edge.setItem(edgeItem);
-    edgeItem->setSourceItem(src.getItem());
+    configureEdgeItem(edge, *edgeItem, src, dst);
+    return true;
+}
+
+void    Graph::configureEdgeItem(qan::Edge& edge, qan::EdgeItem& edgeItem,
+                                 qan::Node& src, qan::Node* dst)
+{
+    edge.setItem(&edgeItem);
+    configureSpatialItem(edgeItem);
+    if (_edgeLayer &&
+        edgeItem.getBatched())
+        _edgeLayer->insertEdge(edgeItem);
+    edgeItem.setSourceItem(src.getItem());
     if (dst != nullptr)
-        edgeItem->setDestinationItem(dst->getItem());
+        edgeItem.setDestinationItem(dst->getItem());
 
     edge.set_src(&src);
     if (dst != nullptr)
@@ -879,23 +957,22 @@ bool    Graph::configureEdge(qan::Edge& edge, QQmlComponent& edgeComponent, qan:
         if (edgeItem != nullptr && edgeItem->getEdge() != nullptr)
             emit this->edgeClicked(edgeItem->getEdge(), p);
     };
-    connect(edgeItem, &qan::EdgeItem::edgeClicked,
-            this,     notifyEdgeClicked);
+    connect(&edgeItem, &qan::EdgeItem::edgeClicked,
+            this,      notifyEdgeClicked);
 
     auto notifyEdgeRightClicked = [this] (qan::EdgeItem* edgeItem, QPointF p) {
         if (edgeItem != nullptr && edgeItem->getEdge() != nullptr)
             emit this->edgeRightClicked(edgeItem->getEdge(), p);
     };
-    connect(edgeItem,   &qan::EdgeItem::edgeRightClicked,
+    connect(&edgeItem,  &qan::EdgeItem::edgeRightClicked,
             this,       notifyEdgeRightClicked);
 
     auto notifyEdgeDoubleClicked = [this] (qan::EdgeItem* edgeItem, QPointF p) {
         if (edgeItem != nullptr && edgeItem->getEdge() != nullptr)
             emit this->edgeDoubleClicked(edgeItem->getEdge(), p);
     };
-    connect(edgeItem, &qan::EdgeItem::edgeDoubleClicked,
-            this,     notifyEdgeDoubleClicked);
-    return true;
+    connect(&edgeItem, &qan::EdgeItem::edgeDoubleClicked,
+            this,      notifyEdgeDoubleClicked);
 }
 
 bool    Graph::removeEdge(qan::Node* source, qan::Node* destination) {
@@ -909,7 +986,14 @@ bool    Graph::removeEdge(qan::Edge* edge, bool force) {
          edge->getLocked()))
         return false;
     _selectedEdges.removeAll(edge);
+    _orthoRouter.removeRoute(edge);
+    removeSpatialItem(edge->getItem());
+    if (_edgeLayer &&
+        edge->getItem() != nullptr)
+        _edgeLayer->removeEdge(*edge->getItem());
     emit onEdgeRemoved(edge);
+    if (_delegatesPoolCapacity > 0)
+        recycleEdgeItem(*edge);
     return super_t::remove_edge(edge);
 }
 
@@ -921,6 +1005,124 @@ bool    Graph::hasEdge(const qan::Node* source, const qan::Node* destination) co
 }
 
 bool    Graph::hasEdge(const qan::Edge* edge) const { return hasEdge(edge->get_src(), edge->get_dst()); }
+
+void    Graph::scheduleEdgeUpdate(qan::EdgeItem& edgeItem) noexcept
+{
+    // Algorithm:
+    // 1. Register edge item for next update.
+    // 2. On first scheduled edge, schedule a high priority frame task: edges are updated
+    //    on container item window afterAnimating() signal, in GUI thread just before scene
+    //    graph synchronization.
+    const auto requestUpdate = _scheduledEdges.empty();
+    _scheduledEdges.emplace_back(&edgeItem);    // 1.
+    if (requestUpdate)                          // 2.
+        _frameScheduler.schedule(&_scheduledEdges, [this]() { updateScheduledEdges(); },
+                                 qan::FrameScheduler::Priority::High);
+}
+
+void    Graph::updateScheduledEdges() noexcept
+{
+    if (_scheduledEdges.empty())
+        return;
+    // Note: Updating an edge might schedule other edges updates, they will be processed in next frame.
+    std::vector<QPointer<qan::EdgeItem>> scheduledEdges;
+    scheduledEdges.swap(_scheduledEdges);
+    if (_parallelEdgesThreshold > 0 &&
+        static_cast<int>(scheduledEdges.size()) >= _parallelEdgesThreshold) {
+        // Note: Items scheduled twice or already updated synchronously are skipped, items that might
+        // have a custom updateItem() are updated with updateItemSlot().
+        std::vector<QPointer<qan::EdgeItem>> concurrentEdges;
+        concurrentEdges.reserve(scheduledEdges.size());
+        for (const auto& edgeItem : scheduledEdges) {
+            if (!edgeItem || !edgeItem->isUpdateScheduled())
+                continue;
+            if (edgeItem->isConcurrentUpdateEnabled())
+                concurrentEdges.emplace_back(edgeItem);
+            else
+                edgeItem->processScheduledUpdate();
+        }
+        if (static_cast<int>(concurrentEdges.size()) >= _parallelEdgesThreshold) {
+            const auto threadCount = std::max(1, QThreadPool::globalInstance()->maxThreadCount());
+            qan::EdgeItem::updateItems(concurrentEdges, threadCount);
+        } else
+            for (const auto& edgeItem : concurrentEdges)
+                if (edgeItem)
+                    edgeItem->processScheduledUpdate();
+    } else {
+        for (const auto& edgeItem : scheduledEdges)
+            if (edgeItem)
+                edgeItem->processScheduledUpdate();
+    }
+}
+
+void    Graph::setMultiEdgeSpacing(qreal multiEdgeSpacing) noexcept
+{
+    multiEdgeSpacing = std::max(0., multiEdgeSpacing);
+    if (qFuzzyCompare(1. + multiEdgeSpacing, 1. + _multiEdgeSpacing))
+        return;
+    _multiEdgeSpacing = multiEdgeSpacing;
+    for (const auto& [key, fan] : _multiEdges) {
+        if (fan.size() > 1 ||
+            key.first == key.second)    // Self loops extent depends on spacing
+            for (const auto edgeItem : fan)
+                edgeItem->scheduleUpdateItem();
+    }
+    emit multiEdgeSpacingChanged();
+}
+
+void    Graph::updateMultiEdge(qan::EdgeItem& edgeItem) noexcept
+{
+    // Algorithm:
+    // 1. Remove edge from its previous fan.
+    // 2. Insert edge in its source and destination items fan.
+    // 3. Update fan edges index.
+    removeMultiEdge(edgeItem);          // 1.
+    const QQuickItem* src = edgeItem.getSourceItem();
+    const QQuickItem* dst = edgeItem.getDestinationItem();
+    if (src == nullptr ||
+        dst == nullptr)
+        return;
+    const auto key = std::less<const QQuickItem*>{}(dst, src) ? MultiEdgeKey{dst, src} :
+                                                                MultiEdgeKey{src, dst};
+    auto& fan = _multiEdges[key];       // 2.
+    fan.push_back(&edgeItem);
+    _multiEdgesKeys[&edgeItem] = key;
+    updateMultiEdgeFan(key, fan);       // 3.
+}
+
+void    Graph::removeMultiEdge(const qan::EdgeItem& edgeItem) noexcept
+{
+    const auto keyIt = _multiEdgesKeys.find(&edgeItem);
+    if (keyIt == _multiEdgesKeys.end())
+        return;
+    const auto key = keyIt->second;
+    _multiEdgesKeys.erase(keyIt);
+    const auto fanIt = _multiEdges.find(key);
+    if (fanIt == _multiEdges.end())
+        return;
+    auto& fan = fanIt->second;
+    fan.erase(std::remove(fan.begin(), fan.end(), &edgeItem), fan.end());
+    if (fan.empty())
+        _multiEdges.erase(fanIt);
+    else
+        updateMultiEdgeFan(key, fan);
+}
+
+void    Graph::updateMultiEdgeFan(const MultiEdgeKey& key, const std::vector<qan::EdgeItem*>& fan) noexcept
+{
+    const auto count = static_cast<int>(fan.size());
+    for (int e = 0; e < count; e++)
+        fan[e]->setFan(e, count, fan[e]->getSourceItem() != key.first);
+}
+
+void    Graph::setParallelEdgesThreshold(int parallelEdgesThreshold) noexcept
+{
+    parallelEdgesThreshold = std::max(0, parallelEdgesThreshold);
+    if (parallelEdgesThreshold != _parallelEdgesThreshold) {
+        _parallelEdgesThreshold = parallelEdgesThreshold;
+        emit parallelEdgesThresholdChanged();
+    }
+}
 //-----------------------------------------------------------------------------
 
 /* Graph Group Management *///-------------------------------------------------
@@ -994,6 +1196,10 @@ bool    Graph::insertGroup(Group* group, QQmlComponent* groupComponent, qan::Nod
         }
     }
     if (group != nullptr) {       // Notify user.
+        if (group->getItem() != nullptr)
+            configureSpatialItem(*group->getItem());
+        if (_orthoRouting)
+            configureOrthoObstacle(*group);
         onNodeInserted(*group);
         emit nodeInserted(group);
     }
@@ -1028,6 +1234,7 @@ void    Graph::removeGroup(qan::Group* group, bool removeContent, bool force)
             _selectedNodes.removeAll(group);
         if (_selectedGroups.contains(group))
             _selectedGroups.removeAll(group);
+        removeSpatialItem(group->getItem());
         remove_group(group);
     } else {
         removeGroupContent_rec(group);
@@ -1053,6 +1260,7 @@ void    Graph::removeGroupContent_rec(qan::Group* group)
 
     if (_selectedNodes.contains(group))
         _selectedNodes.removeAll(group);
+    removeSpatialItem(group->getItem());
 
     super_t::remove_group(group);
 }
@@ -1077,6 +1285,7 @@ bool    qan::Graph::groupNode(qan::Group* group, qan::Node* node, qan::TableCell
         return false;
     }
     try {
+        materializeNode(*node);     // Grouped nodes can't be virtual
         super_t::group_node(node, group);
         if (node->get_group() == group &&  // Check that group insertion succeed
             group->getGroupItem() != nullptr &&
@@ -1321,11 +1530,11 @@ void    addToSelectionImpl(QPointer<Primitive_t> primitive,
 
 void    Graph::addToSelection(qan::Node& node) {
     addToSelectionImpl<qan::Node>(QPointer<qan::Node>(&node), _selectedNodes, *this);
-    emit selectionChanged();
+    emitSelectionChanged();
 }
 void    Graph::addToSelection(qan::Group& group) {
     addToSelectionImpl<qan::Group>(&group, _selectedGroups, *this);
-    emit selectionChanged();
+    emitSelectionChanged();
 }
 void    Graph::addToSelection(qan::Edge& edge)
 {
@@ -1339,7 +1548,7 @@ void    Graph::addToSelection(qan::Edge& edge)
                 edge.getItem()->setSelectionItem(createSelectionItem(edge.getItem()));   // Safe, any argument might be nullptr
             // Note 20220329: primitive.getItem()->configureSelectionItem() is called from setSelectionItem()
         }
-        emit selectionChanged();
+        emitSelectionChanged();
     }
 }
 
@@ -1353,11 +1562,11 @@ void    removeFromSelectionImpl(QPointer<Primitive_t> primitive,
 
 void    Graph::removeFromSelection(qan::Node& node) {
     removeFromSelectionImpl<qan::Node>(&node, _selectedNodes);
-    emit selectionChanged();
+    emitSelectionChanged();
 }
 void    Graph::removeFromSelection(qan::Group& group) {
     removeFromSelectionImpl<qan::Group>(&group, _selectedGroups);
-    emit selectionChanged();
+    emitSelectionChanged();
 }
 
 // Note: Called from
@@ -1366,19 +1575,19 @@ void    Graph::removeFromSelection(QQuickItem* item) {
     if (nodeItem != nullptr &&
         nodeItem->getNode() != nullptr) {
         _selectedNodes.removeAll(nodeItem->getNode());
-        emit selectionChanged();
+        emitSelectionChanged();
     } else {
         const auto groupItem = qobject_cast<qan::GroupItem*>(item);
         if (groupItem != nullptr &&
             groupItem->getGroup() != nullptr) {
             _selectedGroups.removeAll(groupItem->getGroup());
-            emit selectionChanged();
+            emitSelectionChanged();
         } else {
             const auto edgeItem = qobject_cast<qan::EdgeItem*>(item);
             if (edgeItem != nullptr &&
                 edgeItem->getEdge() != nullptr) {
                 _selectedEdges.removeAll(edgeItem->getEdge());
-                emit selectionChanged();
+                emitSelectionChanged();
             }
         }
     }
@@ -1386,11 +1595,13 @@ void    Graph::removeFromSelection(QQuickItem* item) {
 
 void    Graph::selectAll()
 {
+    beginSelectionBatch();
     for (const auto node: get_nodes()) {
         if (node != nullptr)
             selectNode(*node, Qt::ControlModifier);
     }
-    emit selectionChanged();
+    emitSelectionChanged();
+    endSelectionBatch();
 }
 
 void    Graph::removeSelection()
@@ -1425,6 +1636,7 @@ void    Graph::clearSelection()
     // of _selectedNodes and _selectedGroups, a deep copy of theses
     // container is necessary to avoid iterating on a vector that
     // has changed while iterator has been modified.
+    beginSelectionBatch();
     SelectedNodes selectedNodesCopy;
     std::copy(_selectedNodes.cbegin(),
                _selectedNodes.cend(),
@@ -1455,7 +1667,32 @@ void    Graph::clearSelection()
             edge->getItem()->setSelected(false);
     _selectedEdges.clear();
 
-    emit selectionChanged();
+    emitSelectionChanged();
+    endSelectionBatch();
+}
+
+void    Graph::beginSelectionBatch() noexcept
+{
+    ++_selectionBatch;
+}
+
+void    Graph::endSelectionBatch()
+{
+    if (_selectionBatch <= 0)
+        return;
+    if (--_selectionBatch == 0 &&
+        _selectionBatchModified) {
+        _selectionBatchModified = false;
+        emit selectionChanged();
+    }
+}
+
+void    Graph::emitSelectionChanged()
+{
+    if (_selectionBatch > 0)
+        _selectionBatchModified = true;
+    else
+        emit selectionChanged();
 }
 
 bool    Graph::hasSelection() const
@@ -1753,7 +1990,12 @@ QPointer<QQuickItem> Graph::createDockFromDelegate(qan::NodeItem::Dock dock, qan
     if (dock == Dock::Left ||
         dock == Dock::Right) {
         if (_verticalDockDelegate) {
-            auto verticalDock = createItemFromComponent(_verticalDockDelegate.get());
+            auto verticalDock = acquirePooledItem(_verticalDockDelegate.get());
+            if (verticalDock == nullptr)
+                verticalDock = createItemFromComponent(_verticalDockDelegate.get());
+            if (verticalDock == nullptr)
+                return QPointer<QQuickItem>{nullptr};
+            verticalDock->setVisible(true);
             verticalDock->setParentItem(node.getItem());
             verticalDock->setProperty("hostNodeItem",
                                       QVariant::fromValue(node.getItem()));
@@ -1764,7 +2006,12 @@ QPointer<QQuickItem> Graph::createDockFromDelegate(qan::NodeItem::Dock dock, qan
     } else if (dock == Dock::Top ||
                dock == Dock::Bottom) {
         if (_horizontalDockDelegate) {
-            auto horizontalDock = createItemFromComponent(_horizontalDockDelegate.get());
+            auto horizontalDock = acquirePooledItem(_horizontalDockDelegate.get());
+            if (horizontalDock == nullptr)
+                horizontalDock = createItemFromComponent(_horizontalDockDelegate.get());
+            if (horizontalDock == nullptr)
+                return QPointer<QQuickItem>{nullptr};
+            horizontalDock->setVisible(true);
             horizontalDock->setParentItem(node.getItem());
             horizontalDock->setProperty("hostNodeItem",
                                         QVariant::fromValue(node.getItem()));
@@ -1928,6 +2175,1412 @@ void    Graph::updateMinZ(const qreal z) noexcept
 //-----------------------------------------------------------------------------
 
 
+/* Ortho Routing Management *///-----------------------------------------------
+bool    Graph::setOrthoRouting(bool orthoRouting) noexcept
+{
+    if (orthoRouting == _orthoRouting)
+        return false;
+    _orthoRouting = orthoRouting;
+    _orthoRouter.clear();
+    if (_orthoRouting) {
+        for (const auto node: get_nodes())
+            if (node != nullptr)
+                configureOrthoObstacle(*node);
+    }
+    emit orthoRoutingChanged();
+    routeOrthoEdges();  // Restore default ortho geometry when routing is disabled
+    return true;
+}
+
+void    Graph::routeOrthoEdges() noexcept
+{
+    for (const auto edge: get_edges()) {
+        const auto edgeItem = edge != nullptr ? edge->getItem() : nullptr;
+        if (edgeItem != nullptr &&
+            edgeItem->getStyle() != nullptr &&
+            edgeItem->getStyle()->getLineType() == qan::EdgeStyle::LineType::Ortho)
+            edgeItem->scheduleUpdateItem();
+    }
+}
+
+void    Graph::configureOrthoObstacle(qan::Node& node) noexcept
+{
+    // Note: Groups are not obstacles, but group geometry is monitored to update group nodes obstacles.
+    const auto nodeItem = node.getItem();
+    if (nodeItem == nullptr)
+        return;
+    connect(nodeItem,   &QQuickItem::xChanged,
+            this,       &qan::Graph::onOrthoObstacleModified, Qt::UniqueConnection);
+    connect(nodeItem,   &QQuickItem::yChanged,
+            this,       &qan::Graph::onOrthoObstacleModified, Qt::UniqueConnection);
+    connect(nodeItem,   &QQuickItem::widthChanged,
+            this,       &qan::Graph::onOrthoObstacleModified, Qt::UniqueConnection);
+    connect(nodeItem,   &QQuickItem::heightChanged,
+            this,       &qan::Graph::onOrthoObstacleModified, Qt::UniqueConnection);
+    connect(nodeItem,   &QQuickItem::visibleChanged,
+            this,       &qan::Graph::onOrthoObstacleModified, Qt::UniqueConnection);
+    updateOrthoObstacle(node);
+}
+
+void    Graph::updateOrthoObstacle(qan::Node& node) noexcept
+{
+    if (!_orthoRouting ||
+        getContainerItem() == nullptr)
+        return;
+    const auto group = qobject_cast<qan::Group*>(&node);
+    if (group != nullptr) {
+        for (const auto groupNode: collectGroupsNodes(QVector<const qan::Group*>{group}))
+            if (groupNode != nullptr &&
+                groupNode->getItem() != nullptr &&
+                !groupNode->isGroup())
+                updateOrthoObstacle(*const_cast<qan::Node*>(groupNode));
+        return;
+    }
+    const auto nodeItem = node.getItem();
+    if (nodeItem == nullptr)
+        return;
+    const auto routes = nodeItem->isVisible() ? _orthoRouter.updateObstacle(&node, nodeItem->mapRectToItem(getContainerItem(),
+                                                                                                            QRectF{0., 0., nodeItem->width(), nodeItem->height()})) :
+                                                _orthoRouter.removeObstacle(&node);
+    // Note: Router routes are keyed by qan::Edge (see qan::EdgeItem::generateRoutedOrthoEnds()).
+    for (const auto route: routes) {
+        const auto edge = const_cast<qan::Edge*>(static_cast<const qan::Edge*>(route));
+        if (edge != nullptr &&
+            edge->getItem() != nullptr)
+            edge->getItem()->scheduleUpdateItem();
+    }
+}
+
+void    Graph::onOrthoObstacleModified()
+{
+    // Note: x, y, width and height notifications are coalesced in one obstacle update per frame, run
+    // with high priority before scheduled edges updates.
+    const auto nodeItem = qobject_cast<qan::NodeItem*>(sender());
+    const auto node = nodeItem != nullptr ? nodeItem->getNode() : nullptr;
+    if (node == nullptr)
+        return;
+    _frameScheduler.schedule(node, [this, node = QPointer<qan::Node>{node}]() {
+        if (node)
+            updateOrthoObstacle(*node);
+    }, qan::FrameScheduler::Priority::High);
+}
+//-----------------------------------------------------------------------------
+
+
+/* Spatial Index Management *///-----------------------------------------------
+std::vector<QQuickItem*>    Graph::queryItems(const QRectF& rect) const noexcept
+{
+    std::vector<qan::SpatialIndex::Key> keys;
+    _spatialIndex.query(rect, keys);
+    std::vector<QQuickItem*> items;
+    items.reserve(keys.size());
+    // Note: Index keys are QObject pointers of alive items (items are removed from index on destruction).
+    for (const auto key: keys) {
+        const auto item = qobject_cast<QQuickItem*>(const_cast<QObject*>(static_cast<const QObject*>(key)));
+        if (item != nullptr)
+            items.push_back(item);
+    }
+    return items;
+}
+
+QQuickItem* Graph::edgeItemAt(const QPointF& point) const noexcept
+{
+    const auto edgeItems = edgeItemsAt(std::vector<QPointF>{point});
+    return edgeItems.empty() ? nullptr : edgeItems.front();
+}
+
+std::vector<qan::EdgeItem*> Graph::edgeItemsAt(const std::vector<QPointF>& points) const noexcept
+{
+    // Algorithm:
+    // 1. For each point, query spatial index with a rect inflated by edge hit distance (edges
+    //    hit area might extend out of their bounding rect).
+    // 2. Hit test candidate edge items line with qan::EdgeItem::contains().
+    // 3. Keep top most hit edge: edges are painted ordered by z, then by container childs order.
+    std::vector<qan::EdgeItem*> edgeItems(points.size(), nullptr);
+    const auto containerItem = getContainerItem();
+    if (containerItem == nullptr)
+        return edgeItems;
+    static constexpr qreal d = qan::EdgeItem::hitDistance;
+    std::vector<qan::SpatialIndex::Key> keys;
+    QList<QQuickItem*> childs;      // Lazily initialized, only for edges with equal z
+    for (std::size_t p = 0; p < points.size(); p++) {
+        // 1.
+        const auto& point = points[p];
+        keys.clear();
+        _spatialIndex.query(QRectF{point.x() - d, point.y() - d, 2. * d, 2. * d}, keys);
+
+        qan::EdgeItem* topMost = nullptr;
+        for (const auto key : keys) {
+            // 2.
+            const auto edgeItem = qobject_cast<qan::EdgeItem*>(const_cast<QObject*>(static_cast<const QObject*>(key)));
+            if (edgeItem == nullptr ||
+                edgeItem->getHidden() ||
+                edgeItem->getCulled() ||    // Culled edges geometry is not up to date
+                !edgeItem->contains(edgeItem->mapFromItem(containerItem, point)))
+                continue;
+            // 3.
+            if (topMost == nullptr ||
+                edgeItem->z() > topMost->z())
+                topMost = edgeItem;
+            else if (qFuzzyCompare(1. + edgeItem->z(), 1. + topMost->z())) {
+                if (childs.isEmpty())
+                    childs = containerItem->childItems();
+                if (childs.indexOf(edgeItem) > childs.indexOf(topMost))
+                    topMost = edgeItem;
+            }
+        }
+        edgeItems[p] = topMost;
+    }
+    return edgeItems;
+}
+
+void    Graph::configureSpatialItem(QQuickItem& item) noexcept
+{
+    connect(&item,  &QQuickItem::xChanged,
+            this,   &qan::Graph::onSpatialItemModified, Qt::UniqueConnection);
+    connect(&item,  &QQuickItem::yChanged,
+            this,   &qan::Graph::onSpatialItemModified, Qt::UniqueConnection);
+    connect(&item,  &QQuickItem::widthChanged,
+            this,   &qan::Graph::onSpatialItemModified, Qt::UniqueConnection);
+    connect(&item,  &QQuickItem::heightChanged,
+            this,   &qan::Graph::onSpatialItemModified, Qt::UniqueConnection);
+    connect(&item,  &QQuickItem::visibleChanged,
+            this,   &qan::Graph::onSpatialItemModified, Qt::UniqueConnection);
+    connect(&item,  &QQuickItem::parentChanged,
+            this,   &qan::Graph::onSpatialItemModified, Qt::UniqueConnection);
+    connect(&item,  &QObject::destroyed,
+            this,   &qan::Graph::onSpatialItemDestroyed, Qt::UniqueConnection);
+    const auto groupItem = qobject_cast<qan::GroupItem*>(&item);
+    if (groupItem != nullptr) {
+        connect(groupItem,  &qan::GroupItem::collapsedChanged,
+                this,       &qan::Graph::onSpatialItemModified, Qt::UniqueConnection);
+    }
+    updateSpatialItem(item);
+}
+
+void    Graph::updateSpatialItem(QQuickItem& item) noexcept
+{
+    const auto containerItem = getContainerItem();
+    if (containerItem == nullptr)
+        return;
+    const auto updateRect = [this, containerItem](QQuickItem& item) {
+        const auto key = static_cast<const QObject*>(&item);
+        const auto groupItem = qobject_cast<const qan::GroupItem*>(&item);
+        if (item.isVisible() ||
+            isItemCulled(item)) {       // Culled visible items are kept in index to be restored when they enter cull rect
+            const auto nodeItem = qobject_cast<qan::NodeItem*>(&item);
+            const auto itemRect = QRectF{0., 0., item.width(), item.height()};
+            const auto rect = nodeItem != nullptr ? nodeItem->getGlobalTransform(containerItem).mapRect(itemRect) :
+                                                    item.mapRectToItem(containerItem, itemRect);
+            _spatialIndex.insert(key, rect);
+            if (nodeItem != nullptr &&
+                nodeItem->getNode() != nullptr)
+                updateVirtualEdgesRects(*nodeItem->getNode());
+            if (groupItem != nullptr &&
+                !groupItem->getCollapsed())
+                _groupsIndex.insert(key, rect);
+            else
+                _groupsIndex.remove(key);
+            updateItemCulling(item);
+        } else {
+            _spatialIndex.remove(key);
+            _groupsIndex.remove(key);
+            // Note: An hidden item is no longer culled, it is indexed and culled again when shown.
+            if (_culledItems.erase(key) > 0)
+                setItemCulled(item, false);
+        }
+    };
+    updateRect(item);
+
+    // Grouped items rects are expressed in container CS, update them when group geometry change.
+    const auto groupItem = qobject_cast<qan::GroupItem*>(&item);
+    if (groupItem != nullptr &&
+        groupItem->getGroup() != nullptr) {
+        for (const auto groupNode: collectGroupsNodes(QVector<const qan::Group*>{groupItem->getGroup()}))
+            if (groupNode != nullptr &&
+                groupNode->getItem() != nullptr)
+                updateRect(*const_cast<qan::NodeItem*>(groupNode->getItem()));
+    }
+    if (_lodLevel != LodLevel::Full)
+        emit lodGeometryChanged();
+}
+
+void    Graph::removeSpatialItem(const QQuickItem* item) noexcept
+{
+    if (item != nullptr)
+        onSpatialItemDestroyed(const_cast<QQuickItem*>(item));
+}
+
+void    Graph::onSpatialItemModified()
+{
+    const auto item = qobject_cast<QQuickItem*>(sender());
+    if (item != nullptr)
+        updateSpatialItem(*item);
+}
+
+void    Graph::onSpatialItemDestroyed(QObject* item)
+{
+    const auto key = static_cast<const QObject*>(item);
+    _spatialIndex.remove(key);
+    _groupsIndex.remove(key);
+    _culledItems.erase(key);
+    if (_lodLevel != LodLevel::Full)
+        emit lodGeometryChanged();
+}
+//-----------------------------------------------------------------------------
+
+
+/* Viewport Culling Management *///--------------------------------------------
+void    Graph::setCullRect(const QRectF& cullRect) noexcept
+{
+    // Algorithm:
+    // 1. Empty cull rect: culling is disabled, restore all culled items (unless level of detail is not full).
+    // 2. Culling was disabled: visit all node, group and edge items.
+    // 3. Otherwise, visit only items intersecting previous cull rect (candidates for culling)
+    //    or new cull rect (candidates for restoration). At low level of detail, all items are
+    //    already culled.
+    const auto previousCullRect = _cullRect;
+    _cullRect = cullRect;
+
+    // 1.
+    if (_cullRect.isEmpty() &&
+        _lodLevel == LodLevel::Full)
+        restoreCulledItems();
+
+    // 2.
+    else if (previousCullRect.isEmpty() ||
+             _cullRect.isEmpty())
+        updateCulling();
+
+    // 3.
+    else if (_lodLevel == LodLevel::Full) {
+        auto items = queryItems(previousCullRect);
+        const auto cullRectItems = queryItems(_cullRect);
+        items.insert(items.end(), cullRectItems.cbegin(), cullRectItems.cend());
+        for (const auto item : items)
+            updateItemCulling(*item);
+    }
+    if (_lodLevel != LodLevel::Full)
+        emit lodGeometryChanged();
+    if (_virtualized)
+        updateVirtualization();
+}
+
+void    Graph::restoreCulledItems() noexcept
+{
+    const auto culledItems = std::move(_culledItems);
+    _culledItems.clear();
+    for (const auto key : culledItems) {
+        const auto item = qobject_cast<QQuickItem*>(const_cast<QObject*>(key));
+        if (item != nullptr)
+            setItemCulled(*item, false);
+    }
+}
+
+void    Graph::updateCulling() noexcept
+{
+    // Note: Group items are visited after regular nodes, culling a group hide its nodes, that
+    // would then be removed from spatial index before being culled.
+    for (const auto node : get_nodes())
+        if (node != nullptr &&
+            !node->isGroup() &&
+            node->getItem() != nullptr)
+            updateItemCulling(*node->getItem());
+    for (const auto group : get_groups())
+        if (group != nullptr &&
+            group->getItem() != nullptr)
+            updateItemCulling(*group->getItem());
+    for (const auto edge : get_edges())
+        if (edge != nullptr &&
+            edge->getItem() != nullptr)
+            updateItemCulling(*edge->getItem());
+}
+
+void    Graph::updateItemCulling(QQuickItem& item) noexcept
+{
+    if (_cullRect.isEmpty() &&
+        _lodLevel == LodLevel::Full)
+        return;
+    const auto key = static_cast<const QObject*>(&item);
+    const auto itemRect = _spatialIndex.getRect(key);
+    if (itemRect == nullptr)    // Not indexed, item is either invisible or inside a culled group
+        return;
+    auto rect = *itemRect;
+    // Edges culling is decided from their source and destination rects: it is independent of
+    // edge geometry, that is not generated while the edge is culled.
+    const auto edgeItem = qobject_cast<const qan::EdgeItem*>(&item);
+    const auto edge = edgeItem != nullptr ? edgeItem->getEdge() : nullptr;
+    if (edge != nullptr &&
+        edge->get_src() != nullptr &&
+        edge->get_dst() != nullptr) {
+        const auto srcRect = _spatialIndex.getRect(static_cast<const QObject*>(edge->get_src()->getItem()));
+        const auto dstRect = _spatialIndex.getRect(static_cast<const QObject*>(edge->get_dst()->getItem()));
+        if (srcRect != nullptr &&
+            dstRect != nullptr)
+            rect = srcRect->united(*dstRect);
+    }
+    // Note: Do not use QRectF::intersects(), it return false for empty rects (horizontal or vertical edges).
+    // Note: All items are culled at low level of detail.
+    const bool culled = _lodLevel != LodLevel::Full ||
+                        (!_cullRect.isEmpty() &&
+                         (rect.left() > _cullRect.right() || rect.right() < _cullRect.left() ||
+                          rect.top() > _cullRect.bottom() || rect.bottom() < _cullRect.top()));
+    // Note: Culled items set is updated before item, restoring an edge update its geometry and
+    // might recursively update its culling state.
+    if (culled)
+        _culledItems.insert(key);
+    else
+        _culledItems.erase(key);
+    if (!setItemCulled(item, culled))
+        _culledItems.erase(key);
+}
+
+bool    Graph::setItemCulled(QQuickItem& item, bool culled) noexcept
+{
+    const auto nodeItem = qobject_cast<qan::NodeItem*>(&item);
+    if (nodeItem != nullptr) {
+        nodeItem->setCulled(culled);
+        return true;
+    }
+    const auto edgeItem = qobject_cast<qan::EdgeItem*>(&item);
+    if (edgeItem != nullptr) {
+        edgeItem->setCulled(culled);
+        return true;
+    }
+    return false;
+}
+
+bool    Graph::isItemCulled(const QQuickItem& item) noexcept
+{
+    const auto nodeItem = qobject_cast<const qan::NodeItem*>(&item);
+    if (nodeItem != nullptr)
+        return nodeItem->getCulled() && nodeItem->getCulledVisible();
+    const auto edgeItem = qobject_cast<const qan::EdgeItem*>(&item);
+    return edgeItem != nullptr ? edgeItem->getCulled() && edgeItem->getCulledVisible() : false;
+}
+//-----------------------------------------------------------------------------
+
+
+/* Delegate Virtualization Management *///-------------------------------------
+void    Graph::setVirtualized(bool virtualized) noexcept
+{
+    if (virtualized == _virtualized)
+        return;
+    _virtualized = virtualized;
+    if (!_virtualized &&
+        !_asynchronous) {    // Materialize all virtual nodes (and their edges)
+        for (const auto node : get_nodes())
+            if (node != nullptr &&
+                node->getItem() == nullptr)
+                materializeNode(*node);
+    } else
+        scheduleVirtualizationUpdate();     // Note: When asynchronous, virtual nodes are incubated
+    emit virtualizedChanged();
+}
+
+void    Graph::setNodeGeometry(qan::Node* node, const QRectF& rect) noexcept
+{
+    if (node == nullptr)
+        return;
+    const auto nodeItem = node->getItem();
+    if (nodeItem != nullptr) {
+        nodeItem->setPosition(rect.topLeft());
+        if (!rect.isEmpty())
+            nodeItem->setSize(rect.size());
+        return;
+    }
+    const auto key = static_cast<const QObject*>(node);
+    if (_virtualPrimitives.find(key) == _virtualPrimitives.end())
+        return;
+    auto virtualRect = rect;
+    if (virtualRect.isEmpty()) {    // Preserve previous virtual node size
+        const auto previousRect = _virtualNodesIndex.getRect(key);
+        if (previousRect != nullptr)
+            virtualRect.setSize(previousRect->size());
+    }
+    _virtualNodesIndex.insert(key, virtualRect);
+    updateVirtualEdgesRects(*node);
+    if (_lodLevel != LodLevel::Full)
+        emit lodGeometryChanged();
+    scheduleVirtualizationUpdate();
+}
+
+QRectF  Graph::getNodeGeometry(qan::Node* node) const noexcept
+{
+    if (node == nullptr)
+        return QRectF{};
+    const auto nodeItem = node->getItem();
+    if (nodeItem != nullptr)
+        return QRectF{nodeItem->position(), QSizeF{nodeItem->width(), nodeItem->height()}};
+    const auto rect = _virtualNodesIndex.getRect(static_cast<const QObject*>(node));
+    return rect != nullptr ? *rect : QRectF{};
+}
+
+bool    Graph::isVirtualNode(const qan::Node* node) const noexcept
+{
+    return node != nullptr &&
+           _virtualPrimitives.find(static_cast<const QObject*>(node)) != _virtualPrimitives.end();
+}
+
+bool    Graph::virtualizeNode(qan::Node& node, QQmlComponent& component, qan::NodeStyle& style) noexcept
+{
+    if ((!_virtualized && !_asynchronous) ||
+        node.isGroup())
+        return false;
+    const auto key = static_cast<const QObject*>(&node);
+    _virtualPrimitives[key] = VirtualPrimitive{&component, &style, nextMaxZ()};
+    _virtualNodesIndex.insert(key, QRectF{});
+    connect(&node,  &QObject::destroyed,
+            this,   &qan::Graph::onVirtualPrimitiveDestroyed, Qt::UniqueConnection);
+    scheduleVirtualizationUpdate();
+    return true;
+}
+
+bool    Graph::virtualizeEdge(qan::Edge& edge, QQmlComponent& component, qan::EdgeStyle& style,
+                              qan::Node& src, qan::Node* dst) noexcept
+{
+    if ((!_virtualized && !_asynchronous) ||
+        dst == nullptr)     // Note: hyper edges are never virtual
+        return false;
+    if (!isVirtualNode(&src) &&
+        !isVirtualNode(dst))
+        return false;
+    edge.set_src(&src);
+    edge.set_dst(dst);
+    _virtualPrimitives[static_cast<const QObject*>(&edge)] = VirtualPrimitive{&component, &style, 0.};
+    updateVirtualEdgeRect(edge);
+    connect(&edge,  &QObject::destroyed,
+            this,   &qan::Graph::onVirtualPrimitiveDestroyed, Qt::UniqueConnection);
+    return true;
+}
+
+bool    Graph::isVirtualizable(const qan::Node& node) const noexcept
+{
+    if (!_virtualized ||
+        node.isGroup() ||
+        node.get_group() != nullptr)
+        return false;
+    const auto nodeItem = node.getItem();
+    return nodeItem == nullptr ||
+           (!nodeItem->getSelected() &&
+            nodeItem->getPorts().size() == 0);
+}
+
+void    Graph::materializeNode(qan::Node& node) noexcept
+{
+    const auto primitive = _virtualPrimitives.find(static_cast<const QObject*>(&node));
+    if (primitive == _virtualPrimitives.end())
+        return;
+    const auto component = primitive->second.component;
+    const auto style = qobject_cast<qan::NodeStyle*>(primitive->second.style.data());
+    if (!component ||
+        style == nullptr)
+        return;
+    // Note: A pooled item is reused if available.
+    const auto nodeItem = qobject_cast<qan::NodeItem*>(createFromComponent(component.data(), *style, &node));
+    if (nodeItem == nullptr) {
+        qWarning() << "qan::Graph::materializeNode(): Error: Node creation from QML delegate failed.";
+        return;
+    }
+    configureVirtualNodeItem(node, *nodeItem);
+}
+
+void    Graph::materializeEdge(qan::Edge& edge) noexcept
+{
+    const auto primitive = _virtualPrimitives.find(static_cast<const QObject*>(&edge));
+    if (primitive == _virtualPrimitives.end())
+        return;
+    const auto src = edge.get_src();
+    const auto dst = edge.get_dst();
+    if (src == nullptr || src->getItem() == nullptr ||
+        dst == nullptr || dst->getItem() == nullptr)
+        return;     // Edge stay virtual until both its source and destination are materialized
+    const auto component = primitive->second.component;
+    const auto style = qobject_cast<qan::EdgeStyle*>(primitive->second.style.data());
+    if (!component ||
+        style == nullptr)
+        return;
+    const auto edgeItem = qobject_cast<qan::EdgeItem*>(createFromComponent(component.data(), *style, nullptr, &edge));
+    if (edgeItem == nullptr) {
+        qWarning() << "qan::Graph::materializeEdge(): Error: Edge creation from QML delegate failed.";
+        return;
+    }
+    configureVirtualEdgeItem(edge, *edgeItem);
+}
+
+bool    Graph::configureVirtualNodeItem(qan::Node& node, qan::NodeItem& nodeItem) noexcept
+{
+    // Algorithm:
+    // 1. Configure node item like in insertNode() and restore its virtual geometry.
+    // 2. Materialize (or incubate) node virtual edges (edges with both source and destination items).
+    const auto key = static_cast<const QObject*>(&node);
+    const auto primitive = _virtualPrimitives.find(key);
+    if (primitive == _virtualPrimitives.end())
+        return false;
+    const auto z = primitive->second.z;
+    const auto rectPtr = _virtualNodesIndex.getRect(key);
+    const auto rect = rectPtr != nullptr ? *rectPtr : QRectF{};
+    _virtualPrimitives.erase(primitive);
+    _virtualNodesIndex.remove(key);
+    _incubatingPrimitives.erase(key);
+    disconnect(&node, &QObject::destroyed,
+               this,  &qan::Graph::onVirtualPrimitiveDestroyed);
+
+    // 1.
+    node.setItem(&nodeItem);
+    nodeItem.setGraph(this);
+    connectNodeItem(nodeItem);
+    nodeItem.setZ(z);
+    nodeItem.setPosition(rect.topLeft());
+    if (!rect.isEmpty())
+        nodeItem.setSize(rect.size());
+    configureSpatialItem(nodeItem);
+    if (_orthoRouting)
+        configureOrthoObstacle(node);
+
+    // 2.
+    const auto materializeVirtualEdge = [this](qan::Edge* edge) {
+        if (edge == nullptr)
+            return;
+        if (_asynchronous)
+            incubatePrimitive(*edge);
+        else
+            materializeEdge(*edge);
+    };
+    for (const auto inEdge : node.get_in_edges())
+        materializeVirtualEdge(inEdge);
+    for (const auto outEdge : node.get_out_edges())
+        materializeVirtualEdge(outEdge);
+    return true;
+}
+
+bool    Graph::configureVirtualEdgeItem(qan::Edge& edge, qan::EdgeItem& edgeItem) noexcept
+{
+    const auto key = static_cast<const QObject*>(&edge);
+    const auto primitive = _virtualPrimitives.find(key);
+    if (primitive == _virtualPrimitives.end())
+        return false;
+    const auto src = edge.get_src();
+    const auto dst = edge.get_dst();
+    if (src == nullptr || src->getItem() == nullptr ||
+        dst == nullptr || dst->getItem() == nullptr)
+        return false;
+    _virtualPrimitives.erase(primitive);
+    _virtualEdgesIndex.remove(key);
+    _incubatingPrimitives.erase(key);
+    disconnect(&edge, &QObject::destroyed,
+               this,  &qan::Graph::onVirtualPrimitiveDestroyed);
+    edgeItem.setGraph(this);
+    configureEdgeItem(edge, edgeItem, *src, dst);
+    return true;
+}
+
+bool    Graph::releaseNodeItem(qan::Node& node) noexcept
+{
+    // PRECONDITIONS:
+        // node must be virtualizable
+        // node item delegate must be known
+        // all node adjacent edges must be releasable
+    if (!isVirtualizable(node))
+        return false;
+    const auto nodeItem = node.getItem();
+    if (nodeItem == nullptr)
+        return false;
+    const auto style = nodeItem->getStyle();
+    const auto component = style != nullptr ? _styleManager.getStyleComponent(style) : nullptr;
+    if (component == nullptr)
+        return false;
+    const auto isEdgeReleasable = [this](qan::Edge* edge) -> bool {
+        if (edge == nullptr ||
+            edge->getItem() == nullptr)
+            return true;
+        const auto edgeItem = edge->getItem();
+        return !edgeItem->getSelected() &&
+               edgeItem->getStyle() != nullptr &&
+               edge->get_dst() != nullptr &&
+               _styleManager.getStyleComponent(edgeItem->getStyle()) != nullptr;
+    };
+    for (const auto inEdge : node.get_in_edges())
+        if (!isEdgeReleasable(inEdge))
+            return false;
+    for (const auto outEdge : node.get_out_edges())
+        if (!isEdgeReleasable(outEdge))
+            return false;
+
+    // Algorithm:
+    // 1. Release node adjacent edges items.
+    // 2. Save node item geometry, then park node item in delegates pool.
+    // 3. Register node as a virtual node.
+
+    // 1.
+    for (const auto inEdge : node.get_in_edges())
+        if (inEdge != nullptr)
+            releaseEdgeItem(*inEdge);
+    for (const auto outEdge : node.get_out_edges())
+        if (outEdge != nullptr)
+            releaseEdgeItem(*outEdge);
+
+    // 2.
+    const QRectF rect{nodeItem->position(), QSizeF{nodeItem->width(), nodeItem->height()}};
+    const auto z = nodeItem->z();
+    parkNodeItem(*nodeItem, *component);
+
+    // 3.
+    const auto key = static_cast<const QObject*>(&node);
+    _virtualPrimitives[key] = VirtualPrimitive{component, style, z};
+    _virtualNodesIndex.insert(key, rect);
+    updateVirtualEdgesRects(node);
+    connect(&node,  &QObject::destroyed,
+            this,   &qan::Graph::onVirtualPrimitiveDestroyed, Qt::UniqueConnection);
+    return true;
+}
+
+bool    Graph::releaseEdgeItem(qan::Edge& edge) noexcept
+{
+    const auto edgeItem = edge.getItem();
+    if (edgeItem == nullptr)
+        return false;
+    const auto style = edgeItem->getStyle();
+    const auto component = style != nullptr ? _styleManager.getStyleComponent(style) : nullptr;
+    if (component == nullptr)
+        return false;
+    parkEdgeItem(*edgeItem, *component);
+    _virtualPrimitives[static_cast<const QObject*>(&edge)] = VirtualPrimitive{component, style, 0.};
+    updateVirtualEdgeRect(edge);
+    connect(&edge,  &QObject::destroyed,
+            this,   &qan::Graph::onVirtualPrimitiveDestroyed, Qt::UniqueConnection);
+    return true;
+}
+
+QRectF  Graph::getVirtualizationRect(const qan::Node& node) const noexcept
+{
+    const auto nodeItem = node.getItem();
+    const auto rect = nodeItem != nullptr ? _spatialIndex.getRect(static_cast<const QObject*>(nodeItem)) :
+                                            _virtualNodesIndex.getRect(static_cast<const QObject*>(&node));
+    return rect != nullptr ? *rect : QRectF{};
+}
+
+void    Graph::updateVirtualEdgeRect(qan::Edge& edge) noexcept
+{
+    const auto key = static_cast<const QObject*>(&edge);
+    if (_virtualPrimitives.find(key) == _virtualPrimitives.end())
+        return;
+    const auto src = edge.get_src();
+    const auto dst = edge.get_dst();
+    if (src == nullptr ||
+        dst == nullptr)
+        return;
+    _virtualEdgesIndex.insert(key, getVirtualizationRect(*src).united(getVirtualizationRect(*dst)));
+}
+
+void    Graph::updateVirtualEdgesRects(qan::Node& node) noexcept
+{
+    if (_virtualEdgesIndex.getSize() == 0)
+        return;
+    for (const auto inEdge : node.get_in_edges())
+        if (inEdge != nullptr &&
+            inEdge->getItem() == nullptr)
+            updateVirtualEdgeRect(*inEdge);
+    for (const auto outEdge : node.get_out_edges())
+        if (outEdge != nullptr &&
+            outEdge->getItem() == nullptr)
+            updateVirtualEdgeRect(*outEdge);
+}
+
+bool    Graph::isEdgeInCullRect(const qan::Edge& edge) const noexcept
+{
+    if (_cullRect.isEmpty())
+        return true;
+    const auto src = edge.get_src();
+    const auto dst = edge.get_dst();
+    if (src == nullptr ||
+        dst == nullptr)
+        return false;
+    const auto rect = getVirtualizationRect(*src).united(getVirtualizationRect(*dst));
+    // Note: Do not use QRectF::intersects(), it return false for empty rects (horizontal or vertical edges).
+    return rect.left() <= _cullRect.right() && _cullRect.left() <= rect.right() &&
+           rect.top() <= _cullRect.bottom() && _cullRect.top() <= rect.bottom();
+}
+
+void    Graph::scheduleVirtualizationUpdate() noexcept
+{
+    if (_virtualizationUpdateScheduled)
+        return;
+    _virtualizationUpdateScheduled = true;
+    QMetaObject::invokeMethod(this, &qan::Graph::updateVirtualization, Qt::QueuedConnection);
+}
+
+void    Graph::updateVirtualization() noexcept
+{
+    // Algorithm:
+    // 1. Release culled node items that could be virtualized, unless one of their edges crosses
+    //    cull rect.
+    // 2. Materialize (or incubate when asynchronous) virtual nodes intersecting cull rect (or all
+    //    virtual nodes when there is no cull rect or when virtualization is disabled). Nothing is
+    //    materialized at low level of detail.
+    // 3. Materialize virtual edges crossing cull rect and their virtual source or destination.
+    _virtualizationUpdateScheduled = false;
+    if (!_virtualized &&
+        !_asynchronous)
+        return;
+
+    // 1.
+    if (_virtualized &&
+        !_cullRect.isEmpty()) {
+        const auto hasEdgeInCullRect = [this](const qan::Node& node) -> bool {
+            for (const auto inEdge : node.get_in_edges())
+                if (inEdge != nullptr &&
+                    isEdgeInCullRect(*inEdge))
+                    return true;
+            for (const auto outEdge : node.get_out_edges())
+                if (outEdge != nullptr &&
+                    isEdgeInCullRect(*outEdge))
+                    return true;
+            return false;
+        };
+        const std::vector<const QObject*> culledItems(_culledItems.cbegin(), _culledItems.cend());
+        for (const auto key : culledItems) {
+            const auto nodeItem = qobject_cast<qan::NodeItem*>(const_cast<QObject*>(key));
+            if (nodeItem != nullptr &&
+                nodeItem->getNode() != nullptr &&
+                qobject_cast<qan::GroupItem*>(nodeItem) == nullptr &&
+                !hasEdgeInCullRect(*nodeItem->getNode()))
+                releaseNodeItem(*nodeItem->getNode());
+        }
+    }
+
+    // 2.
+    if (_lodLevel != LodLevel::Full)    // Items are not rendered at low level of detail
+        return;
+    std::vector<qan::SpatialIndex::Key> keys;
+    if (!_virtualized ||
+        _cullRect.isEmpty()) {
+        keys.reserve(_virtualPrimitives.size());
+        for (const auto& primitive : _virtualPrimitives)
+            keys.push_back(primitive.first);
+    } else
+        _virtualNodesIndex.query(_cullRect, keys);
+    for (const auto key : keys) {
+        // Note: keys might contains edges, only nodes are indexed in _virtualNodesIndex
+        const auto node = qobject_cast<qan::Node*>(const_cast<QObject*>(static_cast<const QObject*>(key)));
+        if (node == nullptr ||
+            _virtualNodesIndex.getRect(key) == nullptr)
+            continue;
+        if (_asynchronous)
+            incubatePrimitive(*node);
+        else
+            materializeNode(*node);
+    }
+
+    // 3.
+    if (!_virtualized ||
+        _cullRect.isEmpty())
+        return;     // All virtual nodes, and then their edges, have been materialized
+    const auto materialize = [this](QObject& primitive) {
+        const auto node = qobject_cast<qan::Node*>(&primitive);
+        if (_asynchronous)
+            incubatePrimitive(primitive);
+        else if (node != nullptr)
+            materializeNode(*node);
+        else
+            materializeEdge(*qobject_cast<qan::Edge*>(&primitive));
+    };
+    keys.clear();
+    _virtualEdgesIndex.query(_cullRect, keys);
+    for (const auto key : keys) {
+        const auto edge = qobject_cast<qan::Edge*>(const_cast<QObject*>(static_cast<const QObject*>(key)));
+        if (edge == nullptr ||
+            edge->get_src() == nullptr ||
+            edge->get_dst() == nullptr ||
+            !isEdgeInCullRect(*edge))
+            continue;
+        // Note: Edge is also materialized when its last virtual end is materialized.
+        const auto src = edge->get_src();
+        const auto dst = edge->get_dst();
+        if (src->getItem() == nullptr)
+            materialize(*src);
+        if (dst->getItem() == nullptr)
+            materialize(*dst);
+        if (src->getItem() != nullptr &&
+            dst->getItem() != nullptr)
+            materialize(*edge);
+    }
+}
+
+void    Graph::onVirtualPrimitiveDestroyed(QObject* primitive)
+{
+    const auto key = static_cast<const QObject*>(primitive);
+    _virtualPrimitives.erase(key);
+    _virtualNodesIndex.remove(key);
+    _virtualEdgesIndex.remove(key);
+    if (_incubatingPrimitives.erase(key) > 0)
+        updateItemsPending();
+}
+//-----------------------------------------------------------------------------
+
+
+/* Delegates Pool Management *///----------------------------------------------
+void    Graph::setDelegatesPoolCapacity(int delegatesPoolCapacity) noexcept
+{
+    delegatesPoolCapacity = std::max(0, delegatesPoolCapacity);
+    if (delegatesPoolCapacity != _delegatesPoolCapacity) {
+        _delegatesPoolCapacity = delegatesPoolCapacity;
+        emit delegatesPoolCapacityChanged();
+    }
+}
+
+int     Graph::prewarmDelegate(QQmlComponent* component, int count) noexcept
+{
+    if (component == nullptr) {
+        qWarning() << "qan::Graph::prewarmDelegate(): Error called with a nullptr delegate component.";
+        return 0;
+    }
+    for (int i = 0; i < count; i++) {
+        const auto item = createItemFromComponent(component);
+        if (item == nullptr)
+            break;
+        item->setVisible(false);
+        releasePooledItem(component, *item);
+    }
+    return getPooledItemsCount(component);
+}
+
+int     Graph::getPooledItemsCount(QQmlComponent* component) const noexcept
+{
+    const auto pool = _delegatesPool.find(component);
+    if (pool == _delegatesPool.end())
+        return 0;
+    return static_cast<int>(std::count_if(pool->second.cbegin(), pool->second.cend(),
+                                          [](const auto& item) { return !item.isNull(); }));
+}
+
+void    Graph::clearDelegatesPool() noexcept
+{
+    for (auto& pool : _delegatesPool)
+        for (auto& item : pool.second)
+            if (item)
+                item->deleteLater();
+    _delegatesPool.clear();
+}
+
+QQuickItem* Graph::acquirePooledItem(const QQmlComponent* component) noexcept
+{
+    const auto pool = _delegatesPool.find(component);
+    if (pool == _delegatesPool.end())
+        return nullptr;
+    auto& items = pool->second;
+    while (!items.empty()) {
+        const auto item = items.back();
+        items.pop_back();
+        if (item)
+            return item.data();
+    }
+    return nullptr;
+}
+
+void    Graph::releasePooledItem(QQmlComponent* component, QQuickItem& item) noexcept
+{
+    if (component == nullptr)
+        return;
+    connect(component,  &QObject::destroyed,
+            this,       &qan::Graph::onPooledComponentDestroyed, Qt::UniqueConnection);
+    _delegatesPool[component].push_back(QPointer<QQuickItem>{&item});
+}
+
+bool    Graph::isPoolAvailable(QQmlComponent* component) const noexcept
+{
+    return component != nullptr &&
+           getPooledItemsCount(component) < _delegatesPoolCapacity;
+}
+
+void    Graph::parkNodeItem(qan::NodeItem& nodeItem, QQmlComponent& component) noexcept
+{
+    nodeItem.setSelected(false);
+    removeSpatialItem(&nodeItem);
+    disconnect(&nodeItem, nullptr, this, nullptr);
+    nodeItem.setCulled(false);
+    nodeItem.setVisible(false);
+    nodeItem.setParentItem(getContainerItem());     // Node item might be inside a group
+    nodeItem.resetForPool();
+    const auto node = nodeItem.getNode();
+    if (node != nullptr &&
+        node->getItem() == &nodeItem)
+        node->setItem(nullptr);
+    if (isPoolAvailable(&component))
+        releasePooledItem(&component, nodeItem);
+    else
+        nodeItem.deleteLater();     // Pool is full, item is hidden and detached, destroy it
+}
+
+void    Graph::parkEdgeItem(qan::EdgeItem& edgeItem, QQmlComponent& component) noexcept
+{
+    edgeItem.setSelected(false);
+    removeSpatialItem(&edgeItem);
+    if (_edgeLayer)
+        _edgeLayer->removeEdge(edgeItem);
+    disconnect(&edgeItem, nullptr, this, nullptr);
+    edgeItem.detachItems();     // Note: detach before restoring visibility to avoid a useless geometry update
+    edgeItem.setCulled(false);
+    edgeItem.setVisible(false);
+    edgeItem.setParentItem(getContainerItem());
+    edgeItem.resetForPool();
+    const auto edge = edgeItem.getEdge();
+    if (edge != nullptr &&
+        edge->getItem() == &edgeItem)
+        edge->setItem(nullptr);
+    if (isPoolAvailable(&component))
+        releasePooledItem(&component, edgeItem);
+    else
+        edgeItem.deleteLater();     // Pool is full, item is hidden and detached, destroy it
+}
+
+void    Graph::recycleNodeItem(qan::Node& node) noexcept
+{
+    // Algorithm:
+    // 1. Recycle node adjacent edges items (they are removed with node).
+    // 2. Park node item if it is a regular node item without ports.
+    // 3. Otherwise, node item will be destroyed with node: park its selection and dock items.
+
+    // 1.
+    for (const auto inEdge : node.get_in_edges())
+        if (inEdge != nullptr)
+            recycleEdgeItem(*inEdge);
+    for (const auto outEdge : node.get_out_edges())
+        if (outEdge != nullptr)
+            recycleEdgeItem(*outEdge);
+
+    const auto nodeItem = node.getItem();
+    if (nodeItem == nullptr)
+        return;
+
+    // 2.
+    const auto style = nodeItem->getStyle();
+    const auto component = style != nullptr ? _styleManager.getStyleComponent(style) : nullptr;
+    if (!node.isGroup() &&
+        nodeItem->getPorts().size() == 0 &&
+        isPoolAvailable(component)) {
+        parkNodeItem(*nodeItem, *component);
+        return;
+    }
+
+    // 3.
+    if (isPoolAvailable(_selectionDelegate.get())) {
+        const auto selectionItem = nodeItem->takeSelectionItem();
+        if (selectionItem != nullptr) {
+            selectionItem->setVisible(false);
+            selectionItem->setState("UNSELECTED");
+            selectionItem->setParentItem(getContainerItem());
+            releasePooledItem(_selectionDelegate.get(), *selectionItem);
+        }
+    }
+    using Dock = qan::NodeItem::Dock;
+    for (const auto dock : {Dock::Left, Dock::Top, Dock::Right, Dock::Bottom}) {
+        const auto dockItem = nodeItem->getDock(dock);
+        const auto dockComponent = dock == Dock::Left || dock == Dock::Right ? _verticalDockDelegate.get() :
+                                                                               _horizontalDockDelegate.get();
+        if (dockItem == nullptr ||
+            !isPoolAvailable(dockComponent))
+            continue;
+        for (const auto port : nodeItem->getPorts())    // Ports are destroyed with node item
+            if (port != nullptr &&
+                port->parentItem() == dockItem)
+                port->setParentItem(nodeItem);
+        nodeItem->setDock(dock, nullptr);
+        dockItem->setVisible(false);
+        dockItem->setParentItem(getContainerItem());
+        dockItem->setProperty("hostNodeItem", QVariant::fromValue<QObject*>(nullptr));
+        releasePooledItem(dockComponent, *dockItem);
+    }
+}
+
+bool    Graph::recycleEdgeItem(qan::Edge& edge) noexcept
+{
+    const auto edgeItem = edge.getItem();
+    if (edgeItem == nullptr)
+        return false;
+    const auto style = edgeItem->getStyle();
+    const auto component = style != nullptr ? _styleManager.getStyleComponent(style) : nullptr;
+    if (!isPoolAvailable(component))
+        return false;
+    parkEdgeItem(*edgeItem, *component);
+    return true;
+}
+
+void    Graph::onPooledComponentDestroyed(QObject* component)
+{
+    const auto pool = _delegatesPool.find(static_cast<const QQmlComponent*>(component));
+    if (pool == _delegatesPool.end())
+        return;
+    for (auto& item : pool->second)
+        if (item)
+            item->deleteLater();
+    _delegatesPool.erase(pool);
+}
+//-----------------------------------------------------------------------------
+
+
+/* Asynchronous Incubation Management *///-------------------------------------
+void    Graph::setAsynchronous(bool asynchronous) noexcept
+{
+    if (asynchronous == _asynchronous)
+        return;
+    _asynchronous = asynchronous;
+    if (!_asynchronous) {
+        cancelIncubations();
+        if (!_virtualized) {    // Create all pending items synchronously
+            for (const auto node : get_nodes())
+                if (node != nullptr &&
+                    node->getItem() == nullptr)
+                    materializeNode(*node);
+        } else
+            scheduleVirtualizationUpdate();
+    }
+    emit asynchronousChanged();
+}
+
+void    Graph::setIncubationBudget(int incubationBudget) noexcept
+{
+    incubationBudget = std::max(1, incubationBudget);
+    if (incubationBudget != _incubationBudget) {
+        _incubationBudget = incubationBudget;
+        emit incubationBudgetChanged();
+    }
+}
+
+void    Graph::updateItemsPending() noexcept
+{
+    const auto itemsPending = static_cast<int>(_incubatingPrimitives.size());
+    if (itemsPending == _itemsPending)
+        return;
+    const auto incubated = itemsPending == 0;
+    _itemsPending = itemsPending;
+    emit itemsPendingChanged();
+    if (incubated)
+        emit itemsIncubated();
+}
+
+void    Graph::incubatePrimitive(QObject& primitive) noexcept
+{
+    const auto key = static_cast<const QObject*>(&primitive);
+    if (_virtualPrimitives.find(key) == _virtualPrimitives.end())
+        return;
+    if (!_incubatingPrimitives.insert(key).second)
+        return;     // Primitive is already queued or incubating
+    _incubationQueue.push_back(QPointer<QObject>{&primitive});
+    updateItemsPending();
+    scheduleIncubation();
+}
+
+void    Graph::cancelIncubations() noexcept
+{
+    for (auto& incubator : _incubators) {
+        if (incubator->isReady() &&
+            incubator->object() != nullptr)
+            incubator->object()->deleteLater();
+        incubator->clear();
+    }
+    _incubators.clear();
+    _incubationQueue.clear();
+    _incubatingPrimitives.clear();
+    updateItemsPending();
+}
+
+void    Graph::scheduleIncubation() noexcept
+{
+    if (_incubationScheduled)
+        return;
+    _incubationScheduled = true;
+    if (!_incubationQueue.empty())
+        QMetaObject::invokeMethod(this, &qan::Graph::processIncubations, Qt::QueuedConnection);
+    else    // Only waiting for running incubations: poll at frame rate
+        QTimer::singleShot(16, this, &qan::Graph::processIncubations);
+}
+
+void    Graph::processIncubations() noexcept
+{
+    // Algorithm:
+    // 1. Complete ready incubations: configure incubated items (incubating their edges).
+    // 2. Start queued incubations, keeping at most maxIncubators incubations running.
+    // 3. Without an engine incubation controller (ie no window), incubations never progress
+    //    asynchronously: force their completion.
+    // 4. Schedule next iteration while there are pending items.
+    // Every step stop once incubation budget is elapsed.
+    _incubationScheduled = false;
+    QElapsedTimer timer;
+    timer.start();
+    const auto budgetElapsed = [this, &timer]() -> bool {
+        return timer.elapsed() >= _incubationBudget;
+    };
+
+    // 1.
+    for (auto incubator = _incubators.begin(); incubator != _incubators.end() && !budgetElapsed(); ) {
+        if ((*incubator)->isLoading()) {
+            ++incubator;
+            continue;
+        }
+        const auto completed = std::move(*incubator);
+        incubator = _incubators.erase(incubator);
+        completeIncubation(*completed);
+    }
+
+    // 2.
+    while (!_incubationQueue.empty() &&
+           _incubators.size() < maxIncubators &&
+           !budgetElapsed()) {
+        const auto primitive = _incubationQueue.front();
+        _incubationQueue.pop_front();
+        if (primitive)      // Note: destroyed primitives are removed in onVirtualPrimitiveDestroyed()
+            startIncubation(*primitive);
+    }
+
+    // 3.
+    const auto engine = qmlEngine(this);
+    if (engine == nullptr ||
+        engine->incubationController() == nullptr) {
+        while (!_incubators.empty() &&
+               !budgetElapsed()) {
+            const auto incubator = std::move(_incubators.front());
+            _incubators.erase(_incubators.begin());
+            if (incubator->isLoading())
+                incubator->forceCompletion();
+            completeIncubation(*incubator);
+        }
+    }
+
+    // 4.
+    updateItemsPending();
+    if (!_incubationQueue.empty() ||
+        !_incubators.empty())
+        scheduleIncubation();
+}
+
+void    Graph::startIncubation(QObject& primitive) noexcept
+{
+    // PRECONDITIONS:
+        // primitive must be virtual
+        // primitive component and style must be valid
+        // an edge source and destination must have items
+    const auto key = static_cast<const QObject*>(&primitive);
+    const auto virtualPrimitive = _virtualPrimitives.find(key);
+    const auto node = qobject_cast<qan::Node*>(&primitive);
+    const auto edge = qobject_cast<qan::Edge*>(&primitive);
+    const auto rootContext = qmlContext(this);
+    const auto component = virtualPrimitive != _virtualPrimitives.end() ? virtualPrimitive->second.component.data() : nullptr;
+    const auto style = virtualPrimitive != _virtualPrimitives.end() ? virtualPrimitive->second.style.data() : nullptr;
+    const auto hasItems = [](qan::Edge& edge) -> bool {
+        return edge.get_src() != nullptr && edge.get_src()->getItem() != nullptr &&
+               edge.get_dst() != nullptr && edge.get_dst()->getItem() != nullptr;
+    };
+    if (component == nullptr ||
+        style == nullptr ||
+        rootContext == nullptr ||
+        (node == nullptr && edge == nullptr) ||
+        (edge != nullptr && !hasItems(*edge))) {
+        _incubatingPrimitives.erase(key);   // Note: Edge will be incubated again when its src and dst are materialized
+        return;
+    }
+
+    // Reuse pooled items synchronously, it is fast
+    if (getPooledItemsCount(component) > 0) {
+        if (node != nullptr)
+            materializeNode(*node);
+        else
+            materializeEdge(*edge);
+        _incubatingPrimitives.erase(key);
+        return;
+    }
+
+    // Note: Do not set primitive item before incubation completion, item is still incomplete.
+    const auto initialState = [this, node, style](QObject* object) {
+        if (node != nullptr) {
+            const auto nodeItem = qobject_cast<qan::NodeItem*>(object);
+            if (nodeItem != nullptr) {
+                nodeItem->setNode(node);
+                nodeItem->setGraph(this);
+                nodeItem->setStyle(qobject_cast<qan::NodeStyle*>(style));
+            }
+        } else {
+            const auto edgeItem = qobject_cast<qan::EdgeItem*>(object);
+            if (edgeItem != nullptr) {
+                edgeItem->setGraph(this);
+                edgeItem->setStyle(qobject_cast<qan::EdgeStyle*>(style));
+            }
+        }
+    };
+    auto incubator = std::make_unique<qan::Incubator>(&primitive, component, initialState);
+    component->create(*incubator, rootContext);
+    _incubators.push_back(std::move(incubator));
+}
+
+void    Graph::completeIncubation(qan::Incubator& incubator) noexcept
+{
+    if (incubator.isError()) {
+        qWarning() << "qan::Graph::completeIncubation(): Error: Item incubation failed:" << incubator.errors();
+        const auto primitive = incubator.getPrimitive();
+        if (primitive != nullptr)
+            _incubatingPrimitives.erase(static_cast<const QObject*>(primitive));
+        return;
+    }
+    const auto item = qobject_cast<QQuickItem*>(incubator.object());
+    if (item == nullptr) {
+        if (incubator.object() != nullptr)
+            incubator.object()->deleteLater();
+        return;
+    }
+    QQmlEngine::setObjectOwnership(item, QQmlEngine::CppOwnership);
+    item->setParentItem(getContainerItem());
+    item->setVisible(true);
+
+    const auto primitive = incubator.getPrimitive();
+    const auto node = qobject_cast<qan::Node*>(primitive);
+    const auto edge = qobject_cast<qan::Edge*>(primitive);
+    const auto nodeItem = qobject_cast<qan::NodeItem*>(item);
+    const auto edgeItem = qobject_cast<qan::EdgeItem*>(item);
+    auto configured = false;
+    if (node != nullptr && nodeItem != nullptr)
+        configured = configureVirtualNodeItem(*node, *nodeItem);
+    else if (edge != nullptr && edgeItem != nullptr)
+        configured = configureVirtualEdgeItem(*edge, *edgeItem);
+    if (!configured) {      // Primitive has been destroyed or materialized in the meantime
+        if (primitive != nullptr)
+            _incubatingPrimitives.erase(static_cast<const QObject*>(primitive));
+        item->setVisible(false);
+        if (isPoolAvailable(incubator.getComponent()))
+            releasePooledItem(incubator.getComponent(), *item);
+        else
+            item->deleteLater();
+    }
+}
+//-----------------------------------------------------------------------------
+
+
+/* Level of Detail Management *///---------------------------------------------
+void    Graph::setLodLevel(LodLevel lodLevel) noexcept
+{
+    if (lodLevel == _lodLevel)
+        return;
+    // Note: Items culling only change when switching from or to full level of detail.
+    const auto cullingChanged = lodLevel == LodLevel::Full ||
+                                _lodLevel == LodLevel::Full;
+    _lodLevel = lodLevel;
+    if (cullingChanged) {
+        if (_lodLevel == LodLevel::Full &&
+            _cullRect.isEmpty())
+            restoreCulledItems();
+        else
+            updateCulling();
+        updateVirtualization();     // Release items or materialize virtual nodes
+    }
+    emit lodLevelChanged();
+    emit lodGeometryChanged();
+}
+
+void    Graph::collectLodGeometry(const QRectF& rect,
+                                  std::vector<QRectF>& groups,
+                                  std::vector<QRectF>& nodes,
+                                  std::vector<QLineF>& edges) const noexcept
+{
+    // Algorithm:
+    // 1. Collect node and group items rects from spatial index.
+    // 2. Collect virtual nodes rects.
+    // 3. Collect edges lines from their source and destination rects (edge items geometry is not
+    //    generated while they are culled).
+    groups.clear();
+    nodes.clear();
+    edges.clear();
+    const auto collectAll = rect.isEmpty();
+    const auto intersects = [&rect, collectAll](const QRectF& r) -> bool {   // Note: r might be empty
+        return collectAll ||
+               !(r.left() > rect.right() || r.right() < rect.left() ||
+                 r.top() > rect.bottom() || r.bottom() < rect.top());
+    };
+
+    // 1.
+    std::vector<qan::SpatialIndex::Key> keys;
+    if (collectAll) {
+        for (const auto node : get_nodes()) {
+            const auto nodeItem = node != nullptr ? node->getItem() : nullptr;
+            if (nodeItem != nullptr)
+                keys.push_back(static_cast<const QObject*>(nodeItem));
+        }
+    } else
+        _spatialIndex.query(rect, keys);
+    for (const auto key : keys) {
+        const auto object = static_cast<const QObject*>(key);
+        const auto itemRect = _spatialIndex.getRect(key);
+        if (itemRect == nullptr ||
+            qobject_cast<const qan::NodeItem*>(object) == nullptr)     // Note: Edge items are indexed too
+            continue;
+        if (qobject_cast<const qan::GroupItem*>(object) != nullptr)
+            groups.push_back(*itemRect);
+        else
+            nodes.push_back(*itemRect);
+    }
+
+    // 2.
+    keys.clear();
+    if (collectAll) {
+        for (const auto& primitive : _virtualPrimitives)
+            keys.push_back(primitive.first);
+    } else
+        _virtualNodesIndex.query(rect, keys);
+    for (const auto key : keys) {
+        const auto nodeRect = _virtualNodesIndex.getRect(key);  // Note: Virtual edges are not indexed
+        if (nodeRect != nullptr)
+            nodes.push_back(*nodeRect);
+    }
+
+    // 3.
+    const auto getNodeRect = [this](const qan::Node* node) -> const QRectF* {
+        if (node == nullptr)
+            return nullptr;
+        const auto nodeItem = node->getItem();
+        return nodeItem != nullptr ? _spatialIndex.getRect(static_cast<const QObject*>(nodeItem)) :
+                                     _virtualNodesIndex.getRect(static_cast<const QObject*>(node));
+    };
+    for (const auto edge : get_edges()) {
+        if (edge == nullptr)
+            continue;
+        const auto srcRect = getNodeRect(edge->get_src());
+        const auto dstRect = getNodeRect(edge->get_dst());
+        if (srcRect == nullptr ||
+            dstRect == nullptr)
+            continue;
+        const QLineF line{srcRect->center(), dstRect->center()};
+        if (intersects(QRectF{line.p1(), line.p2()}.normalized()))
+            edges.push_back(line);
+    }
+}
+//-----------------------------------------------------------------------------
+
+
+/* Batched Edges Management *///-----------------------------------------------
+void    Graph::setBatchedEdges(bool batchedEdges) noexcept
+{
+    if (batchedEdges == _batchedEdges)
+        return;
+    _batchedEdges = batchedEdges;
+    if (_batchedEdges &&
+        !_edgeLayer &&
+        getContainerItem() != nullptr) {
+        // Note: layer is kept when batching is disabled, previously inserted batched edges are still drawn.
+        _edgeLayer = new qan::EdgeLayer{getContainerItem()};
+        QQmlEngine::setObjectOwnership(_edgeLayer.data(), QQmlEngine::CppOwnership);
+        _edgeLayer->setGraph(this);
+        emit edgeLayerChanged();
+    }
+    emit batchedEdgesChanged();
+}
+
+QQmlComponent*  Graph::getBatchedEdgeDelegate() noexcept
+{
+    if (!_batchedEdgeDelegate)
+        _batchedEdgeDelegate = createComponent(QStringLiteral("qrc:/QuickQanava/BatchedEdge.qml"));
+    return _batchedEdgeDelegate.get();
+}
+//-----------------------------------------------------------------------------
+
+
 /* Topology Algorithms *///----------------------------------------------------
 std::vector<QPointer<const qan::Node>>  Graph::collectRootNodes() const noexcept
 {
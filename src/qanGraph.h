@@ -37,12 +37,23 @@
 #include "./gtpo/node.h"
 #include "./gtpo/graph.h"
 
+// Std headers
+#include <deque>
+#include <functional>   // std::hash
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
 // Qt headers
 #include <QString>
 #include <QQuickItem>
+#include <QQuickWindow>
 #include <QQmlParserStatus>
 #include <QSharedPointer>
 #include <QAbstractListModel>
+#include <QLineF>
 
 // QuickQanava headers
 #include "./qanUtils.h"
@@ -54,6 +65,11 @@
 #include "./qanNavigable.h"
 #include "./qanSelectable.h"
 #include "./qanConnector.h"
+#include "./qanOrthoRouter.h"
+#include "./qanSpatialIndex.h"
+#include "./qanIncubator.h"
+#include "./qanEdgeLayer.h"
+#include "./qanFrameScheduler.h"
 
 
 //! Main QuickQanava namespace
@@ -164,11 +180,19 @@ public:
      * Using childAt() method will most of the time return qan::Edge items since childAt() use bounding boxes
      * for item detection.
      *
+     * Candidate items are queried from graph spatial index (see getSpatialIndex()), only items at
+     * position are tested.
+     *
+     * \warning Only spatially indexed node, group and edge items are returned: other graph container
+     * children (for example user items added directly in container) are ignored.
+     *
      * \return nullptr if there is no child at requested position, or a QQuickItem that can be casted qan::Node, qan::Edge or qan::Group with qobject_cast<>.
      */
     Q_INVOKABLE QQuickItem* graphChildAt(qreal x, qreal y) const;
 
-    /*! \brief Similar to QQuickItem::childAt() method, except that it only take groups into account (and is hence faster, but still O(n)).
+    /*! \brief Similar to QQuickItem::childAt() method, except that it only take groups into account.
+     *
+     * Candidate groups are queried from graph spatial index (see getSpatialIndex()).
      *
      * \arg except Return every compatible group except \c except (can be nullptr).
      */
@@ -389,6 +413,10 @@ public:
     bool                    insertNode(Node* node,
                                        QQmlComponent* nodeComponent = nullptr,
                                        qan::NodeStyle* nodeStyle = nullptr);
+protected:
+    //! Forward \c nodeItem clicked, right clicked and double clicked signals to graph node signals.
+    void                    connectNodeItem(qan::NodeItem& nodeItem);
+public:
 
     /*! \brief Remove node \c node from this graph. Shortcut to gtpo::GenGraph<>::removeNode().
      *
@@ -533,6 +561,9 @@ private:
      */
     bool                    configureEdge(qan::Edge& source, QQmlComponent& edgeComponent, qan::EdgeStyle& style,
                                           qan::Node& src, qan::Node* dst);
+    //! Bind a created (or reused) \c edgeItem to \c edge, \c src and \c dst items, register it in spatial index and forward its signals.
+    void                    configureEdgeItem(qan::Edge& edge, qan::EdgeItem& edgeItem,
+                                              qan::Node& src, qan::Node* dst);
 public:
     template <class Edge_t>
     qan::Edge*              insertNonVisualEdge(qan::Node& src, qan::Node* dstNode);
@@ -579,6 +610,91 @@ signals:
     /*! \brief Emitted immediately _before_ an edge is removed.
      */
     void            onEdgeRemoved(qan::Edge* edge);
+
+public:
+    /*! \brief Schedule \c edgeItem geometry update just before next scene graph synchronization.
+     *
+     * Usually called from qan::EdgeItem::scheduleUpdateItem() when edge source or destination
+     * geometry change: dragging a node then update every incident edge once per frame.
+     */
+    void            scheduleEdgeUpdate(qan::EdgeItem& edgeItem) noexcept;
+    //! Synchronously update all edges scheduled with scheduleEdgeUpdate().
+    Q_INVOKABLE void    updateScheduledEdges() noexcept;
+private:
+    std::vector<QPointer<qan::EdgeItem>>    _scheduledEdges;
+
+public:
+    /*! \brief Graph deferred tasks scheduler, driven by container item window frames.
+     *
+     * Edges geometry updates are run as high priority tasks, layouts and other non frame critical
+     * updates should be scheduled with normal or low priority to stay within frame budget.
+     */
+    Q_PROPERTY(qan::FrameScheduler* frameScheduler READ getFrameScheduler CONSTANT FINAL)
+    //! \copydoc frameScheduler
+    qan::FrameScheduler*        getFrameScheduler() noexcept { return &_frameScheduler; }
+    //! \copydoc frameScheduler
+    const qan::FrameScheduler*  getFrameScheduler() const noexcept { return &_frameScheduler; }
+private:
+    //! \copydoc frameScheduler
+    qan::FrameScheduler         _frameScheduler;
+
+public:
+    /*! \brief Minimum number of scheduled edges whose geometry is generated in parallel (default to 512, 0 to disable).
+     *
+     * When more than \c parallelEdgesThreshold edges are updated in the same frame, their geometry is
+     * generated with qan::EdgeItem::updateItems() on global thread pool threads. Edges where
+     * qan::EdgeItem::isConcurrentUpdateEnabled() is false are always updated with their updateItemSlot().
+     */
+    Q_PROPERTY(int parallelEdgesThreshold READ getParallelEdgesThreshold WRITE setParallelEdgesThreshold NOTIFY parallelEdgesThresholdChanged FINAL)
+    //! \copydoc parallelEdgesThreshold
+    int             getParallelEdgesThreshold() const noexcept { return _parallelEdgesThreshold; }
+    //! \copydoc parallelEdgesThreshold
+    void            setParallelEdgesThreshold(int parallelEdgesThreshold) noexcept;
+private:
+    //! \copydoc parallelEdgesThreshold
+    int             _parallelEdgesThreshold = 512;
+signals:
+    //! \copydoc parallelEdgesThreshold
+    void            parallelEdgesThresholdChanged();
+
+public:
+    //! \brief Distance between parallel edges, and between nested self loops (default to 12.).
+    Q_PROPERTY(qreal multiEdgeSpacing READ getMultiEdgeSpacing WRITE setMultiEdgeSpacing NOTIFY multiEdgeSpacingChanged FINAL)
+    //! \copydoc multiEdgeSpacing
+    qreal           getMultiEdgeSpacing() const noexcept { return _multiEdgeSpacing; }
+    //! \copydoc multiEdgeSpacing
+    void            setMultiEdgeSpacing(qreal multiEdgeSpacing) noexcept;
+private:
+    //! \copydoc multiEdgeSpacing
+    qreal           _multiEdgeSpacing = 12.;
+signals:
+    //! \copydoc multiEdgeSpacing
+    void            multiEdgeSpacingChanged();
+
+public:
+    /*! \brief Register \c edgeItem in the fan of edges sharing its source and destination items (in any direction).
+     *
+     * Called by qan::EdgeItem when its source or destination item change, all fan edges index are
+     * updated and their geometry scheduled for update (see qan::EdgeItem::setFan()).
+     */
+    void            updateMultiEdge(qan::EdgeItem& edgeItem) noexcept;
+    //! Remove \c edgeItem from its fan (\c edgeItem might be partially destroyed, it is only used as a key).
+    void            removeMultiEdge(const qan::EdgeItem& edgeItem) noexcept;
+private:
+    //! Fan key: source and destination items ordered by address.
+    using MultiEdgeKey = std::pair<const QQuickItem*, const QQuickItem*>;
+    struct MultiEdgeKeyHash {
+        std::size_t operator()(const MultiEdgeKey& key) const noexcept {
+            const auto h1 = std::hash<const void*>{}(key.first);
+            const auto h2 = std::hash<const void*>{}(key.second);
+            return h1 ^ (h2 + 0x9e3779b9 + (h1 << 6) + (h1 >> 2));
+        }
+    };
+    //! Update fan edges index, canonical fan direction is from \c key first item to second item.
+    void            updateMultiEdgeFan(const MultiEdgeKey& key, const std::vector<qan::EdgeItem*>& fan) noexcept;
+
+    std::unordered_map<MultiEdgeKey, std::vector<qan::EdgeItem*>, MultiEdgeKeyHash> _multiEdges;
+    std::unordered_map<const qan::EdgeItem*, MultiEdgeKey>                          _multiEdgesKeys;
     //@}
     //-------------------------------------------------------------------------
 
@@ -799,6 +915,20 @@ public:
     //! Return true if multiple nodes, groups or edges are selected.
     Q_INVOKABLE bool    hasMultipleSelection() const;
 
+    /*! \brief Start a selection batch: \c selectionChanged() emission is deferred until the matching endSelectionBatch().
+     *
+     * Batches could be nested, \c selectionChanged() is emitted only once when the outermost batch
+     * end, and only if selection has actually been modified.
+     */
+    void                beginSelectionBatch() noexcept;
+    //! End a selection batch started with beginSelectionBatch().
+    void                endSelectionBatch();
+private:
+    //! Emit \c selectionChanged(), or defer emission until the current selection batch end.
+    void                emitSelectionChanged();
+    int                 _selectionBatch = 0;
+    bool                _selectionBatchModified = false;
+
 public:
     using SelectedNodes = qcm::Container<std::vector, QPointer<qan::Node>>;
 
@@ -1066,6 +1196,468 @@ public:
     //@}
     //-------------------------------------------------------------------------
 
+    /*! \name Ortho Routing Management *///------------------------------------
+    //@{
+public:
+    /*! \brief Route edges with qan::EdgeStyle::LineType::Ortho line type around nodes (default to false).
+     *
+     * When enabled, nodes are registered as obstacles in graph ortho router (see qan::OrthoRouter) and
+     * ortho edges are routed with multiple bends around nodes. Only edges whose route cross a modified
+     * node are routed again, obstacles and routes are updated at most once per frame (see frameScheduler).
+     * Edges connected to ports keep their default single bend geometry.
+     */
+    Q_PROPERTY(bool orthoRouting READ getOrthoRouting WRITE setOrthoRouting NOTIFY orthoRoutingChanged FINAL)
+    //! \copydoc orthoRouting
+    bool                getOrthoRouting() const noexcept { return _orthoRouting; }
+    //! \copydoc orthoRouting
+    bool                setOrthoRouting(bool orthoRouting) noexcept;
+private:
+    //! \copydoc orthoRouting
+    bool                _orthoRouting = false;
+signals:
+    //! \copydoc orthoRouting
+    void                orthoRoutingChanged();
+
+public:
+    //! Graph ortho router, obstacles are expressed in graph container item CS.
+    qan::OrthoRouter&   getOrthoRouter() noexcept { return _orthoRouter; }
+
+    //! Route (or update routes of) all ortho edges.
+    Q_INVOKABLE void    routeOrthoEdges() noexcept;
+
+protected:
+    //! Register \c node item as an ortho router obstacle and monitor its geometry.
+    void                configureOrthoObstacle(qan::Node& node) noexcept;
+    //! Update \c node ortho router obstacle, eventually update edges whose route cross \c node.
+    void                updateOrthoObstacle(qan::Node& node) noexcept;
+protected slots:
+    //! Called when a node or group item monitored by ortho router is modified, schedule a coalesced updateOrthoObstacle().
+    void                onOrthoObstacleModified();
+private:
+    qan::OrthoRouter    _orthoRouter;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Spatial Index Management *///------------------------------------
+    //@{
+public:
+    /*! \brief Spatial index of graph node, group and edge items bounding rects, in graph container item CS.
+     *
+     * Index is updated when items position, size, parent or visibility change, invisible items are
+     * not indexed. Index keys are items QObject pointers, use queryItems() to get items.
+     */
+    const qan::SpatialIndex&    getSpatialIndex() const noexcept { return _spatialIndex; }
+
+    //! Return node, group and edge items whose bounding rect intersect \c rect (in graph container item CS).
+    std::vector<QQuickItem*>    queryItems(const QRectF& rect) const noexcept;
+
+    /*! \brief Return the top most edge item whose line is within qan::EdgeItem::hitDistance of \c point (in graph container item CS), nullptr if there is none.
+     *
+     * Only edges whose indexed bounding rect is close to \c point are hit tested.
+     */
+    Q_INVOKABLE QQuickItem*     edgeItemAt(const QPointF& point) const noexcept;
+
+    //! Batched edgeItemAt(): return hit edge item (or nullptr) for each point in \c points (in graph container item CS).
+    std::vector<qan::EdgeItem*> edgeItemsAt(const std::vector<QPointF>& points) const noexcept;
+
+protected:
+    //! Register \c item in graph spatial index and monitor its geometry.
+    void                configureSpatialItem(QQuickItem& item) noexcept;
+    //! Update \c item rect in spatial index, for groups, grouped items rects are updated too.
+    void                updateSpatialItem(QQuickItem& item) noexcept;
+    //! Remove \c item from spatial index.
+    void                removeSpatialItem(const QQuickItem* item) noexcept;
+protected slots:
+    //! Called when a node, group or edge item registered in spatial index is modified.
+    void                onSpatialItemModified();
+    //! Called when a node, group or edge item registered in spatial index is destroyed.
+    void                onSpatialItemDestroyed(QObject* item);
+private:
+    qan::SpatialIndex   _spatialIndex;
+
+public:
+    /*! \brief Spatial index of visible and expanded group items, used for drop target lookup in groupAt().
+     *
+     * Groups global z is cached in group items (see qan::NodeItem::getGlobalZ()) and updated only
+     * when a group, or one of its parent groups, z or parent change.
+     */
+    const qan::SpatialIndex&    getGroupsIndex() const noexcept { return _groupsIndex; }
+
+private:
+    qan::SpatialIndex                           _groupsIndex;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Viewport Culling Management *///---------------------------------
+    //@{
+public:
+    /*! \brief Set graph cull rect (in graph container item CS): node, group and edge items outside \c cullRect are culled.
+     *
+     * Culling state is updated incrementally: only items intersecting previous or new cull rect are
+     * visited, items moving in or out of cull rect are detected from spatial index updates.
+     * Setting an empty rect (default) disable culling and restore all culled items.
+     *
+     * \note Usually set from qan::GraphView when its \c culling property is enabled.
+     * \sa qan::NodeItem::culled, qan::EdgeItem::culled
+     */
+    void            setCullRect(const QRectF& cullRect) noexcept;
+    //! \copydoc setCullRect()
+    const QRectF&   getCullRect() const noexcept { return _cullRect; }
+
+protected:
+    //! Cull or restore \c item according to its spatial index rect, current cull rect and level of detail.
+    void            updateItemCulling(QQuickItem& item) noexcept;
+    //! Restore all culled items.
+    void            restoreCulledItems() noexcept;
+    //! Update culling state of all node, group and edge items.
+    void            updateCulling() noexcept;
+    //! Set a node, group or edge \c item culled state, return false if \c item culling is not supported.
+    static bool     setItemCulled(QQuickItem& item, bool culled) noexcept;
+    //! Return true if \c item is a culled node, group or edge item that will be shown when restored.
+    static bool     isItemCulled(const QQuickItem& item) noexcept;
+private:
+    QRectF                                  _cullRect;
+    std::unordered_set<const QObject*>      _culledItems;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Delegate Virtualization Management *///--------------------------
+    //@{
+public:
+    /*! \brief Enable delegate virtualization: nodes and edges exists in topology, but their items are created only when needed (default to false).
+     *
+     * When virtualization is enabled, inserted nodes are "virtual": they have no item, their geometry is
+     * stored in graph (see setNodeGeometry()) and their item is created from their delegate only when
+     * their geometry intersect graph cull rect (see setCullRect()). Edges items are created once their
+     * source and destination items exists: when an edge crosses cull rect (its source and destination rects
+     * union intersect cull rect), its virtual source or destination is materialized too. Culled node items
+     * are released: they are detached from their node and parked in a per delegate pool to be reused for
+     * another node (same for their edges), items released when pool is full are destroyed (see
+     * \c delegatesPoolCapacity).
+     *
+     * Only ungrouped, unselected nodes without ports are virtualized, grouping a virtual node create its item.
+     *
+     * \note Virtualization is driven by graph cull rect, enable qan::GraphView \c culling, otherwise all
+     * nodes items are created (as if virtualization was disabled).
+     * \note Disabling virtualization create all virtual nodes and edges items.
+     */
+    Q_PROPERTY(bool virtualized READ getVirtualized WRITE setVirtualized NOTIFY virtualizedChanged FINAL)
+    //! \copydoc virtualized
+    inline bool     getVirtualized() const noexcept { return _virtualized; }
+    //! \copydoc virtualized
+    void            setVirtualized(bool virtualized) noexcept;
+private:
+    //! \copydoc virtualized
+    bool            _virtualized = false;
+signals:
+    //! \copydoc virtualized
+    void            virtualizedChanged();
+
+public:
+    /*! \brief Set \c node geometry (in graph container item CS), work for both virtual and regular nodes.
+     *
+     * An empty \c rect size is ignored, virtual node item will then keep its delegate default size.
+     */
+    Q_INVOKABLE void    setNodeGeometry(qan::Node* node, const QRectF& rect) noexcept;
+    //! Return \c node geometry (in graph container item CS), work for both virtual and regular nodes.
+    Q_INVOKABLE QRectF  getNodeGeometry(qan::Node* node) const noexcept;
+    //! Return true if \c node is virtual (ie it has currently no item, see \c virtualized).
+    Q_INVOKABLE bool    isVirtualNode(const qan::Node* node) const noexcept;
+
+protected:
+    //! Register \c node as a virtual node if virtualization is enabled, return false if \c node item should be created.
+    bool            virtualizeNode(qan::Node& node, QQmlComponent& component, qan::NodeStyle& style) noexcept;
+    //! Register \c edge as a virtual edge if either \c src or \c dst is virtual, return false if \c edge item should be created.
+    bool            virtualizeEdge(qan::Edge& edge, QQmlComponent& component, qan::EdgeStyle& style,
+                                   qan::Node& src, qan::Node* dst) noexcept;
+    //! Return true if \c node item could be released.
+    bool            isVirtualizable(const qan::Node& node) const noexcept;
+
+    //! Create (or reuse from pool) a virtual \c node item and configure it, then materialize its virtual edges.
+    void            materializeNode(qan::Node& node) noexcept;
+    //! Create (or reuse from pool) a virtual \c edge item if its source and destination items exists.
+    void            materializeEdge(qan::Edge& edge) noexcept;
+    //! Configure virtual \c node new \c nodeItem and restore its geometry, return false if \c node is no longer virtual.
+    bool            configureVirtualNodeItem(qan::Node& node, qan::NodeItem& nodeItem) noexcept;
+    //! Configure virtual \c edge new \c edgeItem, return false if \c edge is no longer virtual or if its source or destination has no item.
+    bool            configureVirtualEdgeItem(qan::Edge& edge, qan::EdgeItem& edgeItem) noexcept;
+    //! Release \c node item (and its adjacent edges items) to delegates pool, \c node become virtual.
+    bool            releaseNodeItem(qan::Node& node) noexcept;
+    //! Release \c edge item to delegates pool, \c edge become virtual.
+    bool            releaseEdgeItem(qan::Edge& edge) noexcept;
+
+    //! Return \c node rect in graph container item CS, for both virtual and regular nodes (empty rect if unknown).
+    QRectF          getVirtualizationRect(const qan::Node& node) const noexcept;
+    //! Update virtual \c edge rect (its source and destination rects union) in virtual edges index.
+    void            updateVirtualEdgeRect(qan::Edge& edge) noexcept;
+    //! Update \c node adjacent virtual edges rects.
+    void            updateVirtualEdgesRects(qan::Node& node) noexcept;
+    //! Return true if \c edge source and destination rects union intersect cull rect.
+    bool            isEdgeInCullRect(const qan::Edge& edge) const noexcept;
+
+    //! Schedule an updateVirtualization() call in graph event loop (multiple calls are coalesced).
+    void            scheduleVirtualizationUpdate() noexcept;
+protected slots:
+    //! Release culled virtualizable node items and materialize virtual nodes intersecting cull rect.
+    void            updateVirtualization() noexcept;
+    //! Called when a virtual node or edge is destroyed.
+    void            onVirtualPrimitiveDestroyed(QObject* primitive);
+private:
+    struct VirtualPrimitive {
+        QPointer<QQmlComponent> component;
+        QPointer<qan::Style>    style;
+        qreal                   z = 0.;
+    };
+    //! Virtual nodes and edges delegates, indexed by primitive QObject pointer.
+    std::unordered_map<const QObject*, VirtualPrimitive>    _virtualPrimitives;
+    //! Virtual nodes geometry.
+    qan::SpatialIndex                                       _virtualNodesIndex;
+    //! Virtual edges source and destination rects union.
+    qan::SpatialIndex                                       _virtualEdgesIndex;
+    bool                                                    _virtualizationUpdateScheduled = false;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Delegates Pool Management *///----------------------------------
+    //@{
+public:
+    /*! \brief Maximum number of removed items parked per delegate component for later reuse (default to 0, ie removed items are destroyed).
+     *
+     * When capacity is not 0, node and edge items of removed primitives are reset and parked in a per delegate
+     * component pool instead of being destroyed (for node items that can't be parked, such as groups or nodes
+     * with ports, their selection and dock items are parked). Parked items are reused by next items
+     * creation with the same delegate component in createFromComponent(), createSelectionItem() and
+     * createDockFromDelegate().
+     *
+     * \note Items released by delegate virtualization are pooled up to capacity too (see \c virtualized), extra
+     * released items are destroyed: set a capacity close to the number of items visible in view when
+     * virtualization is enabled.
+     */
+    Q_PROPERTY(int delegatesPoolCapacity READ getDelegatesPoolCapacity WRITE setDelegatesPoolCapacity NOTIFY delegatesPoolCapacityChanged FINAL)
+    //! \copydoc delegatesPoolCapacity
+    inline int      getDelegatesPoolCapacity() const noexcept { return _delegatesPoolCapacity; }
+    //! \copydoc delegatesPoolCapacity
+    void            setDelegatesPoolCapacity(int delegatesPoolCapacity) noexcept;
+private:
+    //! \copydoc delegatesPoolCapacity
+    int             _delegatesPoolCapacity = 0;
+signals:
+    //! \copydoc delegatesPoolCapacity
+    void            delegatesPoolCapacityChanged();
+
+public:
+    /*! \brief Create \c count items from \c component and park them in delegates pool, return \c component pooled items count.
+     *
+     * Prewarmed items are created without a primitive, \c component should support a nullptr \c node or \c edge.
+     * Prewarming ignore \c delegatesPoolCapacity.
+     */
+    Q_INVOKABLE int     prewarmDelegate(QQmlComponent* component, int count) noexcept;
+    //! Return the number of items currently parked for \c component.
+    Q_INVOKABLE int     getPooledItemsCount(QQmlComponent* component) const noexcept;
+    //! Destroy all pooled items.
+    Q_INVOKABLE void    clearDelegatesPool() noexcept;
+
+protected:
+    //! Return a parked item created from \c component, or nullptr if there is none.
+    QQuickItem*     acquirePooledItem(const QQmlComponent* component) noexcept;
+    //! Park \c item created from \c component in delegates pool.
+    void            releasePooledItem(QQmlComponent* component, QQuickItem& item) noexcept;
+    //! Return true if \c component pool has not reached \c delegatesPoolCapacity.
+    bool            isPoolAvailable(QQmlComponent* component) const noexcept;
+
+    //! Reset \c nodeItem (detach it from its node and graph) and park it in \c component pool, \c nodeItem is destroyed when pool is full.
+    void            parkNodeItem(qan::NodeItem& nodeItem, QQmlComponent& component) noexcept;
+    //! Reset \c edgeItem (detach it from its edge and graph) and park it in \c component pool, \c edgeItem is destroyed when pool is full.
+    void            parkEdgeItem(qan::EdgeItem& edgeItem, QQmlComponent& component) noexcept;
+
+    //! Park removed \c node item and its adjacent edges items (or at least their selection and dock items) in delegates pool.
+    void            recycleNodeItem(qan::Node& node) noexcept;
+    //! Park removed \c edge item in delegates pool, return false if item has not been parked.
+    bool            recycleEdgeItem(qan::Edge& edge) noexcept;
+protected slots:
+    //! Called when a pooled delegate component is destroyed, destroy its parked items.
+    void            onPooledComponentDestroyed(QObject* component);
+private:
+    std::unordered_map<const QQmlComponent*, std::vector<QPointer<QQuickItem>>> _delegatesPool;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Asynchronous Incubation Management *///--------------------------
+    //@{
+public:
+    /*! \brief Enable asynchronous insertion: nodes and edges are inserted immediately in topology, but their items are incubated asynchronously (default to false).
+     *
+     * Items are incubated with a QQmlIncubator and configured across event loop iterations, each iteration
+     * spending at most \c incubationBudget ms to start incubations and configure incubated items, so that
+     * large graphs are rendered progressively. Node geometry could be set before its item is incubated
+     * with setNodeGeometry(). \c itemsPending could be used to monitor loading, \c itemsIncubated() is
+     * emitted once all pending items have been incubated.
+     *
+     * \note Asynchronous insertion share virtualization mechanism: a node waiting for its item is a virtual
+     * node (see isVirtualNode()). When \c virtualized is set, only nodes intersecting graph cull rect are
+     * incubated. Groups items are always created synchronously.
+     * \note Disabling asynchronous insertion cancel pending incubations and create pending items synchronously.
+     */
+    Q_PROPERTY(bool asynchronous READ getAsynchronous WRITE setAsynchronous NOTIFY asynchronousChanged FINAL)
+    //! \copydoc asynchronous
+    inline bool     getAsynchronous() const noexcept { return _asynchronous; }
+    //! \copydoc asynchronous
+    void            setAsynchronous(bool asynchronous) noexcept;
+private:
+    //! \copydoc asynchronous
+    bool            _asynchronous = false;
+signals:
+    //! \copydoc asynchronous
+    void            asynchronousChanged();
+
+public:
+    //! Maximum time spent in ms per event loop iteration to start incubations and configure incubated items (default to 4ms).
+    Q_PROPERTY(int incubationBudget READ getIncubationBudget WRITE setIncubationBudget NOTIFY incubationBudgetChanged FINAL)
+    //! \copydoc incubationBudget
+    inline int      getIncubationBudget() const noexcept { return _incubationBudget; }
+    //! \copydoc incubationBudget
+    void            setIncubationBudget(int incubationBudget) noexcept;
+private:
+    //! \copydoc incubationBudget
+    int             _incubationBudget = 4;
+signals:
+    //! \copydoc incubationBudget
+    void            incubationBudgetChanged();
+
+public:
+    //! Number of node and edge items waiting for incubation (see \c asynchronous).
+    Q_PROPERTY(int itemsPending READ getItemsPending NOTIFY itemsPendingChanged FINAL)
+    //! \copydoc itemsPending
+    inline int      getItemsPending() const noexcept { return _itemsPending; }
+private:
+    //! \copydoc itemsPending
+    int             _itemsPending = 0;
+    //! Update \c itemsPending and eventually emit itemsIncubated().
+    void            updateItemsPending() noexcept;
+signals:
+    //! \copydoc itemsPending
+    void            itemsPendingChanged();
+    //! Emitted when all pending items have been incubated (ie when \c itemsPending become 0).
+    void            itemsIncubated();
+
+protected:
+    //! Queue a virtual node or edge \c primitive for asynchronous item incubation.
+    void            incubatePrimitive(QObject& primitive) noexcept;
+    //! Cancel all pending incubations, pending primitives stay virtual.
+    void            cancelIncubations() noexcept;
+    //! Schedule a processIncubations() call in graph event loop (multiple calls are coalesced).
+    void            scheduleIncubation() noexcept;
+protected slots:
+    //! Complete ready incubations and start queued incubations within \c incubationBudget.
+    void            processIncubations() noexcept;
+private:
+    //! Start \c primitive item incubation (or create it synchronously when a pooled item is available).
+    void            startIncubation(QObject& primitive) noexcept;
+    //! Configure \c incubator incubated item for its primitive (or park it if primitive is no longer virtual).
+    void            completeIncubation(qan::Incubator& incubator) noexcept;
+
+    //! Primitives waiting for incubation to start.
+    std::deque<QPointer<QObject>>                   _incubationQueue;
+    //! Running incubations.
+    std::vector<std::unique_ptr<qan::Incubator>>    _incubators;
+    //! Queued or incubating primitives.
+    std::unordered_set<const QObject*>              _incubatingPrimitives;
+    bool                                            _incubationScheduled = false;
+    //! Maximum number of simultaneously running incubations.
+    static constexpr std::size_t                    maxIncubators = 64;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Level of Detail Management *///---------------------------------
+    //@{
+public:
+    //! Graph rendering level of detail.
+    enum class LodLevel : unsigned int {
+        //! Node, group and edge items delegates are rendered.
+        Full = 0,
+        //! Nodes and groups are rendered as rectangles, edges as lines (see qan::LodItem).
+        Rects = 1,
+        //! Nodes are rendered as dots, groups as rectangles and edges as lines (see qan::LodItem).
+        Dots = 2
+    };
+    Q_ENUM(LodLevel)
+
+    /*! \brief Graph rendering level of detail (default to Full).
+     *
+     * When level is not \c Full, all node, group and edge items are culled (hidden, or released when
+     * \c virtualized is set) and graph is expected to be rendered by a lightweight qan::LodItem proxy.
+     *
+     * \note Usually set from qan::GraphView according to its zoom when its \c lod property is enabled.
+     */
+    Q_PROPERTY(qan::Graph::LodLevel lodLevel READ getLodLevel WRITE setLodLevel NOTIFY lodLevelChanged FINAL)
+    //! \copydoc lodLevel
+    inline LodLevel getLodLevel() const noexcept { return _lodLevel; }
+    //! \copydoc lodLevel
+    void            setLodLevel(LodLevel lodLevel) noexcept;
+private:
+    //! \copydoc lodLevel
+    LodLevel        _lodLevel = LodLevel::Full;
+signals:
+    //! \copydoc lodLevel
+    void            lodLevelChanged();
+    //! Emitted when geometry rendered at low level of detail might have changed (never emitted when \c lodLevel is Full).
+    void            lodGeometryChanged();
+
+public:
+    /*! \brief Collect graph geometry intersecting \c rect (in graph container CS) for level of detail rendering.
+     *
+     * \c groups and \c nodes are filled with groups and nodes rects (virtual nodes included), \c edges with
+     * lines between their source and destination centers. An empty \c rect collect all primitives.
+     */
+    void            collectLodGeometry(const QRectF& rect,
+                                       std::vector<QRectF>& groups,
+                                       std::vector<QRectF>& nodes,
+                                       std::vector<QLineF>& edges) const noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Batched Edges Management *///-----------------------------------
+    //@{
+public:
+    /*! \brief Draw edges with a single graph level qan::EdgeLayer instead of per edge QML delegates (default to false).
+     *
+     * When enabled, edges inserted without a specific delegate component use a lightweight
+     * Qan.BatchedEdge delegate: a qan::EdgeItem with \c batched set to true and no visual content,
+     * used only for edge logic and hit testing, while \c edgeLayer draws all batched edges lines and
+     * arrows grouped by style. Already inserted edges are not modified.
+     */
+    Q_PROPERTY(bool batchedEdges READ getBatchedEdges WRITE setBatchedEdges NOTIFY batchedEdgesChanged FINAL)
+    //! \copydoc batchedEdges
+    inline bool     getBatchedEdges() const noexcept { return _batchedEdges; }
+    //! \copydoc batchedEdges
+    void            setBatchedEdges(bool batchedEdges) noexcept;
+private:
+    //! \copydoc batchedEdges
+    bool            _batchedEdges = false;
+signals:
+    //! \copydoc batchedEdges
+    void            batchedEdgesChanged();
+
+public:
+    //! Layer drawing batched edges, nullptr until \c batchedEdges is enabled.
+    Q_PROPERTY(qan::EdgeLayer* edgeLayer READ getEdgeLayer NOTIFY edgeLayerChanged FINAL)
+    //! \copydoc edgeLayer
+    inline qan::EdgeLayer*  getEdgeLayer() const noexcept { return _edgeLayer.data(); }
+private:
+    //! \copydoc edgeLayer
+    QPointer<qan::EdgeLayer>    _edgeLayer;
+signals:
+    //! \copydoc edgeLayer
+    void                    edgeLayerChanged();
+
+protected:
+    //! Return Qan.BatchedEdge delegate used for edges inserted while \c batchedEdges is enabled (created on first call).
+    QQmlComponent*          getBatchedEdgeDelegate() noexcept;
+private:
+    std::unique_ptr<QQmlComponent>  _batchedEdgeDelegate;
+    //@}
+    //-------------------------------------------------------------------------
+
     /*! \name Topology Algorithms *///-----------------------------------------
     //@{
 public:
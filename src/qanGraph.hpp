@@ -57,35 +57,19 @@ Node_t*  Graph::insertNode(QQmlComponent* nodeComponent, qan::NodeStyle* nodeSty
         if (nodeStyle == nullptr)
             nodeStyle = Node_t::style(nullptr);
         _styleManager.setStyleComponent(nodeStyle, nodeComponent);      // nullptr nodeComponent is ok
-        qan::NodeItem* nodeItem = nodeComponent != nullptr ? static_cast<qan::NodeItem*>(createFromComponent(nodeComponent,
-                                                                                                              *nodeStyle,
-                                                                                                              node)) :
-                                                             nullptr;
+        const auto virtualNode = nodeComponent != nullptr &&
+                                 nodeStyle != nullptr &&
+                                 virtualizeNode(*node, *nodeComponent, *nodeStyle); // Virtual node item is created later
+        qan::NodeItem* nodeItem = nodeComponent != nullptr && !virtualNode ? static_cast<qan::NodeItem*>(createFromComponent(nodeComponent,
+                                                                                                                              *nodeStyle,
+                                                                                                                              node)) :
+                                                                             nullptr;
 
         if (nodeItem != nullptr) {
             nodeItem->setNode(node);
             nodeItem->setGraph(this);
             node->setItem(nodeItem);
-            auto notifyNodeClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
-                if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
-                    emit this->nodeClicked(nodeItem->getNode(), p);
-            };
-            connect(nodeItem, &qan::NodeItem::nodeClicked,
-                    this,     notifyNodeClicked);
-
-            auto notifyNodeRightClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
-                if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
-                    emit this->nodeRightClicked(nodeItem->getNode(), p);
-            };
-            connect(nodeItem, &qan::NodeItem::nodeRightClicked,
-                    this,     notifyNodeRightClicked);
-
-            auto notifyNodeDoubleClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
-                if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
-                    emit this->nodeDoubleClicked(nodeItem->getNode(), p);
-            };
-            connect(nodeItem, &qan::NodeItem::nodeDoubleClicked,
-                    this,     notifyNodeDoubleClicked);
+            connectNodeItem(*nodeItem);
             {   // Send item to front
                 _maxZ += 1;
                 nodeItem->setZ(_maxZ);
@@ -101,6 +85,10 @@ Node_t*  Graph::insertNode(QQmlComponent* nodeComponent, qan::NodeStyle* nodeSty
         return nullptr; // node eventually destroyed by shared_ptr
     }
     if (node != nullptr) {       // Notify user.
+        if (node->getItem() != nullptr)
+            configureSpatialItem(*node->getItem());
+        if (_orthoRouting)
+            configureOrthoObstacle(*node);
         onNodeInserted(*node);
         emit nodeInserted(node);
     }
@@ -133,6 +121,9 @@ qan::Edge*  Graph::insertEdge(qan::Node& src, qan::Node* dstNode, QQmlComponent*
 {
     if (dstNode == nullptr)
         return nullptr;
+    if (edgeComponent == nullptr &&
+        _batchedEdges)
+        edgeComponent = getBatchedEdgeDelegate();   // Lightweight delegate drawn by graph edge layer
     if (edgeComponent == nullptr) {
         const auto engine = qmlEngine(this);
         if (engine != nullptr)
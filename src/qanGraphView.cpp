@@ -32,6 +32,10 @@
 // \date    2016 08 15
 //-----------------------------------------------------------------------------
 
+// Std headers
+#include <algorithm>
+#include <vector>
+
 // Qt headers
 #include <QtNumeric>
 #include <QQuickItem>
@@ -48,6 +52,16 @@ GraphView::GraphView(QQuickItem* parent) :
     qan::Navigable{parent}
 {
     setFocus(true);
+    // Note: Container item is modified directly by navigable pan/zoom/fit code, monitoring
+    // its geometry is more reliable than containerItemModified().
+    connect(getContainerItem(), &QQuickItem::xChanged,      this, &GraphView::updateCullRect);
+    connect(getContainerItem(), &QQuickItem::yChanged,      this, &GraphView::updateCullRect);
+    connect(getContainerItem(), &QQuickItem::scaleChanged,  this, &GraphView::updateCullRect);
+    connect(this,               &QQuickItem::widthChanged,  this, &GraphView::updateCullRect);
+    connect(this,               &QQuickItem::heightChanged, this, &GraphView::updateCullRect);
+
+    _lodItem = new qan::LodItem{getContainerItem()};
+    connect(this, &qan::Navigable::zoomChanged, this, &GraphView::updateLod);
 }
 
 void    GraphView::setGraph(qan::Graph* graph)
@@ -57,8 +71,11 @@ void    GraphView::setGraph(qan::Graph* graph)
         return;
     }
     if (graph != _graph) {
-        if (_graph != nullptr)
+        if (_graph != nullptr) {
             disconnect(_graph, 0, this, 0);
+            _graph->setCullRect(QRectF{});
+            _graph->setLodLevel(qan::Graph::LodLevel::Full);
+        }
         _graph = graph;
         auto graphViewQmlContext = qmlContext(this);
         QQmlEngine::setContextForObject(getContainerItem(), graphViewQmlContext);
@@ -92,6 +109,9 @@ void    GraphView::setGraph(qan::Graph* graph)
                 this,   &qan::GraphView::groupRightClicked);
         connect(_graph, &qan::Graph::groupDoubleClicked,
                 this,   &qan::GraphView::groupDoubleClicked);
+        _lodItem->setGraph(_graph);
+        updateCullRect();
+        updateLod();
         emit graphChanged();
     }
 }
@@ -121,7 +141,113 @@ QString GraphView::urlToLocalFile(QUrl url) const noexcept
 //-----------------------------------------------------------------------------
 
 
+/* Viewport Culling Management *///--------------------------------------------
+void    GraphView::setCulling(bool culling) noexcept
+{
+    if (culling != _culling) {
+        _culling = culling;
+        updateCullRect();
+        emit cullingChanged();
+    }
+}
+
+void    GraphView::setCullingMargin(qreal cullingMargin) noexcept
+{
+    cullingMargin = std::max(0., cullingMargin);
+    if (!qFuzzyCompare(1. + cullingMargin, 1. + _cullingMargin)) {
+        _cullingMargin = cullingMargin;
+        updateCullRect();
+        emit cullingMarginChanged();
+    }
+}
+
+void    GraphView::updateCullRect()
+{
+    if (!_graph)
+        return;
+    const auto containerItem = getContainerItem();
+    if (!_culling ||
+        containerItem == nullptr ||
+        width() <= 0. || height() <= 0.) {
+        _graph->setCullRect(QRectF{});
+        return;
+    }
+    const auto mx = width() * _cullingMargin;
+    const auto my = height() * _cullingMargin;
+    _graph->setCullRect(mapRectToItem(containerItem, QRectF{-mx, -my, width() + 2. * mx, height() + 2. * my}));
+}
+//-----------------------------------------------------------------------------
+
+
+/* Level of Detail Management *///---------------------------------------------
+void    GraphView::setLod(bool lod) noexcept
+{
+    if (lod != _lod) {
+        _lod = lod;
+        updateLod();
+        emit lodChanged();
+    }
+}
+
+void    GraphView::setLodRectsZoom(qreal lodRectsZoom) noexcept
+{
+    lodRectsZoom = std::max(0., lodRectsZoom);
+    if (!qFuzzyCompare(1. + lodRectsZoom, 1. + _lodRectsZoom)) {
+        _lodRectsZoom = lodRectsZoom;
+        updateLod();
+        emit lodRectsZoomChanged();
+    }
+}
+
+void    GraphView::setLodDotsZoom(qreal lodDotsZoom) noexcept
+{
+    lodDotsZoom = std::max(0., lodDotsZoom);
+    if (!qFuzzyCompare(1. + lodDotsZoom, 1. + _lodDotsZoom)) {
+        _lodDotsZoom = lodDotsZoom;
+        updateLod();
+        emit lodDotsZoomChanged();
+    }
+}
+
+void    GraphView::updateLod()
+{
+    if (!_graph)
+        return;
+    const auto zoom = getZoom();
+    if (_lodItem != nullptr)
+        _lodItem->setZoom(zoom);
+    auto lodLevel = qan::Graph::LodLevel::Full;
+    if (_lod) {
+        if (zoom < _lodDotsZoom)
+            lodLevel = qan::Graph::LodLevel::Dots;
+        else if (zoom < _lodRectsZoom)
+            lodLevel = qan::Graph::LodLevel::Rects;
+    }
+    _graph->setLodLevel(lodLevel);
+}
+//-----------------------------------------------------------------------------
+
+
 /* Selection Rectangle Management *///-----------------------------------------
+//! Return the parts of \c a that are not covered by \c b (at most 4 strips).
+static auto subtractRect(const QRectF& a, const QRectF& b) -> std::vector<QRectF>
+{
+    const auto i = a.intersected(b);
+    if (i.isEmpty())
+        return std::vector<QRectF>{a};
+    std::vector<QRectF> strips;
+    strips.reserve(4);
+    if (i.top() > a.top())
+        strips.emplace_back(QPointF{a.left(), a.top()}, QPointF{a.right(), i.top()});
+    if (i.bottom() < a.bottom())
+        strips.emplace_back(QPointF{a.left(), i.bottom()}, QPointF{a.right(), a.bottom()});
+    if (i.left() > a.left())
+        strips.emplace_back(QPointF{a.left(), i.top()}, QPointF{i.left(), i.bottom()});
+    if (i.right() < a.right())
+        strips.emplace_back(QPointF{i.right(), i.top()}, QPointF{a.right(), i.bottom()});
+    return strips;
+}
+
 void    GraphView::selectionRectActivated(const QRectF& rect)
 {
     if (!_graph ||
@@ -129,82 +255,88 @@ void    GraphView::selectionRectActivated(const QRectF& rect)
         return;
     if (rect.isEmpty())
         return;
+    const auto containerItem = _graph->getContainerItem();
+    const auto& spatialIndex = _graph->getSpatialIndex();
+    const auto isInside = [&rect, &spatialIndex](const QQuickItem* item) -> bool {
+        const auto itemRect = spatialIndex.getRect(static_cast<const QObject*>(item));
+        if (itemRect == nullptr)
+            return false;
+        auto itemBr = *itemRect;
+        if (qFuzzyIsNull(itemBr.height()))  // Note: rect.contains does not work with 0 width/height
+            itemBr.setHeight(0.5);          // br, set minimum width/height to 0.5, to allow vertical /
+        if (qFuzzyIsNull(itemBr.width()))   // horizontal line selection for example.
+            itemBr.setWidth(0.5);
+        return rect.contains(itemBr);
+    };
+
     // Algorithm:
-    // 1. Iterate over all already selected items, remove one that are no longer inside selection rect
-    //    (for example, if selection rect has grown down...)
-    // 2. Iterate over all graph items, select items inside selection rect.
+    // 1. Query graph spatial index only in the areas that differ between previous and current
+    //    selection rect: an item entering or leaving the selection necessarily intersect
+    //    one of theses areas. Whole rect is queried on first activation.
+    // 2. Deselect previously selected items that are no longer inside selection rect.
+    // 3. Select top level items (direct container childs) that are now inside selection rect.
+    // Selection changes are applied in a single graph selection batch.
 
     // 1.
-    QSetIterator<QQuickItem*> selectedItem(_selectedItems);
-    while (selectedItem.hasNext()) {
-        const auto item = selectedItem.next();
-        auto nodeItem = qobject_cast<qan::NodeItem*>(item);
-        if (nodeItem != nullptr &&
-            nodeItem->getNode() != nullptr ) {
-            const auto itemBr = item->mapRectToItem(_graph->getContainerItem(),
-                                                    item->boundingRect());
-            if (!rect.contains(itemBr)) {
+    std::vector<QRectF> deltaRects;
+    if (_selectionRect.isEmpty())
+        deltaRects.push_back(rect);
+    else {
+        deltaRects = subtractRect(rect, _selectionRect);
+        const auto leftRects = subtractRect(_selectionRect, rect);
+        deltaRects.insert(deltaRects.end(), leftRects.cbegin(), leftRects.cend());
+    }
+    _selectionRect = rect;
+    QSet<QQuickItem*> candidates;
+    for (const auto& deltaRect : deltaRects)
+        for (const auto item : _graph->queryItems(deltaRect))
+            candidates.insert(item);
+
+    _graph->beginSelectionBatch();
+    for (const auto item : std::as_const(candidates)) {
+        const auto selected = _selectedItems.contains(item);
+        const auto inside = isInside(item);
+        if (selected == inside)
+            continue;
+        if (selected) {     // 2.
+            const auto nodeItem = qobject_cast<qan::NodeItem*>(item);
+            if (nodeItem != nullptr &&
+                nodeItem->getNode() != nullptr)
                 _graph->setNodeSelected(*nodeItem->getNode(), false);
-                _selectedItems.remove(item);
-            }
-        } else {
-            auto edgeItem = qobject_cast<qan::EdgeItem*>(item);
-            if (edgeItem != nullptr &&
-                edgeItem->getEdge() != nullptr) {
-                auto itemBr = item->mapRectToItem(_graph->getContainerItem(),
-                                                        item->boundingRect());
-                if (qFuzzyIsNull(itemBr.height()))  // Note: rect.contains does not work with 0 width/height
-                    itemBr.setHeight(0.5);          // br, set minimum width/height to 0.5, to allow vertical /
-                if (qFuzzyIsNull(itemBr.width()))   // horizontal line selection for example.
-                    itemBr.setWidth(0.5);
-                if (!rect.contains(itemBr)) {
+            else {
+                const auto edgeItem = qobject_cast<qan::EdgeItem*>(item);
+                if (edgeItem != nullptr &&
+                    edgeItem->getEdge() != nullptr)
                     _graph->setEdgeSelected(edgeItem->getEdge(), false);
-                    _selectedItems.remove(item);
-                }
             }
-        }
-    }
-
-    // 2.
-    const auto items = _graph->getContainerItem()->childItems();
-    for (const auto item: items) {
-        auto nodeItem = qobject_cast<qan::NodeItem*>(item);
-        if (nodeItem != nullptr &&
-            nodeItem->isSelectable() &&
-            nodeItem->getNode() != nullptr) {
-            auto node = nodeItem->getNode();
-            const auto itemBr = item->mapRectToItem(_graph->getContainerItem(),
-                                                    item->boundingRect());
-            if (rect.contains(itemBr)) {
-                _graph->setNodeSelected(*node, true);
-                // Note we assume that items are not deleted while the selection
-                // is in progress... (QPointer can't be trivially inserted in QSet)
-                _selectedItems.insert(nodeItem);
-            }
-        } else {
-            // 3. Edge selection...
-            auto edgeItem = qobject_cast<qan::EdgeItem*>(item);
-            if (edgeItem != nullptr &&
-                edgeItem->getEdge() != nullptr) {
-                auto itemBr = item->mapRectToItem(_graph->getContainerItem(),
-                                                  item->boundingRect());
-                if (qFuzzyIsNull(itemBr.height()))  // Note: rect.contains does not work with 0 width/height
-                    itemBr.setHeight(0.5);          // br, set minimum width/height to 0.5, to allow vertical /
-                if (qFuzzyIsNull(itemBr.width()))   // horizontal line selection for example.
-                    itemBr.setWidth(0.5);
-                if (rect.contains(itemBr)) {
-                    auto edge = edgeItem->getEdge();
-                    _graph->setEdgeSelected(edge, true);
+            _selectedItems.remove(item);
+        } else if (item->parentItem() == containerItem) {   // 3.
+            const auto nodeItem = qobject_cast<qan::NodeItem*>(item);
+            if (nodeItem != nullptr) {
+                if (nodeItem->isSelectable() &&
+                    nodeItem->getNode() != nullptr) {
+                    _graph->setNodeSelected(*nodeItem->getNode(), true);
+                    // Note we assume that items are not deleted while the selection
+                    // is in progress... (QPointer can't be trivially inserted in QSet)
+                    _selectedItems.insert(nodeItem);
+                }
+            } else {
+                const auto edgeItem = qobject_cast<qan::EdgeItem*>(item);
+                if (edgeItem != nullptr &&
+                    edgeItem->getEdge() != nullptr) {
+                    _graph->setEdgeSelected(edgeItem->getEdge(), true);
                     _selectedItems.insert(edgeItem);
                 }
             }
         }
     }
+    _graph->endSelectionBatch();
 }
 
 void    GraphView::selectionRectEnd()
 {
     _selectedItems.clear();  // Clear selection cache
+    _selectionRect = QRectF{};
 }
 
 void    GraphView::keyPressEvent(QKeyEvent *event)
@@ -39,6 +39,7 @@
 #include "./qanGroup.h"
 #include "./qanNavigable.h"
 #include "./qanPortItem.h"
+#include "./qanLodItem.h"
 
 // Qt headers
 #include <QQuickItem>
@@ -109,6 +110,115 @@ signals:
     //-------------------------------------------------------------------------
 
 
+    /*! \name Viewport Culling Management *///---------------------------------
+    //@{
+public:
+    /*! \brief Enable viewport culling: graph items outside view are culled until they scroll into view (default to false).
+     *
+     * Culled node and group items are hidden, culled edges are hidden and their geometry is no longer
+     * updated. Graph cull rect is view rect in graph container CS inflated by \c cullingMargin,
+     * it is updated on pan, zoom and view resize.
+     * \sa qan::Graph::setCullRect()
+     */
+    Q_PROPERTY(bool culling READ getCulling WRITE setCulling NOTIFY cullingChanged FINAL)
+    //! \copydoc culling
+    inline bool     getCulling() const noexcept { return _culling; }
+    //! \copydoc culling
+    void            setCulling(bool culling) noexcept;
+private:
+    //! \copydoc culling
+    bool            _culling = false;
+signals:
+    //! \copydoc culling
+    void            cullingChanged();
+
+public:
+    //! Margin added around view rect for culling, as a fraction of view size (default to 0.25, ie a quarter of view width/height on each side).
+    Q_PROPERTY(qreal cullingMargin READ getCullingMargin WRITE setCullingMargin NOTIFY cullingMarginChanged FINAL)
+    //! \copydoc cullingMargin
+    inline qreal    getCullingMargin() const noexcept { return _cullingMargin; }
+    //! \copydoc cullingMargin
+    void            setCullingMargin(qreal cullingMargin) noexcept;
+private:
+    //! \copydoc cullingMargin
+    qreal           _cullingMargin = 0.25;
+signals:
+    //! \copydoc cullingMargin
+    void            cullingMarginChanged();
+
+protected slots:
+    //! Update graph cull rect from current view rect (or disable graph culling when \c culling is false).
+    void            updateCullRect();
+    //@}
+    //-------------------------------------------------------------------------
+
+
+    /*! \name Level of Detail Management *///---------------------------------
+    //@{
+public:
+    /*! \brief Enable level of detail proxies at low zoom levels (default to false).
+     *
+     * When zoom is below \c lodRectsZoom, graph delegates are culled (or released when graph is
+     * virtualized) and replaced by flat rectangles and lines drawn by \c lodItem, below \c lodDotsZoom
+     * nodes are drawn as dots.
+     * \sa qan::Graph::lodLevel
+     */
+    Q_PROPERTY(bool lod READ getLod WRITE setLod NOTIFY lodChanged FINAL)
+    //! \copydoc lod
+    inline bool     getLod() const noexcept { return _lod; }
+    //! \copydoc lod
+    void            setLod(bool lod) noexcept;
+private:
+    //! \copydoc lod
+    bool            _lod = false;
+signals:
+    //! \copydoc lod
+    void            lodChanged();
+
+public:
+    //! Zoom under which nodes and groups are drawn as rectangles (default to 0.4).
+    Q_PROPERTY(qreal lodRectsZoom READ getLodRectsZoom WRITE setLodRectsZoom NOTIFY lodRectsZoomChanged FINAL)
+    //! \copydoc lodRectsZoom
+    inline qreal    getLodRectsZoom() const noexcept { return _lodRectsZoom; }
+    //! \copydoc lodRectsZoom
+    void            setLodRectsZoom(qreal lodRectsZoom) noexcept;
+private:
+    //! \copydoc lodRectsZoom
+    qreal           _lodRectsZoom = 0.4;
+signals:
+    //! \copydoc lodRectsZoom
+    void            lodRectsZoomChanged();
+
+public:
+    //! Zoom under which nodes are drawn as dots (default to 0.15).
+    Q_PROPERTY(qreal lodDotsZoom READ getLodDotsZoom WRITE setLodDotsZoom NOTIFY lodDotsZoomChanged FINAL)
+    //! \copydoc lodDotsZoom
+    inline qreal    getLodDotsZoom() const noexcept { return _lodDotsZoom; }
+    //! \copydoc lodDotsZoom
+    void            setLodDotsZoom(qreal lodDotsZoom) noexcept;
+private:
+    //! \copydoc lodDotsZoom
+    qreal           _lodDotsZoom = 0.15;
+signals:
+    //! \copydoc lodDotsZoom
+    void            lodDotsZoomChanged();
+
+public:
+    //! Proxy item drawing graph at low level of detail, could be used to configure proxy colors.
+    Q_PROPERTY(qan::LodItem* lodItem READ getLodItem CONSTANT FINAL)
+    //! \copydoc lodItem
+    inline qan::LodItem*    getLodItem() const noexcept { return _lodItem; }
+private:
+    //! \copydoc lodItem
+    qan::LodItem*   _lodItem = nullptr;
+
+protected slots:
+    //! Update graph level of detail from current view zoom (or set it to Full when \c lod is false).
+    void            updateLod();
+    //@}
+    //-------------------------------------------------------------------------
+
+
     /*! \name Selection Rectangle Management *///------------------------------
     //@{
 protected:
@@ -119,6 +229,8 @@ protected:
     virtual void    selectionRectEnd() override;
 private:
     QSet<QQuickItem*>   _selectedItems;
+    //! Selection rect for last selectionRectActivated() call, empty when no selection is in progress.
+    QRectF              _selectionRect;
 
 protected:
     virtual void    keyPressEvent(QKeyEvent *event) override;
@@ -108,7 +108,7 @@ void    GroupItem::setCollapsed(bool collapsed) noexcept
         for (auto edge : adjacentEdges) {    // When a group is collapsed, all adjacent edges shouldbe hidden/shown...
             if (edge &&
                 edge->getItem() != nullptr)
-                edge->getItem()->setVisible(!getCollapsed());
+                edge->getItem()->setItemVisible(!getCollapsed());
         }
         if (!getCollapsed())
             groupMoved();   // Force update of all adjacent edges
@@ -138,7 +138,21 @@ void    GroupItem::groupMoved()
 {
     if (getCollapsed())   // Do not update edges when the group is collapsed
         return;
+    auto graph = getGraph();
+    if (graph == nullptr) {
+        updateAdjacentEdges();
+        return;
+    }
+    graph->getFrameScheduler()->schedule(this, [groupItem = QPointer<qan::GroupItem>{this}]() {
+        if (groupItem)
+            groupItem->updateAdjacentEdges();
+    }, qan::FrameScheduler::Priority::High);
+}
 
+void    GroupItem::updateAdjacentEdges()
+{
+    if (getCollapsed())
+        return;
     // Group node adjacent edges must be updated manually since node are children of this group,
     // their x an y position does not change and is no longer monitored by their edges.
     if (_group) {
@@ -146,7 +160,7 @@ void    GroupItem::groupMoved()
         for (auto edge : adjacentEdges) {
             if (edge != nullptr &&
                 edge->getItem() != nullptr)
-                edge->getItem()->updateItem(); // Edge is updated even is edge item visible=false, updateItem() will take care of visibility
+                edge->getItem()->scheduleUpdateItem(); // Edge is updated even is edge item visible=false, updateItem() will take care of visibility
         }
     }
 }
@@ -178,7 +192,7 @@ void    GroupItem::ungroupNodeItem(qan::NodeItem* nodeItem, bool transform)
         return;
     if (getGraph() &&
         getGraph()->getContainerItem() != nullptr) {
-        const QPointF nodeGlobalPos = mapToItem(getGraph()->getContainerItem(), nodeItem->position());
+        const QPointF nodeGlobalPos = getGlobalTransform(getGraph()->getContainerItem()).map(nodeItem->position());
         nodeItem->setParentItem(getGraph()->getContainerItem());
         if (transform)
             nodeItem->setPosition(nodeGlobalPos + QPointF{10., 10.});
@@ -149,9 +149,17 @@ signals:
 
 
 protected slots:
-    //! Group is monitored for position change, since group's nodes edges should be updated manually in that case.
+    /*! \brief Group is monitored for position change, since group's nodes edges should be updated manually in that case.
+     *
+     * Adjacent edges update is deferred to graph frame scheduler: a group moved many times in a frame
+     * collect its adjacent edges only once.
+     */
     void            groupMoved();
 
+protected:
+    //! Schedule geometry update of all group adjacent edges (group nodes edges and group edges).
+    void            updateAdjacentEdges();
+
 public:
     /*! \brief Configure \c nodeItem in this group item (modify target item parenthcip, but keep same visual position).
      */
@@ -0,0 +1,87 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanIncubator.h
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <functional>
+
+// Qt headers
+#include <QObject>
+#include <QPointer>
+#include <QQmlIncubator>
+#include <QQmlComponent>
+
+namespace qan { // ::qan
+
+/*! \brief Incubate a graph primitive (node or edge) delegate item asynchronously.
+ *
+ * Incubator keep track of the primitive and delegate component it has been created for, and
+ * call a user provided functor to configure the incubated object before bindings are evaluated
+ * (equivalent to configuring an object between QQmlComponent::beginCreate() and completeCreate()).
+ *
+ * \sa qan::Graph::asynchronous
+ * \nosubgrouping
+ */
+class Incubator : public QQmlIncubator
+{
+    /*! \name Incubator Object Management *///--------------------------------
+    //@{
+public:
+    using InitialState = std::function<void(QObject*)>;
+
+    explicit Incubator(QObject* primitive, QQmlComponent* component,
+                       InitialState initialState) noexcept;
+    virtual ~Incubator() override = default;
+    Incubator(const Incubator&) = delete;
+    Incubator& operator=(const Incubator&) = delete;
+
+public:
+    //! Primitive (qan::Node or qan::Edge) incubated item has been created for (might be nullptr if primitive has been destroyed).
+    inline QObject*         getPrimitive() const noexcept { return _primitive.data(); }
+    //! Delegate component used for incubation.
+    inline QQmlComponent*   getComponent() const noexcept { return _component.data(); }
+
+protected:
+    virtual void            setInitialState(QObject* object) override;
+
+private:
+    QPointer<QObject>       _primitive;
+    QPointer<QQmlComponent> _component;
+    InitialState            _initialState;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
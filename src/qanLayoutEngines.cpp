@@ -0,0 +1,974 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanLayoutEngines.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <thread>
+
+// Qt headers
+#include <QRandomGenerator>
+#include <QSemaphore>
+#include <QThreadPool>
+
+// QuickQanava headers
+#include "./qanLayoutEngines.h"
+
+namespace qan { // ::qan
+
+/* LayoutGraph *///------------------------------------------------------------
+QPointF LayoutGraph::getPosition(int n) const noexcept
+{
+    return n >= 0 && n < static_cast<int>(positions.size()) ? positions[n] :
+                                                              QPointF{0., 0.};
+}
+
+auto    LayoutGraph::getOutNodes() const noexcept -> std::vector<std::vector<int>>
+{
+    const auto n = getNodeCount();
+    std::vector<std::vector<int>> outNodes(n);
+    for (const auto& edge: edges) {
+        if (edge.first < 0 || edge.first >= n ||
+            edge.second < 0 || edge.second >= n ||
+            edge.first == edge.second)
+            continue;
+        outNodes[edge.first].push_back(edge.second);
+    }
+    return outNodes;
+}
+//-----------------------------------------------------------------------------
+
+
+/* RandomLayoutEngine *///-----------------------------------------------------
+LayoutResult    RandomLayoutEngine::layout(const LayoutGraph& graph) const noexcept
+{
+    LayoutResult result;
+    result.positions.reserve(graph.sizes.size());
+    QRandomGenerator seededGenerator{seed};
+    const auto generator = seed != 0 ? &seededGenerator :
+                                       QRandomGenerator::global();
+    for (const auto& size: graph.sizes) {
+        const auto maxX = std::max(0., layoutRect.width() - size.width());    // Generate random x and y positions
+        const auto maxY = std::max(0., layoutRect.height() - size.height());  // within available layoutRect area
+        result.positions.push_back(QPointF{generator->bounded(maxX) + layoutRect.left(),
+                                           generator->bounded(maxY) + layoutRect.top()});
+    }
+    return result;
+}
+//-----------------------------------------------------------------------------
+
+
+/* LayeredLayoutEngine *///----------------------------------------------------
+//! Lay out \c nodes in a square grid with top left corner at (0, \c top), return grid bottom (including a trailing \c spacing).
+static qreal    layoutGrid(const std::vector<int>& nodes, const std::vector<QSizeF>& sizes,
+                           std::vector<QPointF>& positions, qreal top, qreal spacing) noexcept
+{
+    if (nodes.empty())
+        return top;
+    const auto columns = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(nodes.size()))));
+    const auto rows = (nodes.size() + columns - 1) / columns;
+    std::vector<qreal> columnWidths(columns, 0.);
+    std::vector<qreal> rowHeights(rows, 0.);
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        const auto& size = sizes[nodes[i]];
+        columnWidths[i % columns] = std::max(columnWidths[i % columns], size.width());
+        rowHeights[i / columns] = std::max(rowHeights[i / columns], size.height());
+    }
+    qreal rowY = top;
+    for (std::size_t row = 0; row < rows; row++) {
+        qreal x = 0.;
+        for (std::size_t column = 0; column < columns; column++) {
+            const auto i = row * columns + column;
+            if (i >= nodes.size())
+                break;
+            positions[nodes[i]] = QPointF{x, rowY};
+            x += columnWidths[column] + spacing;
+        }
+        rowY += rowHeights[row] + spacing;
+    }
+    return rowY;
+}
+
+LayoutResult    LayeredLayoutEngine::layout(const LayoutGraph& graph) const noexcept
+{
+    // Algorithm:
+    // 1. Remove cycles ignoring DFS back edges.
+    // 2. Longest path layering of nodes with edges.
+    // 3. Order layers nodes by predecessors barycenter.
+    // 4. Generate layers geometry, layers are horizontally centered.
+    // 5. Lay out isolated nodes (without edges) in a grid below layers.
+    // 6. Generate straight edge paths.
+    const auto& sizes = graph.sizes;
+    const auto& edges = graph.edges;
+    const int n = graph.getNodeCount();
+    LayoutResult result;
+    auto& positions = result.positions;
+    positions.resize(n);
+    if (n == 0)
+        return result;
+
+    std::vector<std::vector<int>> outs(n);
+    std::vector<char> connected(n, 0);
+    for (const auto& edge: edges) {
+        if (edge.first < 0 || edge.first >= n ||
+            edge.second < 0 || edge.second >= n ||
+            edge.first == edge.second)
+            continue;
+        outs[edge.first].push_back(edge.second);
+        connected[edge.first] = connected[edge.second] = 1;
+    }
+
+    // 1.
+    std::vector<std::vector<int>> dagOuts(n);
+    std::vector<std::vector<int>> dagIns(n);
+    {
+        enum : char { Unvisited = 0, Visiting = 1, Visited = 2 };
+        std::vector<char> marks(n, Unvisited);
+        std::vector<std::pair<int, std::size_t>> stack;    // node, next out edge
+        for (int root = 0; root < n; root++) {
+            if (!connected[root] ||
+                marks[root] != Unvisited)
+                continue;
+            stack.emplace_back(root, 0);
+            marks[root] = Visiting;
+            while (!stack.empty()) {
+                auto& [node, next] = stack.back();
+                if (next >= outs[node].size()) {
+                    marks[node] = Visited;
+                    stack.pop_back();
+                    continue;
+                }
+                const auto child = outs[node][next++];
+                if (marks[child] == Visiting)   // Back edge, ignore it
+                    continue;
+                dagOuts[node].push_back(child);
+                dagIns[child].push_back(node);
+                if (marks[child] == Unvisited) {
+                    marks[child] = Visiting;
+                    stack.emplace_back(child, 0);   // Warning: invalidate node and next references
+                }
+            }
+        }
+    }
+
+    // 2.
+    std::vector<int> layers(n, 0);
+    std::vector<std::vector<int>> layerMembers;
+    {
+        std::vector<int> inDegrees(n, 0);
+        std::queue<int> sources;
+        for (int v = 0; v < n; v++) {
+            inDegrees[v] = static_cast<int>(dagIns[v].size());
+            if (connected[v] &&
+                inDegrees[v] == 0)
+                sources.push(v);
+        }
+        while (!sources.empty()) {
+            const auto v = sources.front();
+            sources.pop();
+            if (layers[v] >= static_cast<int>(layerMembers.size()))
+                layerMembers.resize(layers[v] + 1);
+            layerMembers[layers[v]].push_back(v);
+            for (const auto w: dagOuts[v]) {
+                layers[w] = std::max(layers[w], layers[v] + 1);
+                if (--inDegrees[w] == 0)
+                    sources.push(w);
+            }
+        }
+    }
+
+    // 3.
+    std::vector<qreal> ranks(n, 0.);
+    std::vector<qreal> barycenters(n, 0.);  // Note: Only current layer members entries are written and read
+    for (auto& members: layerMembers) {
+        for (const auto v: members) {
+            if (dagIns[v].empty()) {
+                barycenters[v] = ranks[v];
+                continue;
+            }
+            qreal sum = 0.;
+            for (const auto u: dagIns[v])
+                sum += ranks[u];
+            barycenters[v] = sum / static_cast<qreal>(dagIns[v].size());
+        }
+        std::stable_sort(members.begin(), members.end(), [&barycenters](int a, int b) {
+            return barycenters[a] < barycenters[b];
+        });
+        for (std::size_t r = 0; r < members.size(); r++)
+            ranks[members[r]] = static_cast<qreal>(r);
+    }
+
+    // 4.
+    qreal maxWidth = 0.;
+    std::vector<qreal> layerWidths(layerMembers.size(), 0.);
+    std::vector<qreal> layerHeights(layerMembers.size(), 0.);
+    for (std::size_t l = 0; l < layerMembers.size(); l++) {
+        for (const auto v: layerMembers[l]) {
+            layerWidths[l] += sizes[v].width() + spacing;
+            layerHeights[l] = std::max(layerHeights[l], sizes[v].height());
+        }
+        layerWidths[l] -= spacing;
+        maxWidth = std::max(maxWidth, layerWidths[l]);
+    }
+    qreal y = 0.;
+    for (std::size_t l = 0; l < layerMembers.size(); l++) {
+        auto x = (maxWidth - layerWidths[l]) / 2.;
+        for (const auto v: layerMembers[l]) {
+            positions[v] = QPointF{x, y + (layerHeights[l] - sizes[v].height()) / 2.};
+            x += sizes[v].width() + spacing;
+        }
+        y += layerHeights[l] + spacing;
+    }
+
+    // 5.
+    std::vector<int> isolated;
+    for (int v = 0; v < n; v++)
+        if (!connected[v])
+            isolated.push_back(v);
+    layoutGrid(isolated, sizes, positions, y, spacing);
+
+    // 6.
+    result.edgePaths.resize(edges.size());
+    for (std::size_t e = 0; e < edges.size(); e++) {
+        const auto& edge = edges[e];
+        if (edge.first < 0 || edge.first >= n ||
+            edge.second < 0 || edge.second >= n ||
+            edge.first == edge.second)
+            continue;
+        const QRectF src{positions[edge.first], sizes[edge.first]};
+        const QRectF dst{positions[edge.second], sizes[edge.second]};
+        result.edgePaths[e] << QPointF{src.center().x(), src.bottom()}
+                            << QPointF{dst.center().x(), dst.top()};
+    }
+    return result;
+}
+//-----------------------------------------------------------------------------
+
+
+/* OrgTreeLayoutEngine *///----------------------------------------------------
+LayoutResult    OrgTreeLayoutEngine::layout(const LayoutGraph& graph) const noexcept
+{
+    std::vector<SubTreeState> states;
+    return layout(graph, states, nullptr);
+}
+
+LayoutResult    OrgTreeLayoutEngine::layout(const LayoutGraph& graph,
+                                            std::vector<SubTreeState>& states,
+                                            const std::vector<bool>* reusable) const noexcept
+{
+    // Note: Recursive variant of Reingold-Tilford algorithm with naive shifting (ie shifting
+    // based on the less space efficient sub tree bounding rect intersection...)
+
+    // Algorithm:
+        // Traverse graph DFS aligning child nodes vertically
+        // At a given level: `shift` next node according to previous node sub-tree BR
+        // Layout state is saved for every node to allow latter incremental layouts.
+    const auto n = graph.getNodeCount();
+    LayoutResult result;
+    result.positions.reserve(n);
+    for (int node = 0; node < n; node++)
+        result.positions.push_back(graph.getPosition(node));
+    if (root < 0 || root >= n)
+        return result;
+    states.resize(n);
+    if (reusable != nullptr &&
+        reusable->size() != static_cast<std::size_t>(n))
+        reusable = nullptr;
+
+    const auto outNodes = graph.getOutNodes();
+    Context ctx{graph, outNodes, states, reusable, result.positions, std::vector<bool>(n, false)};
+    ctx.onPath[root] = true;
+    layoutChilds_rec(ctx, root, QRectF{result.positions[root], graph.sizes[root]});
+    return result;
+}
+
+QRectF  OrgTreeLayoutEngine::layoutChilds_rec(Context& ctx, int node, QRectF br) const noexcept
+{
+    const auto& childNodes = ctx.outNodes[node];
+    // Mixed layout: vertical, but horizontal for leaf nodes.
+    auto horizontal = orientation == Orientation::Horizontal;
+    if (orientation == Orientation::Mixed)
+        horizontal = std::none_of(childNodes.cbegin(), childNodes.cend(),
+                                  [&ctx](int child) { return !ctx.outNodes[child].empty(); });
+    const auto anchor = horizontal ? br.bottom() + ySpacing :
+                                     br.right() + xSpacing;
+    for (const auto child: childNodes) {
+        if (ctx.onPath[child])   // Circuit, ignore child
+            continue;
+        br = layoutChild_rec(ctx, child, anchor, horizontal, br);
+    }
+    return br;
+}
+
+QRectF  OrgTreeLayoutEngine::layoutChild_rec(Context& ctx, int child, qreal anchor, bool horizontal, QRectF br) const noexcept
+{
+    // Note: Child subtree layout depends only on anchor, br right and br bottom: when they are all
+    // shifted by the same delta, the subtree could be translated as a whole instead of being laid out
+    // again. br left and top are only propagated to output br.
+    const auto& childSize = ctx.graph.sizes[child];
+    auto& childPosition = ctx.positions[child];
+    const auto getOutBr = [&childPosition, &childSize, horizontal](QRectF br, qreal extent) -> QRectF {
+        br = br.united(QRectF{childPosition, childSize});
+        if (horizontal)
+            br.setRight(extent);   // Note: Do not take full child BR into account to avoid x drifting
+        else
+            br.setBottom(extent);
+        return br;
+    };
+
+    auto& state = ctx.states[child];    // Note: states is not resized during recursion, references are stable
+    if (ctx.reusable != nullptr &&
+        (*ctx.reusable)[child] &&
+        state.valid &&
+        state.horizontal == horizontal) {
+        const QPointF delta{br.right() - state.right, br.bottom() - state.bottom};
+        const auto anchorDelta = anchor - state.anchor;
+        if (qAbs(anchorDelta - (horizontal ? delta.y() : delta.x())) < 0.001) {
+            if (!delta.isNull())
+                translateSubTree_rec(ctx, child, delta);
+            return getOutBr(br, state.extent);
+        }
+    }
+
+    state.valid = true;
+    state.horizontal = horizontal;
+    state.anchor = anchor;
+    state.right = br.right();
+    state.bottom = br.bottom();
+
+    childPosition = horizontal ? QPointF{br.right() + xSpacing, anchor} :
+                                 QPointF{anchor, br.bottom() + ySpacing};
+    // Take into account this level maximum width
+    br = br.united(QRectF{childPosition, childSize});
+    ctx.onPath[child] = true;
+    const auto childBr = layoutChilds_rec(ctx, child, br);
+    ctx.onPath[child] = false;
+    state.extent = horizontal ? childBr.right() : childBr.bottom();
+    return getOutBr(br, state.extent);
+}
+
+void    OrgTreeLayoutEngine::translateSubTree_rec(Context& ctx, int node, QPointF delta) const noexcept
+{
+    ctx.positions[node] += delta;
+    auto& state = ctx.states[node];
+    state.anchor += state.horizontal ? delta.y() : delta.x();
+    state.right += delta.x();
+    state.bottom += delta.y();
+    state.extent += state.horizontal ? delta.x() : delta.y();
+    ctx.onPath[node] = true;
+    for (const auto child: ctx.outNodes[node])
+        if (!ctx.onPath[child])
+            translateSubTree_rec(ctx, child, delta);
+    ctx.onPath[node] = false;
+}
+//-----------------------------------------------------------------------------
+
+/* MultilevelLayoutEngine *///-------------------------------------------------
+/*! \brief Run \c function(first, last) on chunks of [0, count) using up to \c threadCount threads.
+ *
+ * Chunks are run on global thread pool persistent threads, first chunk is run in caller thread,
+ * chunks that can't be started when pool is busy are run synchronously. Chunks have at least
+ * \c grainSize items.
+ */
+template <class Function>
+static void parallelFor(int count, int threadCount, Function&& function, int grainSize = 1024)
+{
+    // Note: Do not dispatch small levels, synchronization cost is not worth it.
+    const auto chunkCount = std::max(1, std::min(threadCount, count / std::max(1, grainSize)));
+    if (chunkCount <= 1) {
+        function(0, count);
+        return;
+    }
+    const auto chunkSize = (count + chunkCount - 1) / chunkCount;
+    QSemaphore  done;
+    int         chunks = 0;
+    for (int first = chunkSize; first < count; first += chunkSize, ++chunks) {
+        const auto last = std::min(count, first + chunkSize);
+        const auto task = [&function, &done, first, last]() {
+            function(first, last);
+            done.release();
+        };
+        if (!QThreadPool::globalInstance()->tryStart(task))
+            task();
+    }
+    function(0, std::min(count, chunkSize));
+    done.acquire(chunks);
+}
+
+//! Barnes-Hut quadtree of unit mass points.
+class BarnesHutTree
+{
+public:
+    void    build(const std::vector<QPointF>& positions) noexcept
+    {
+        _cells.clear();
+        if (positions.empty())
+            return;
+        qreal left = positions.front().x(), right = left;
+        qreal top = positions.front().y(), bottom = top;
+        for (const auto& p: positions) {
+            left = std::min(left, p.x());
+            right = std::max(right, p.x());
+            top = std::min(top, p.y());
+            bottom = std::max(bottom, p.y());
+        }
+        _cells.reserve(positions.size() * 2);
+        _cells.push_back(Cell{(left + right) / 2., (top + bottom) / 2.,
+                              std::max(right - left, bottom - top) / 2. + 1.});
+        for (int b = 0; b < static_cast<int>(positions.size()); b++)
+            insert(b, positions[b]);
+        for (auto& cell: _cells)    // Convert coordinates sums to center of mass
+            if (cell.mass > 0.) {
+                cell.mx /= cell.mass;
+                cell.my /= cell.mass;
+            }
+    }
+
+    //! Return repulsive force applied on body \c b at \c p: sum of k2 / d for all other bodies.
+    QPointF repulsion(int b, const QPointF& p, qreal k2, qreal theta) const noexcept
+    {
+        QPointF force{0., 0.};
+        if (_cells.empty())
+            return force;
+        const auto addForce = [&force, &p, k2, b](qreal mass, qreal x, qreal y) {
+            auto dx = p.x() - x;
+            auto dy = p.y() - y;
+            auto d2 = dx * dx + dy * dy;
+            if (d2 < 0.0001) {      // Coincident bodies, push in a body dependent direction
+                dx = 0.01 * std::cos(static_cast<qreal>(b));
+                dy = 0.01 * std::sin(static_cast<qreal>(b));
+                d2 = 0.0001;
+            }
+            force += QPointF{dx, dy} * (mass * k2 / d2);
+        };
+        int stack[4 * maxDepth + 4];    // Note: depth first traversal, at most 3 pending siblings per level
+        int top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            const auto& cell = _cells[stack[--top]];
+            if (cell.mass <= 0.)
+                continue;
+            const auto contains = std::abs(p.x() - cell.cx) <= cell.half &&
+                                  std::abs(p.y() - cell.cy) <= cell.half;
+            if (cell.child < 0) {
+                if (cell.body == b)
+                    continue;
+                if (cell.body == aggregated && contains) {  // Remove b from aggregated leaf
+                    const auto mass = cell.mass - 1.;
+                    if (mass > 0.)
+                        addForce(mass, (cell.mx * cell.mass - p.x()) / mass,
+                                       (cell.my * cell.mass - p.y()) / mass);
+                    continue;
+                }
+                addForce(cell.mass, cell.mx, cell.my);
+                continue;
+            }
+            const auto dx = p.x() - cell.mx;
+            const auto dy = p.y() - cell.my;
+            const auto size = 2. * cell.half;
+            if (!contains &&
+                size * size < theta * theta * (dx * dx + dy * dy))
+                addForce(cell.mass, cell.mx, cell.my);
+            else
+                for (int c = 0; c < 4; c++)
+                    stack[top++] = cell.child + c;
+        }
+        return force;
+    }
+
+private:
+    static constexpr int maxDepth = 24;
+    static constexpr int aggregated = -2;
+
+    struct Cell {
+        qreal   cx = 0.;
+        qreal   cy = 0.;
+        qreal   half = 0.;
+        qreal   mass = 0.;
+        //! Coordinates sum during build(), then center of mass.
+        qreal   mx = 0.;
+        qreal   my = 0.;
+        //! First of the four child cells, -1 for leaves.
+        int     child = -1;
+        //! Leaf body, -1 for empty cells, aggregated for maxDepth leaves with multiple bodies.
+        int     body = -1;
+    };
+    std::vector<Cell>   _cells;
+
+    static int  getQuadrant(const Cell& cell, const QPointF& p) noexcept
+    {
+        return (p.x() >= cell.cx ? 1 : 0) + (p.y() >= cell.cy ? 2 : 0);
+    }
+
+    void    insert(int b, const QPointF& p) noexcept
+    {
+        const auto addBody = [this, &p](int c) {
+            _cells[c].mass += 1.;
+            _cells[c].mx += p.x();
+            _cells[c].my += p.y();
+        };
+        int c = 0;
+        for (int depth = 0; ; depth++) {
+            if (_cells[c].child < 0) {
+                if (_cells[c].mass <= 0.) {     // Empty leaf
+                    _cells[c].body = b;
+                    addBody(c);
+                    return;
+                }
+                if (depth >= maxDepth) {
+                    _cells[c].body = aggregated;
+                    addBody(c);
+                    return;
+                }
+                // Split leaf and move its body to a child cell
+                const auto first = static_cast<int>(_cells.size());
+                const auto half = _cells[c].half / 2.;
+                for (int q = 0; q < 4; q++)
+                    _cells.push_back(Cell{_cells[c].cx + (q & 1 ? half : -half),
+                                          _cells[c].cy + (q & 2 ? half : -half), half});
+                auto& cell = _cells[c];     // Note: push_back() invalidate references
+                auto& moved = _cells[first + getQuadrant(cell, QPointF{cell.mx, cell.my})];
+                moved.body = cell.body;
+                moved.mass = cell.mass;
+                moved.mx = cell.mx;
+                moved.my = cell.my;
+                cell.child = first;
+                cell.body = -1;
+            }
+            addBody(c);
+            c = _cells[c].child + getQuadrant(_cells[c], p);
+        }
+    }
+};
+
+auto    MultilevelLayoutEngine::makeLevel(int nodeCount, std::vector<Arc>& arcs) noexcept -> Level
+{
+    // Algorithm:
+    // 1. Sort arcs by source and destination, merge duplicated arcs summing weights.
+    // 2. Generate CSR adjacency.
+    std::sort(arcs.begin(), arcs.end(), [](const Arc& a, const Arc& b) {
+        return a.src < b.src || (a.src == b.src && a.dst < b.dst);
+    });
+    Level level;
+    level.nodeCount = nodeCount;
+    level.offsets.assign(nodeCount + 1, 0);
+    for (std::size_t a = 0; a < arcs.size(); a++) {
+        if (a > 0 &&
+            arcs[a].src == arcs[a - 1].src &&
+            arcs[a].dst == arcs[a - 1].dst) {
+            level.weights.back() += arcs[a].weight;     // 1.
+            continue;
+        }
+        level.targets.push_back(arcs[a].dst);
+        level.weights.push_back(arcs[a].weight);
+        level.offsets[arcs[a].src + 1]++;
+    }
+    for (int n = 0; n < nodeCount; n++)     // 2.
+        level.offsets[n + 1] += level.offsets[n];
+    return level;
+}
+
+template <class Generator>
+auto    MultilevelLayoutEngine::coarsen(Level& level, Generator& generator) noexcept -> Level
+{
+    // Algorithm:
+    // 1. Heavy edge matching visiting nodes in random order.
+    // 2. Merge unmatched nodes with a matched neighbour cluster (moon merged in a solar system),
+    //    nodes without neighbours (coarsened small components) are merged by pairs.
+    // 3. Generate coarse level arcs from level arcs.
+    const auto n = level.nodeCount;
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), generator);
+    std::vector<int> clusters(n, -1);
+    int clusterCount = 0;
+    for (const auto v: order) {     // 1.
+        if (clusters[v] >= 0)
+            continue;
+        int match = -1;
+        qreal matchWeight = 0.;
+        for (auto a = level.offsets[v]; a < level.offsets[v + 1]; a++) {
+            const auto u = level.targets[a];
+            if (clusters[u] < 0 &&
+                level.weights[a] > matchWeight) {
+                match = u;
+                matchWeight = level.weights[a];
+            }
+        }
+        if (match >= 0)
+            clusters[v] = clusters[match] = clusterCount++;
+    }
+    int isolatedCluster = -1;       // Cluster of last unpaired isolated node
+    for (const auto v: order) {     // 2.
+        if (clusters[v] >= 0)
+            continue;
+        int cluster = -1;
+        qreal clusterWeight = 0.;
+        for (auto a = level.offsets[v]; a < level.offsets[v + 1]; a++) {
+            const auto u = level.targets[a];
+            if (clusters[u] >= 0 &&
+                level.weights[a] > clusterWeight) {
+                cluster = clusters[u];
+                clusterWeight = level.weights[a];
+            }
+        }
+        if (cluster < 0) {          // Note: unmatched node with a neighbour always has a matched neighbour
+            if (isolatedCluster < 0)
+                cluster = isolatedCluster = clusterCount++;
+            else {
+                cluster = isolatedCluster;
+                isolatedCluster = -1;
+            }
+        }
+        clusters[v] = cluster;
+    }
+
+    std::vector<Arc> arcs;      // 3.
+    arcs.reserve(level.targets.size());
+    for (int v = 0; v < n; v++)
+        for (auto a = level.offsets[v]; a < level.offsets[v + 1]; a++)
+            if (clusters[v] != clusters[level.targets[a]])
+                arcs.push_back(Arc{clusters[v], clusters[level.targets[a]], level.weights[a]});
+    level.parents = std::move(clusters);
+    return makeLevel(clusterCount, arcs);
+}
+
+void    MultilevelLayoutEngine::refine(const Level& level, std::vector<QPointF>& positions,
+                                       qreal k, qreal step, int iterations, int threads) const noexcept
+{
+    // Algorithm: For every iteration
+    // 1. Build a Barnes-Hut quadtree of current positions.
+    // 2. Compute nodes displacements in parallel: repulsion c.k^2/d with all nodes,
+    //    attraction d^2/k along edges, displacement being limited to current step.
+    // 3. Apply displacements and cool down step.
+    const auto n = level.nodeCount;
+    const auto k2 = 0.2 * k * k;     // Note: c=0.2 is sfdp default relative repulsive strength
+    BarnesHutTree tree;
+    std::vector<QPointF> displacements(n);
+    for (int iteration = 0; iteration < iterations; iteration++) {
+        tree.build(positions);  // 1.
+        parallelFor(n, threads, [&](int first, int last) {     // 2.
+            for (int v = first; v < last; v++) {
+                const auto& p = positions[v];
+                auto force = tree.repulsion(v, p, k2, theta);
+                for (auto a = level.offsets[v]; a < level.offsets[v + 1]; a++) {
+                    const auto delta = positions[level.targets[a]] - p;
+                    const auto d = std::sqrt(QPointF::dotProduct(delta, delta));
+                    force += delta * (d * level.weights[a] / k);
+                }
+                const auto length = std::sqrt(QPointF::dotProduct(force, force));
+                displacements[v] = length > step ? force * (step / length) :
+                                                   force;
+            }
+        });
+        for (int v = 0; v < n; v++)     // 3.
+            positions[v] += displacements[v];
+        step *= 0.92;
+    }
+}
+
+LayoutResult    MultilevelLayoutEngine::layout(const LayoutGraph& graph) const noexcept
+{
+    // Algorithm:
+    // 1. Generate finest level undirected adjacency of nodes with edges.
+    // 2. Coarsen graph.
+    // 3. Lay out coarsest level from random positions.
+    // 4. For every finer level, interpolate positions from coarser level and refine.
+    // 5. Generate top left positions from centers.
+    // 6. Lay out isolated nodes (without edges) in a grid below other nodes.
+    const auto n = graph.getNodeCount();
+    LayoutResult result;
+    result.positions.resize(n);
+    if (n == 0)
+        return result;
+    std::vector<int> nodes;             // Finest level nodes (graph nodes with edges)
+    std::vector<int> isolated;
+    std::vector<int> nodesIndex(n, -1); // Graph node index in finest level
+    {
+        std::vector<char> connected(n, 0);
+        for (const auto& edge: graph.edges)
+            if (edge.first >= 0 && edge.first < n &&
+                edge.second >= 0 && edge.second < n &&
+                edge.first != edge.second)
+                connected[edge.first] = connected[edge.second] = 1;
+        for (int v = 0; v < n; v++) {
+            if (connected[v]) {
+                nodesIndex[v] = static_cast<int>(nodes.size());
+                nodes.push_back(v);
+            } else
+                isolated.push_back(v);
+        }
+    }
+    const auto m = static_cast<int>(nodes.size());
+    if (m == 0) {
+        layoutGrid(isolated, graph.sizes, result.positions, 0., spacing);     // 6.
+        return result;
+    }
+    const auto threads = threadCount > 0 ? threadCount :
+                                           static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    std::mt19937 generator{seed};
+
+    // Ideal edge length k, for a level with l nodes, k is scaled to generate a layout covering
+    // roughly the same area than finest level: k * sqrt(m / l).
+    auto k = edgeLength;
+    if (k <= 0.) {
+        qreal sizeSum = 0.;
+        for (const auto& size: graph.sizes)
+            sizeSum += std::max(size.width(), size.height());
+        k = sizeSum / static_cast<qreal>(n) + 40.;
+    }
+    const auto getLevelK = [k, m](const Level& level) -> qreal {
+        return k * std::sqrt(static_cast<qreal>(m) / static_cast<qreal>(std::max(1, level.nodeCount)));
+    };
+
+    std::vector<Level> levels;      // 1.
+    {
+        std::vector<Arc> arcs;
+        arcs.reserve(graph.edges.size() * 2);
+        for (const auto& edge: graph.edges) {
+            if (edge.first < 0 || edge.first >= n ||
+                edge.second < 0 || edge.second >= n ||
+                edge.first == edge.second)
+                continue;
+            const auto src = nodesIndex[edge.first];
+            const auto dst = nodesIndex[edge.second];
+            arcs.push_back(Arc{src, dst, 1.});
+            arcs.push_back(Arc{dst, src, 1.});
+        }
+        levels.push_back(makeLevel(m, arcs));
+    }
+    while (levels.back().nodeCount > std::max(2, coarsestNodeCount) &&     // 2.
+           levels.size() < 64) {
+        auto coarse = coarsen(levels.back(), generator);
+        if (coarse.nodeCount > levels.back().nodeCount * 0.9) {    // Coarsening is no longer effective
+            levels.back().parents.clear();
+            break;
+        }
+        levels.push_back(std::move(coarse));
+    }
+
+    // 3.
+    std::vector<QPointF> positions(levels.back().nodeCount);
+    {
+        const auto& coarsest = levels.back();
+        const auto levelK = getLevelK(coarsest);
+        const auto side = levelK * std::sqrt(static_cast<qreal>(coarsest.nodeCount));
+        std::uniform_real_distribution<qreal> distribution{0., side};
+        for (auto& p: positions)
+            p = QPointF{distribution(generator), distribution(generator)};
+        refine(coarsest, positions, levelK, side / 4., coarsestIterations, threads);
+    }
+
+    // 4.
+    for (auto l = static_cast<int>(levels.size()) - 2; l >= 0; l--) {
+        const auto& level = levels[l];
+        const auto levelK = getLevelK(level);
+        std::uniform_real_distribution<qreal> jitter{-levelK / 10., levelK / 10.};
+        std::vector<QPointF> finePositions(level.nodeCount);
+        for (int v = 0; v < level.nodeCount; v++)
+            finePositions[v] = positions[level.parents[v]] + QPointF{jitter(generator), jitter(generator)};
+        positions = std::move(finePositions);
+        refine(level, positions, levelK, levelK, iterations, threads);
+    }
+
+    // 5.
+    qreal left = std::numeric_limits<qreal>::max();
+    qreal top = std::numeric_limits<qreal>::max();
+    qreal bottom = std::numeric_limits<qreal>::lowest();
+    for (int v = 0; v < m; v++) {
+        const auto& size = graph.sizes[nodes[v]];
+        auto& p = result.positions[nodes[v]];
+        p = positions[v] - QPointF{size.width() / 2., size.height() / 2.};
+        left = std::min(left, p.x());
+        top = std::min(top, p.y());
+        bottom = std::max(bottom, p.y() + size.height());
+    }
+    for (const auto v: nodes)
+        result.positions[v] -= QPointF{left, top};
+
+    layoutGrid(isolated, graph.sizes, result.positions, bottom - top + spacing, spacing);     // 6.
+    return result;
+}
+//-----------------------------------------------------------------------------
+
+
+/* CompoundLayoutEngine *///---------------------------------------------------
+LayoutResult    CompoundLayoutEngine::layout(const LayoutGraph& graph) const noexcept
+{
+    std::vector<QSizeF> sizes;
+    return layout(graph, std::vector<int>(graph.getNodeCount(), -1), {}, sizes);
+}
+
+//! Return node \c n group in \c parents, -1 for top level nodes and nodes with an invalid group.
+static int  getParent(const std::vector<int>& parents, int n) noexcept
+{
+    const auto count = static_cast<int>(parents.size());
+    const auto parent = n >= 0 && n < count ? parents[n] : -1;
+    return parent >= 0 && parent < count && parent != n ? parent : -1;
+}
+
+int     CompoundLayoutEngine::getEdgeLevel(const std::vector<int>& parents, int src, int dst) noexcept
+{
+    // Note: Ancestors walks are bounded by node count to protect against cyclic parents.
+    const auto count = static_cast<int>(parents.size());
+    std::vector<int> srcGroups;
+    for (int g = getParent(parents, src), d = 0; g >= 0 && d < count; g = getParent(parents, g), d++)
+        srcGroups.push_back(g);
+    for (int g = getParent(parents, dst), d = 0; g >= 0 && d < count; g = getParent(parents, g), d++)
+        if (std::find(srcGroups.cbegin(), srcGroups.cend(), g) != srcGroups.cend())
+            return g;
+    return -1;
+}
+
+LayoutResult    CompoundLayoutEngine::layout(const LayoutGraph& graph,
+                                             const std::vector<int>& parents,
+                                             const std::vector<QPointF>& containerOffsets,
+                                             std::vector<QSizeF>& sizes) const noexcept
+{
+    // Algorithm:
+    // 1. Generate hierarchy levels (nodes with cyclic parents are moved to top level), level -1 being top level.
+    // 2. Dispatch edges in their source and destination lowest common group, mapped to level members.
+    // 3. Sort groups with members by depth.
+    // 4. For every depth, deepest first: lay out groups content in parallel and resize groups.
+    // 5. Lay out top level nodes, keeping their bounding rect top left corner.
+    const auto nodeCount = graph.getNodeCount();
+    LayoutResult result;
+    result.positions.resize(nodeCount);
+    for (int n = 0; n < nodeCount; n++)
+        result.positions[n] = graph.getPosition(n);
+    sizes = graph.sizes;
+
+    std::vector<int> levelParents(nodeCount, -1);       // 1.
+    std::vector<int> depths(nodeCount, 0);
+    std::vector<std::vector<int>> members(nodeCount + 1);   // Note: Level l members are in members[l + 1]
+    std::vector<int> memberIndexes(nodeCount, 0);
+    for (int n = 0; n < nodeCount; n++) {
+        int depth = 0;
+        for (int g = getParent(parents, n); g >= 0 && depth <= nodeCount; g = getParent(parents, g))
+            depth++;
+        if (depth <= nodeCount) {
+            levelParents[n] = getParent(parents, n);
+            depths[n] = depth;
+        }
+        auto& levelMembers = members[levelParents[n] + 1];
+        memberIndexes[n] = static_cast<int>(levelMembers.size());
+        levelMembers.push_back(n);
+    }
+
+    std::vector<std::vector<std::pair<int, int>>> levelEdges(nodeCount + 1);    // 2.
+    const auto getLevelMember = [&levelParents](int n, int level) -> int {
+        while (n >= 0 && levelParents[n] != level)
+            n = levelParents[n];
+        return n;
+    };
+    for (const auto& edge: graph.edges) {
+        if (edge.first < 0 || edge.first >= nodeCount ||
+            edge.second < 0 || edge.second >= nodeCount)
+            continue;
+        const auto level = getEdgeLevel(levelParents, edge.first, edge.second);
+        const auto src = getLevelMember(edge.first, level);
+        const auto dst = getLevelMember(edge.second, level);
+        if (src >= 0 && dst >= 0 && src != dst)
+            levelEdges[level + 1].emplace_back(memberIndexes[src], memberIndexes[dst]);
+    }
+
+    qan::LayeredLayoutEngine engine;
+    engine.spacing = spacing;
+    const auto layoutLevel = [&](int level) -> std::vector<QPointF> {
+        LayoutGraph levelGraph;
+        levelGraph.sizes.reserve(members[level + 1].size());
+        for (const auto m: members[level + 1])
+            levelGraph.sizes.push_back(sizes[m]);
+        levelGraph.edges = levelEdges[level + 1];
+        return engine.layout(levelGraph).positions;     // Note: Engine layout() is const and thread safe
+    };
+
+    std::vector<int> groups;                            // 3.
+    for (int n = 0; n < nodeCount; n++)
+        if (!members[n + 1].empty())
+            groups.push_back(n);
+    std::stable_sort(groups.begin(), groups.end(),
+                     [&depths](int a, int b) { return depths[a] > depths[b]; });
+
+    const auto threads = parallel ? std::max(1, QThreadPool::globalInstance()->maxThreadCount()) : 1;
+    for (std::size_t first = 0; first < groups.size(); ) {  // 4.
+        auto last = first;
+        while (last < groups.size() && depths[groups[last]] == depths[groups[first]])
+            last++;
+        // Note: Groups with the same depth have distinct members, and their members sizes have
+        // already been generated: groups of a depth could be laid out concurrently.
+        parallelFor(static_cast<int>(last - first), threads, [&](int begin, int end) {
+            for (auto g = first + begin; g < first + end; g++) {
+                const auto group = groups[g];
+                const auto positions = layoutLevel(group);
+                const auto& groupMembers = members[group + 1];
+                qreal right = 0.;
+                qreal bottom = 0.;
+                for (std::size_t m = 0; m < groupMembers.size(); m++) {
+                    const auto position = positions[m] + QPointF{groupPadding, groupPadding};
+                    result.positions[groupMembers[m]] = position;
+                    right = std::max(right, position.x() + sizes[groupMembers[m]].width());
+                    bottom = std::max(bottom, position.y() + sizes[groupMembers[m]].height());
+                }
+                // Note: Container is usually below group header, take its offset into account.
+                const auto offset = group < static_cast<int>(containerOffsets.size()) ? containerOffsets[group] :
+                                                                                         QPointF{0., 0.};
+                sizes[group] = QSizeF{offset.x() + right + groupPadding,
+                                      offset.y() + bottom + groupPadding};
+            }
+        }, /*grainSize*/1);
+        first = last;
+    }
+
+    const auto& topMembers = members[0];                // 5.
+    if (topMembers.empty())
+        return result;
+    qreal left = std::numeric_limits<qreal>::max();
+    qreal top = std::numeric_limits<qreal>::max();
+    for (const auto m: topMembers) {
+        left = std::min(left, result.positions[m].x());
+        top = std::min(top, result.positions[m].y());
+    }
+    const auto positions = layoutLevel(-1);
+    for (std::size_t m = 0; m < topMembers.size(); m++)
+        result.positions[topMembers[m]] = QPointF{left, top} + positions[m];
+    return result;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
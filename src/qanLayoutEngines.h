@@ -0,0 +1,340 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanLayoutEngines.h
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <vector>
+#include <utility>
+
+// Qt headers
+#include <QSizeF>
+#include <QPointF>
+#include <QRectF>
+#include <QPolygonF>
+
+namespace qan { // ::qan
+
+/*! \brief Data-only graph topology snapshot used as input of headless layout engines.
+ *
+ * Nodes are identified by their index in \c sizes, \c edges are pairs of (source, destination)
+ * node indexes. Engines do not depend on QuickQanava graph or on a QML scene: layouts could
+ * be precomputed, tested or benchmarked without a QQuickWindow.
+ */
+struct LayoutGraph {
+    //! Nodes sizes.
+    std::vector<QSizeF>                 sizes;
+    //! Nodes current top left positions, optional (could be empty, nodes are then at (0, 0)).
+    std::vector<QPointF>                positions;
+    //! Directed edges, out edges order is preserved by engines that care about ordering.
+    std::vector<std::pair<int, int>>    edges;
+
+    inline int  getNodeCount() const noexcept { return static_cast<int>(sizes.size()); }
+    //! Return node \c n current position (or (0, 0) if no positions has been specified).
+    QPointF     getPosition(int n) const noexcept;
+    //! Return out adjacency lists, invalid edges (out of range indexes and self loops) are ignored.
+    auto        getOutNodes() const noexcept -> std::vector<std::vector<int>>;
+};
+
+//! Output of a headless layout engine.
+struct LayoutResult {
+    //! Nodes top left positions, indexed like LayoutGraph::sizes.
+    std::vector<QPointF>    positions;
+    //! Edges paths, indexed like LayoutGraph::edges, empty if the engine does not generate edge paths.
+    std::vector<QPolygonF>  edgePaths;
+};
+
+/*! \brief Interface for headless layout engines working on topology and sizes only.
+ *
+ * QML facing layouts (qan::OrgTreeLayout, qan::RandomLayout, qan::CompoundLayout) are adapters that
+ * snapshot nodes items geometry and topology in a qan::LayoutGraph, run an engine and apply the result
+ * to items.
+ *
+ * \note layout() is const and engines hold no state except their configuration: an engine
+ * could be used concurrently from multiple threads.
+ */
+class LayoutEngine
+{
+public:
+    LayoutEngine() = default;
+    virtual ~LayoutEngine() = default;
+    LayoutEngine(const LayoutEngine&) = default;
+    LayoutEngine& operator=(const LayoutEngine&) = default;
+
+public:
+    //! Return a layout of \c graph, result positions size is always graph node count.
+    virtual LayoutResult    layout(const LayoutGraph& graph) const noexcept = 0;
+};
+
+
+/*! \brief Layout nodes randomly inside a bounding rect.
+ *
+ * \nosubgrouping
+ */
+class RandomLayoutEngine : public LayoutEngine
+{
+public:
+    RandomLayoutEngine() = default;
+    virtual ~RandomLayoutEngine() override = default;
+
+public:
+    //! Rect where nodes are laid out, nodes are fully contained in layout rect when possible.
+    QRectF      layoutRect = QRectF{0., 0., 1000., 1000.};
+    //! Random generator seed, use Qt global generator when 0 (default).
+    quint32     seed = 0;
+
+    virtual LayoutResult    layout(const LayoutGraph& graph) const noexcept override;
+};
+
+
+/*! \brief Simple layered layout: longest path layering, barycenter ordering, isolated nodes in a grid.
+ *
+ * Cycles are broken by ignoring DFS back edges. Generated layout has (0, 0) as top left corner,
+ * layers are horizontally centered, nodes without edges are laid out in a grid below layers.
+ * Edge paths are straight lines from source bottom center to destination top center.
+ *
+ * \nosubgrouping
+ */
+class LayeredLayoutEngine : public LayoutEngine
+{
+public:
+    LayeredLayoutEngine() = default;
+    virtual ~LayeredLayoutEngine() override = default;
+
+public:
+    //! Horizontal and vertical spacing between nodes.
+    qreal       spacing = 40.;
+
+    virtual LayoutResult    layout(const LayoutGraph& graph) const noexcept override;
+};
+
+
+/*! \brief Org chart naive recursive variant of Reingold-Tilford algorithm with shifting.
+ *
+ * Tree is defined by \c root node and graph edges, out edges ordering is preserved. Root is not
+ * moved, nodes not reachable from root keep their current position.
+ *
+ * \note Cycles are ignored (a node already in the current recursion path is not laid out
+ * again), but laying out a non tree graph might lead to invalid layouts.
+ *
+ * \nosubgrouping
+ */
+class OrgTreeLayoutEngine : public LayoutEngine
+{
+public:
+    OrgTreeLayoutEngine() = default;
+    virtual ~OrgTreeLayoutEngine() override = default;
+
+public:
+    enum class Orientation : unsigned int {
+        //! Vertical tree layout.
+        Vertical = 2,
+        //! Horizontal tree layout.
+        Horizontal = 4,
+        //! Mixed tree layout (ie vertical, but horizontal for leaf nodes).
+        Mixed = 8
+    };
+
+    Orientation orientation = Orientation::Vertical;
+    //! Tree root node index.
+    int         root = 0;
+    qreal       xSpacing = 25.;
+    qreal       ySpacing = 25.;
+
+    virtual LayoutResult    layout(const LayoutGraph& graph) const noexcept override;
+
+public:
+    //! Layout state for a node subtree, could be kept between layouts for incremental updates.
+    struct SubTreeState {
+        //! True when the state has been generated by a previous layout.
+        bool    valid = false;
+        //! True if node has been laid out horizontally relatively to its siblings.
+        bool    horizontal = false;
+        //! Sibling fixed coordinate (x for vertical layout, y for horizontal layout).
+        qreal   anchor = 0.;
+        //! Parent accumulated BR right before node has been laid out.
+        qreal   right = 0.;
+        //! Parent accumulated BR bottom before node has been laid out.
+        qreal   bottom = 0.;
+        //! Node subtree bottom (vertical layout) or right (horizontal layout) extent.
+        qreal   extent = 0.;
+    };
+
+    /*! \brief Incremental layout of \c graph.
+     *
+     * \c states is indexed like \c graph nodes and updated with the generated layout state. When
+     * \c reusable is specified, a reusable node (node with unmodified size, childs and subtree) with a
+     * valid state is not laid out again: its subtree is translated as a whole when a modification
+     * before it in the tree shifted its position (subtree nodes current positions are then used).
+     */
+    LayoutResult    layout(const LayoutGraph& graph,
+                           std::vector<SubTreeState>& states,
+                           const std::vector<bool>* reusable = nullptr) const noexcept;
+
+private:
+    struct Context {
+        const LayoutGraph&                      graph;
+        const std::vector<std::vector<int>>&    outNodes;
+        std::vector<SubTreeState>&              states;
+        const std::vector<bool>*                reusable;
+        std::vector<QPointF>&                   positions;
+        std::vector<bool>                       onPath;
+    };
+    QRectF  layoutChilds_rec(Context& ctx, int node, QRectF br) const noexcept;
+    QRectF  layoutChild_rec(Context& ctx, int child, qreal anchor, bool horizontal, QRectF br) const noexcept;
+    void    translateSubTree_rec(Context& ctx, int node, QPointF delta) const noexcept;
+};
+
+
+/*! \brief Multilevel force directed layout for large graphs (sfdp/FM³ style).
+ *
+ * Algorithm:
+ * 1. Coarsening: graph is recursively coarsened using heavy edge matching, unmatched nodes being
+ *    merged with a matched neighbour (solar system like merging of star topologies), until
+ *    \c coarsestNodeCount is reached or coarsening is no longer effective.
+ * 2. Coarsest level is laid out from a random start.
+ * 3. Every finer level positions are interpolated from their coarse node position, then refined
+ *    with a Fruchterman-Reingold force directed pass, repulsive forces being approximated with a
+ *    Barnes-Hut quadtree.
+ *
+ * Isolated nodes (without edges) are not coarsened, they are laid out in a grid below other nodes.
+ * Nodes of small components that end up without neighbours in a coarse level are merged by pairs,
+ * so that graphs with many small components are still effectively coarsened.
+ *
+ * Forces and displacements are computed in parallel at every level, the graph is considered
+ * undirected, nodes are laid out as points (average node size is taken into account in ideal edge
+ * length). Generated layout has (0, 0) as top left corner. Layout is deterministic for a given \c seed
+ * and \c threadCount.
+ *
+ * \nosubgrouping
+ */
+class MultilevelLayoutEngine : public LayoutEngine
+{
+public:
+    MultilevelLayoutEngine() = default;
+    virtual ~MultilevelLayoutEngine() override = default;
+
+public:
+    //! Ideal edge length, when <= 0. (default), use average node size plus 40.
+    qreal       edgeLength = 0.;
+    //! Stop coarsening below this node count.
+    int         coarsestNodeCount = 50;
+    //! Force directed iterations for coarsest level.
+    int         coarsestIterations = 300;
+    //! Force directed iterations for every refinement level.
+    int         iterations = 40;
+    //! Barnes-Hut approximation criterion (cell size / distance), higher is faster but less accurate.
+    qreal       theta = 1.2;
+    //! Maximum worker thread count, use hardware concurrency when <= 0.
+    int         threadCount = 0;
+    //! Seed for initial layout and interpolation jitter.
+    quint32     seed = 1;
+    //! Horizontal and vertical spacing between isolated nodes.
+    qreal       spacing = 40.;
+
+    virtual LayoutResult    layout(const LayoutGraph& graph) const noexcept override;
+
+private:
+    //! Coarsening level, with undirected weighted adjacency in CSR format.
+    struct Level {
+        int                 nodeCount = 0;
+        //! Node n arcs are [offsets[n], offsets[n + 1]) in targets and weights.
+        std::vector<int>    offsets;
+        std::vector<int>    targets;
+        std::vector<qreal>  weights;
+        //! Node index in next coarser level, empty for coarsest level.
+        std::vector<int>    parents;
+    };
+    struct Arc {
+        int     src = 0;
+        int     dst = 0;
+        qreal   weight = 1.;
+    };
+    static Level    makeLevel(int nodeCount, std::vector<Arc>& arcs) noexcept;
+    template <class Generator>
+    static Level    coarsen(Level& level, Generator& generator) noexcept;
+    void            refine(const Level& level, std::vector<QPointF>& positions,
+                           qreal k, qreal step, int iterations, int threads) const noexcept;
+};
+
+
+/*! \brief Compound layout of a nested groups hierarchy, every level is laid out with qan::LayeredLayoutEngine.
+ *
+ * Hierarchy is defined by \c parents: \c parents[n] is the index of node \c n group, -1 for top level nodes
+ * (invalid and cyclic parents are ignored). Graph \c sizes contains nodes and groups sizes, \c edges could
+ * connect any nodes of the hierarchy.
+ *
+ * Groups content is laid out bottom-up: deepest groups content is laid out first, groups are then resized
+ * to fit their content and laid out as super-nodes in their parent group, up to top level nodes. An edge is
+ * laid out in its source and destination lowest common group, where it is mapped to the group members
+ * containing its source and destination. Groups with the same depth are independent, their layout is
+ * computed in parallel.
+ *
+ * Group members positions are relative to their group container, top level nodes keep their bounding rect
+ * top left corner. Groups without members are not resized.
+ *
+ * \nosubgrouping
+ */
+class CompoundLayoutEngine : public LayoutEngine
+{
+public:
+    CompoundLayoutEngine() = default;
+    virtual ~CompoundLayoutEngine() override = default;
+
+public:
+    //! Horizontal and vertical spacing between level members.
+    qreal       spacing = 40.;
+    //! Padding between a group container border and its content.
+    qreal       groupPadding = 20.;
+    //! Compute independent groups (groups with the same depth) layouts in parallel.
+    bool        parallel = true;
+
+    //! Lay out \c graph without hierarchy (all nodes are top level nodes).
+    virtual LayoutResult    layout(const LayoutGraph& graph) const noexcept override;
+
+    /*! \brief Lay out \c graph nodes hierarchy defined by \c parents.
+     *
+     * \c containerOffsets (optional, could be empty) is indexed like graph nodes and contains groups container
+     * offset in group (ie group header size). Nodes sizes, with generated groups sizes, are returned in \c sizes.
+     */
+    LayoutResult    layout(const LayoutGraph& graph,
+                           const std::vector<int>& parents,
+                           const std::vector<QPointF>& containerOffsets,
+                           std::vector<QSizeF>& sizes) const noexcept;
+
+    //! Return the group where edge \c src \c dst is laid out (ie \c src and \c dst lowest common group), -1 for top level.
+    static int  getEdgeLevel(const std::vector<int>& parents, int src, int dst) noexcept;
+};
+
+} // ::qan
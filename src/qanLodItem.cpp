@@ -0,0 +1,227 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanLodItem.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+
+// Qt headers
+#include <QSGNode>
+#include <QSGGeometryNode>
+#include <QSGFlatColorMaterial>
+
+// QuickQanava headers
+#include "./qanLodItem.h"
+
+namespace qan { // ::qan
+
+/* LodItem Object Management *///----------------------------------------------
+LodItem::LodItem(QQuickItem* parent) :
+    QQuickItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+}
+
+void    LodItem::setGraph(qan::Graph* graph) noexcept
+{
+    if (graph == _graph)
+        return;
+    if (_graph)
+        disconnect(_graph.data(), nullptr, this, nullptr);
+    _graph = graph;
+    if (_graph) {
+        connect(_graph.data(),  &qan::Graph::lodLevelChanged,
+                this,           &QQuickItem::update);
+        connect(_graph.data(),  &qan::Graph::lodGeometryChanged,
+                this,           &QQuickItem::update);
+    }
+    update();
+    emit graphChanged();
+}
+//-----------------------------------------------------------------------------
+
+/* Rendering Management *///---------------------------------------------------
+void    LodItem::setZoom(qreal zoom) noexcept
+{
+    if (!qFuzzyCompare(1. + zoom, 1. + _zoom)) {
+        _zoom = zoom;
+        if (_graph &&
+            _graph->getLodLevel() == qan::Graph::LodLevel::Dots)    // Dots size is zoom dependent
+            update();
+        emit zoomChanged();
+    }
+}
+
+void    LodItem::setDotSize(qreal dotSize) noexcept
+{
+    dotSize = std::max(0., dotSize);
+    if (!qFuzzyCompare(1. + dotSize, 1. + _dotSize)) {
+        _dotSize = dotSize;
+        update();
+        emit dotSizeChanged();
+    }
+}
+
+void    LodItem::setNodeColor(QColor nodeColor) noexcept
+{
+    if (nodeColor != _nodeColor) {
+        _nodeColor = nodeColor;
+        update();
+        emit nodeColorChanged();
+    }
+}
+
+void    LodItem::setGroupColor(QColor groupColor) noexcept
+{
+    if (groupColor != _groupColor) {
+        _groupColor = groupColor;
+        update();
+        emit groupColorChanged();
+    }
+}
+
+void    LodItem::setEdgeColor(QColor edgeColor) noexcept
+{
+    if (edgeColor != _edgeColor) {
+        _edgeColor = edgeColor;
+        update();
+        emit edgeColorChanged();
+    }
+}
+
+//! Create a flat color geometry node using \c drawingMode (either triangles or lines).
+static QSGGeometryNode* createGeometryNode(unsigned int drawingMode)
+{
+    auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_Point2D(), 0};
+    geometry->setDrawingMode(drawingMode);
+    if (drawingMode == QSGGeometry::DrawLines)
+        geometry->setLineWidth(1.f);
+    auto node = new QSGGeometryNode{};
+    node->setGeometry(geometry);
+    node->setFlag(QSGNode::OwnsGeometry);
+    node->setMaterial(new QSGFlatColorMaterial{});
+    node->setFlag(QSGNode::OwnsMaterial);
+    return node;
+}
+
+static void setGeometryNodeColor(QSGGeometryNode& node, const QColor& color)
+{
+    const auto material = static_cast<QSGFlatColorMaterial*>(node.material());
+    if (material->color() != color) {
+        material->setColor(color);
+        node.markDirty(QSGNode::DirtyMaterial);
+    }
+}
+
+//! Fill \c node geometry with two triangles per rect in \c rects.
+static void setGeometryNodeRects(QSGGeometryNode& node, const std::vector<QRectF>& rects)
+{
+    const auto geometry = node.geometry();
+    geometry->allocate(static_cast<int>(rects.size() * 6));
+    auto v = geometry->vertexDataAsPoint2D();
+    for (const auto& r : rects) {
+        const auto left = static_cast<float>(r.left());
+        const auto top = static_cast<float>(r.top());
+        const auto right = static_cast<float>(r.right());
+        const auto bottom = static_cast<float>(r.bottom());
+        v[0].set(left, top);
+        v[1].set(right, top);
+        v[2].set(left, bottom);
+        v[3].set(right, top);
+        v[4].set(right, bottom);
+        v[5].set(left, bottom);
+        v += 6;
+    }
+    node.markDirty(QSGNode::DirtyGeometry);
+}
+
+//! Fill \c node geometry with \c lines.
+static void setGeometryNodeLines(QSGGeometryNode& node, const std::vector<QLineF>& lines)
+{
+    const auto geometry = node.geometry();
+    geometry->allocate(static_cast<int>(lines.size() * 2));
+    auto v = geometry->vertexDataAsPoint2D();
+    for (const auto& line : lines) {
+        v[0].set(static_cast<float>(line.x1()), static_cast<float>(line.y1()));
+        v[1].set(static_cast<float>(line.x2()), static_cast<float>(line.y2()));
+        v += 2;
+    }
+    node.markDirty(QSGNode::DirtyGeometry);
+}
+
+QSGNode*    LodItem::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data)
+    if (!_graph ||
+        _graph->getLodLevel() == qan::Graph::LodLevel::Full) {
+        delete oldNode;
+        return nullptr;
+    }
+    // Algorithm:
+    // 1. Create root node with groups, edges and nodes geometry nodes (in drawing order).
+    // 2. Collect graph geometry intersecting cull rect.
+    // 3. Generate geometry, at Dots level of detail, nodes are squares of constant on screen size.
+    auto root = oldNode;
+    // 1.
+    if (root == nullptr) {
+        root = new QSGNode{};
+        root->appendChildNode(createGeometryNode(QSGGeometry::DrawTriangles));
+        root->appendChildNode(createGeometryNode(QSGGeometry::DrawLines));
+        root->appendChildNode(createGeometryNode(QSGGeometry::DrawTriangles));
+    }
+    auto groupsNode = static_cast<QSGGeometryNode*>(root->childAtIndex(0));
+    auto edgesNode = static_cast<QSGGeometryNode*>(root->childAtIndex(1));
+    auto nodesNode = static_cast<QSGGeometryNode*>(root->childAtIndex(2));
+
+    // 2.
+    _graph->collectLodGeometry(_graph->getCullRect(), _groups, _nodes, _edges);
+
+    // 3.
+    if (_graph->getLodLevel() == qan::Graph::LodLevel::Dots) {
+        const auto d = _dotSize / std::max(_zoom, 0.0001);
+        for (auto& node : _nodes) {
+            const auto c = node.center();
+            node = QRectF{c.x() - d / 2., c.y() - d / 2., d, d};
+        }
+    }
+    setGeometryNodeRects(*groupsNode, _groups);
+    setGeometryNodeColor(*groupsNode, _groupColor);
+    setGeometryNodeLines(*edgesNode, _edges);
+    setGeometryNodeColor(*edgesNode, _edgeColor);
+    setGeometryNodeRects(*nodesNode, _nodes);
+    setGeometryNodeColor(*nodesNode, _nodeColor);
+    return root;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
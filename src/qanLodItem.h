@@ -0,0 +1,176 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanLodItem.h
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <vector>
+
+// Qt headers
+#include <QQuickItem>
+#include <QPointer>
+#include <QColor>
+#include <QRectF>
+#include <QLineF>
+
+// QuickQanava headers
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+/*! \brief Lightweight proxy rendering a graph at low level of detail.
+ *
+ * Graph nodes and groups are drawn as flat rectangles (or dots for nodes at qan::Graph::LodLevel::Dots), edges
+ * as 1 pixel lines. All primitives are batched in three scene graph geometry nodes, whatever the
+ * graph size. Only primitives intersecting graph cull rect are drawn (see qan::Graph::setCullRect()).
+ *
+ * Proxy is expected to be a child of graph container item, it is usually created and configured
+ * by qan::GraphView (see qan::GraphView::lod), and render nothing when graph level of detail is Full.
+ *
+ * \nosubgrouping
+ */
+class LodItem : public QQuickItem
+{
+    /*! \name LodItem Object Management *///-----------------------------------
+    //@{
+    Q_OBJECT
+    QML_NAMED_ELEMENT(LodItem)
+public:
+    explicit LodItem(QQuickItem* parent = nullptr);
+    virtual ~LodItem() override = default;
+    LodItem(const LodItem&) = delete;
+
+public:
+    //! Graph rendered by this proxy.
+    Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged FINAL)
+    //! \copydoc graph
+    inline qan::Graph*  getGraph() const noexcept { return _graph.data(); }
+    //! \copydoc graph
+    void                setGraph(qan::Graph* graph) noexcept;
+private:
+    //! \copydoc graph
+    QPointer<qan::Graph> _graph;
+signals:
+    //! \copydoc graph
+    void                graphChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Rendering Management *///----------------------------------------
+    //@{
+public:
+    //! Current view zoom, used to keep dots size constant on screen (default to 1.0).
+    Q_PROPERTY(qreal zoom READ getZoom WRITE setZoom NOTIFY zoomChanged FINAL)
+    //! \copydoc zoom
+    inline qreal    getZoom() const noexcept { return _zoom; }
+    //! \copydoc zoom
+    void            setZoom(qreal zoom) noexcept;
+private:
+    //! \copydoc zoom
+    qreal           _zoom = 1.0;
+signals:
+    //! \copydoc zoom
+    void            zoomChanged();
+
+public:
+    //! Nodes dots size in pixels at qan::Graph::LodLevel::Dots level of detail (default to 3.0).
+    Q_PROPERTY(qreal dotSize READ getDotSize WRITE setDotSize NOTIFY dotSizeChanged FINAL)
+    //! \copydoc dotSize
+    inline qreal    getDotSize() const noexcept { return _dotSize; }
+    //! \copydoc dotSize
+    void            setDotSize(qreal dotSize) noexcept;
+private:
+    //! \copydoc dotSize
+    qreal           _dotSize = 3.0;
+signals:
+    //! \copydoc dotSize
+    void            dotSizeChanged();
+
+public:
+    //! Nodes rectangles and dots color.
+    Q_PROPERTY(QColor nodeColor READ getNodeColor WRITE setNodeColor NOTIFY nodeColorChanged FINAL)
+    //! \copydoc nodeColor
+    inline QColor   getNodeColor() const noexcept { return _nodeColor; }
+    //! \copydoc nodeColor
+    void            setNodeColor(QColor nodeColor) noexcept;
+private:
+    //! \copydoc nodeColor
+    QColor          _nodeColor{0x90, 0x90, 0x90};
+signals:
+    //! \copydoc nodeColor
+    void            nodeColorChanged();
+
+public:
+    //! Groups rectangles color.
+    Q_PROPERTY(QColor groupColor READ getGroupColor WRITE setGroupColor NOTIFY groupColorChanged FINAL)
+    //! \copydoc groupColor
+    inline QColor   getGroupColor() const noexcept { return _groupColor; }
+    //! \copydoc groupColor
+    void            setGroupColor(QColor groupColor) noexcept;
+private:
+    //! \copydoc groupColor
+    QColor          _groupColor{0xd0, 0xd0, 0xd0, 0x80};
+signals:
+    //! \copydoc groupColor
+    void            groupColorChanged();
+
+public:
+    //! Edges lines color.
+    Q_PROPERTY(QColor edgeColor READ getEdgeColor WRITE setEdgeColor NOTIFY edgeColorChanged FINAL)
+    //! \copydoc edgeColor
+    inline QColor   getEdgeColor() const noexcept { return _edgeColor; }
+    //! \copydoc edgeColor
+    void            setEdgeColor(QColor edgeColor) noexcept;
+private:
+    //! \copydoc edgeColor
+    QColor          _edgeColor{0x70, 0x70, 0x70};
+signals:
+    //! \copydoc edgeColor
+    void            edgeColorChanged();
+
+protected:
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+
+private:
+    //! Geometry collected from graph, kept between updates to avoid reallocations.
+    std::vector<QRectF> _groups;
+    std::vector<QRectF> _nodes;
+    std::vector<QLineF> _edges;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::LodItem)
@@ -0,0 +1,129 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanMultilevelLayout.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <unordered_map>
+
+// QuickQanava headers
+#include "./qanMultilevelLayout.h"
+
+namespace qan { // ::qan
+
+/* MultilevelLayout Object Management *///-------------------------------------
+MultilevelLayout::MultilevelLayout(QObject* parent) noexcept :
+    QObject{parent}
+{
+}
+MultilevelLayout::~MultilevelLayout() { }
+
+bool    MultilevelLayout::setEdgeLength(qreal edgeLength) noexcept
+{
+    if (!qFuzzyCompare(1. + edgeLength, 1. + _edgeLength)) {
+        _edgeLength = edgeLength;
+        emit edgeLengthChanged();
+        return true;
+    }
+    return false;
+}
+
+bool    MultilevelLayout::setIterations(int iterations) noexcept
+{
+    if (iterations != _iterations) {
+        _iterations = iterations;
+        emit iterationsChanged();
+        return true;
+    }
+    return false;
+}
+
+void    MultilevelLayout::layout(qan::Graph& graph) noexcept
+{
+    // Algorithm:
+    // 1. Generate a topology snapshot of top level nodes, mapping edges to top level ancestors.
+    // 2. Run layout engine.
+    // 3. Apply positions, keeping nodes original top left corner.
+    std::vector<qan::Node*> nodes;      // 1.
+    qan::LayoutGraph layoutGraph;
+    std::unordered_map<const qan::Node*, int> indexes;
+    QRectF nodesBr;
+    for (const auto node: graph.get_nodes()) {
+        if (node == nullptr ||
+            node->get_group() != nullptr ||
+            node->getItem() == nullptr)
+            continue;
+        const auto item = node->getItem();
+        indexes.emplace(node, static_cast<int>(nodes.size()));
+        nodes.push_back(node);
+        layoutGraph.sizes.push_back(item->size());
+        nodesBr = nodesBr.united(QRectF{item->position(), item->size()});
+    }
+    if (nodes.empty())
+        return;
+    const auto getTopLevelIndex = [&indexes](const qan::Node* node) -> int {
+        while (node != nullptr &&
+               node->get_group() != nullptr)
+            node = node->get_group();
+        const auto index = indexes.find(node);
+        return index != indexes.end() ? index->second : -1;
+    };
+    layoutGraph.edges.reserve(graph.get_edges().size());
+    for (const auto edge: graph.get_edges()) {
+        if (edge == nullptr)
+            continue;
+        const auto src = getTopLevelIndex(edge->get_src());
+        const auto dst = getTopLevelIndex(edge->get_dst());
+        if (src >= 0 &&
+            dst >= 0 &&
+            src != dst)
+            layoutGraph.edges.emplace_back(src, dst);
+    }
+
+    qan::MultilevelLayoutEngine engine;     // 2.
+    engine.edgeLength = getEdgeLength();
+    engine.iterations = getIterations();
+    const auto result = engine.layout(layoutGraph);
+
+    const auto origin = nodesBr.topLeft();  // 3.
+    for (std::size_t n = 0; n < nodes.size(); n++)
+        nodes[n]->getItem()->setPosition(origin + result.positions[n]);
+}
+
+void    MultilevelLayout::layout(qan::Graph* graph) noexcept
+{
+    if (graph != nullptr)
+        layout(*graph);
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
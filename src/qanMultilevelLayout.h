@@ -0,0 +1,107 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanMultilevelLayout.h
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Qt headers
+#include <QObject>
+
+// QuickQanava headers
+#include "./qanGraph.h"
+#include "./qanLayoutEngines.h"
+
+namespace qan { // ::qan
+
+/*! \brief Multilevel force directed layout for very large graphs.
+ *
+ * QML adapter for qan::MultilevelLayoutEngine: graph top level nodes and groups are laid out,
+ * edges to grouped nodes are mapped to their top level group, grouped nodes are left untouched.
+ *
+ * \nosubgrouping
+ */
+class MultilevelLayout : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    /*! \name MultilevelLayout Object Management *///--------------------------
+    //@{
+public:
+    explicit MultilevelLayout(QObject* parent = nullptr) noexcept;
+    virtual ~MultilevelLayout() override;
+    MultilevelLayout(const MultilevelLayout&) = delete;
+    MultilevelLayout& operator=(const MultilevelLayout&) = delete;
+    MultilevelLayout(MultilevelLayout&&) = delete;
+    MultilevelLayout& operator=(MultilevelLayout&&) = delete;
+
+public:
+    //! \copydoc getEdgeLength()
+    Q_PROPERTY(qreal edgeLength READ getEdgeLength WRITE setEdgeLength NOTIFY edgeLengthChanged FINAL)
+    //! \copydoc getEdgeLength()
+    bool            setEdgeLength(qreal edgeLength) noexcept;
+    //! \brief Ideal edge length, use average node size plus 40 when <= 0. (default).
+    qreal           getEdgeLength() const noexcept { return _edgeLength; }
+protected:
+    //! \copydoc getEdgeLength()
+    qreal           _edgeLength = 0.;
+signals:
+    //! \copydoc getEdgeLength()
+    void            edgeLengthChanged();
+
+public:
+    //! \copydoc getIterations()
+    Q_PROPERTY(int iterations READ getIterations WRITE setIterations NOTIFY iterationsChanged FINAL)
+    //! \copydoc getIterations()
+    bool            setIterations(int iterations) noexcept;
+    //! \brief Force directed iterations for every refinement level (default to 40).
+    int             getIterations() const noexcept { return _iterations; }
+protected:
+    //! \copydoc getIterations()
+    int             _iterations = 40;
+signals:
+    //! \copydoc getIterations()
+    void            iterationsChanged();
+
+public:
+    //! Apply multilevel layout to \c graph top level nodes, layout top left corner is current nodes top left corner.
+    void                layout(qan::Graph& graph) noexcept;
+
+    //! QML invokable version of layout().
+    Q_INVOKABLE void    layout(qan::Graph* graph) noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::MultilevelLayout)
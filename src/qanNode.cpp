@@ -81,11 +81,13 @@ const qan::NodeItem*    Node::getItem() const noexcept { return _item.data(); }
 
 void    Node::setItem(qan::NodeItem* nodeItem) noexcept
 {
-    if (nodeItem != nullptr) {
+    if (nodeItem != _item) {
         _item = nodeItem;
-        if (nodeItem->getNode() != this)
-            nodeItem->setNode(this);
+        emit itemChanged();
     }
+    if (nodeItem != nullptr &&
+        nodeItem->getNode() != this)
+        nodeItem->setNode(this);
 }
 //-----------------------------------------------------------------------------
 
@@ -93,12 +93,16 @@ public:
     bool    operator==(const qan::Node& right) const;
 
 public:
-    Q_PROPERTY(qan::NodeItem* item READ getItem CONSTANT)
+    //! Node visual item, might be nullptr for non visual nodes or virtual nodes (see qan::Graph::virtualized).
+    Q_PROPERTY(qan::NodeItem* item READ getItem NOTIFY itemChanged)
     qan::NodeItem*          getItem() noexcept;
     const qan::NodeItem*    getItem() const noexcept;
+    //! Set node visual item, a nullptr \c nodeItem detach node from its current item.
     virtual void            setItem(qan::NodeItem* nodeItem) noexcept;
 protected:
     QPointer<qan::NodeItem> _item;
+signals:
+    void                    itemChanged();
     //@}
     //-------------------------------------------------------------------------
 
@@ -68,6 +68,14 @@ NodeItem::NodeItem(QQuickItem* parent) :
             this,   &qan::NodeItem::onWidthChanged);
     connect(this,   &qan::NodeItem::heightChanged,
             this,   &qan::NodeItem::onHeightChanged);
+
+    for (const auto geometrySignal : {&QQuickItem::xChanged, &QQuickItem::yChanged, &QQuickItem::zChanged,
+                                      &QQuickItem::widthChanged, &QQuickItem::heightChanged,
+                                      &QQuickItem::rotationChanged, &QQuickItem::scaleChanged})
+        connect(this,   geometrySignal,
+                this,   &qan::NodeItem::invalidateGlobalTransform);
+    connect(this,   &QQuickItem::parentChanged,
+            this,   &qan::NodeItem::invalidateGlobalTransformParents);
 }
 
 NodeItem::~NodeItem()
@@ -96,6 +104,7 @@ auto    NodeItem::setNode(qan::Node* node) noexcept -> void {
         _node = node;
         const auto nodeDraggableCtrl = static_cast<DraggableCtrl*>(_draggableCtrl.get());
         nodeDraggableCtrl->setTarget(node);
+        emit nodeChanged();
     }
 }
 
@@ -170,9 +179,9 @@ void    NodeItem::collapseAncestors(bool collapsed)
 
     // 3.
     for (const auto ancestorEdge: ancestorsEdges)
-        ancestorEdge->getItem()->setVisible(collapsed);
+        ancestorEdge->getItem()->setItemVisible(collapsed);
     for (const auto ancestor: ancestors)
-        const_cast<qan::Node*>(ancestor)->getItem()->setVisible(collapsed);
+        const_cast<qan::Node*>(ancestor)->getItem()->setItemVisible(collapsed);
 }
 
 void    NodeItem::collapseChilds(bool collapsed)
@@ -205,9 +214,112 @@ void    NodeItem::collapseChilds(bool collapsed)
 
     // 3.
     for (const auto childEdge: childsEdges)
-        childEdge->getItem()->setVisible(collapsed);
+        childEdge->getItem()->setItemVisible(collapsed);
     for (const auto child: childs)
-        const_cast<qan::Node*>(child)->getItem()->setVisible(collapsed);
+        const_cast<qan::Node*>(child)->getItem()->setItemVisible(collapsed);
+}
+//-----------------------------------------------------------------------------
+
+/* Culling Management *///-----------------------------------------------------
+void    NodeItem::setCulled(bool culled) noexcept
+{
+    if (culled == _culled)
+        return;
+    _culled = culled;
+    if (_culled) {
+        _culledVisible = isVisible();   // Note: Do not restore items hidden by user or collapsing
+        if (_culledVisible)
+            setVisible(false);
+    } else if (_culledVisible)
+        setVisible(true);
+    emit culledChanged();
+}
+
+void    NodeItem::setItemVisible(bool visible) noexcept
+{
+    if (_culled)
+        _culledVisible = visible;
+    else
+        setVisible(visible);
+}
+//-----------------------------------------------------------------------------
+
+/* Global Transform Management *///--------------------------------------------
+const QTransform&   NodeItem::getGlobalTransform(const QQuickItem* containerItem) noexcept
+{
+    if (!_globalTransformValid ||
+        containerItem != _globalTransformContainer)
+        updateGlobalTransform(containerItem);
+    return _globalTransform;
+}
+
+qreal   NodeItem::getGlobalZ(const QQuickItem* containerItem) noexcept
+{
+    if (!_globalTransformValid ||
+        containerItem != _globalTransformContainer)
+        updateGlobalTransform(containerItem);
+    return _globalZ;
+}
+
+void    NodeItem::invalidateGlobalTransform() noexcept
+{
+    _globalTransformValid = false;
+    invalidateChildrenGlobalTransform(*this);
+}
+
+void    NodeItem::invalidateGlobalTransformParents() noexcept
+{
+    _globalTransformParentsValid = false;
+    invalidateGlobalTransform();
+}
+
+void    NodeItem::invalidateChildrenGlobalTransform(const QQuickItem& item) noexcept
+{
+    for (const auto child : item.childItems()) {
+        if (child == nullptr)
+            continue;
+        const auto childNodeItem = qobject_cast<qan::NodeItem*>(child);
+        if (childNodeItem != nullptr)
+            childNodeItem->_globalTransformValid = false;
+        invalidateChildrenGlobalTransform(*child);
+    }
+}
+
+void    NodeItem::updateGlobalTransform(const QQuickItem* containerItem) noexcept
+{
+    // Algorithm:
+    // 1. If parent chain has changed, connect parent items geometry signals up to (excluding)
+    //    containerItem or the first parent node item (parent node items directly invalidate their
+    //    children cache, see invalidateChildrenGlobalTransform()).
+    // 2. Update transform and global z.
+    if (!_globalTransformParentsValid ||
+        containerItem != _globalTransformContainer) {       // 1.
+        for (const auto& connection : _globalTransformConnections)
+            disconnect(connection);
+        _globalTransformConnections.clear();
+        for (auto parent = parentItem();
+             parent != nullptr && parent != containerItem &&
+             qobject_cast<qan::NodeItem*>(parent) == nullptr;
+             parent = parent->parentItem()) {
+            for (const auto geometrySignal : {&QQuickItem::xChanged, &QQuickItem::yChanged, &QQuickItem::zChanged,
+                                              &QQuickItem::widthChanged, &QQuickItem::heightChanged,
+                                              &QQuickItem::rotationChanged, &QQuickItem::scaleChanged})
+                _globalTransformConnections.push_back(connect(parent,   geometrySignal,
+                                                              this,     &qan::NodeItem::invalidateGlobalTransform));
+            _globalTransformConnections.push_back(connect(parent,   &QQuickItem::parentChanged,
+                                                          this,     &qan::NodeItem::invalidateGlobalTransformParents));
+        }
+        _globalTransformContainer = containerItem;
+        _globalTransformParentsValid = true;
+    }
+
+    bool ok = false;                                        // 2.
+    _globalTransform = containerItem != nullptr ? itemTransform(const_cast<QQuickItem*>(containerItem), &ok) :
+                                                  QTransform{};
+    if (!ok)
+        _globalTransform = QTransform{};
+    _globalZ = qan::getItemGlobalZ_rec(this);
+    _globalTransformValid = true;
 }
 //-----------------------------------------------------------------------------
 
@@ -534,4 +646,37 @@ void    NodeItem::configureDock(QQuickItem& dockItem, const Dock dock) noexcept
 }
 //-----------------------------------------------------------------------------
 
+
+/* Delegates Pool Management *///----------------------------------------------
+void    NodeItem::componentComplete()
+{
+    QQuickItem::componentComplete();
+    _poolState = PoolState{QSizeF{width(), height()}, z(), opacity(), scale(), rotation(), isEnabled(),
+                           getMinimumSize(), getRatio(), getResizable(), getSelectable(), getDraggable(),
+                           getDroppable(), getAcceptDrops(), getConnectable(), getDragOrientation()};
+}
+
+void    NodeItem::resetForPool() noexcept
+{
+    setPosition(QPointF{0., 0.});
+    setMinimumSize(_poolState.minimumSize);
+    if (_poolState.size.isValid())
+        setSize(_poolState.size);
+    setZ(_poolState.z);
+    setOpacity(_poolState.opacity);
+    setScale(_poolState.scale);
+    setRotation(_poolState.rotation);
+    setEnabled(_poolState.enabled);
+    setRatio(_poolState.ratio);
+    setResizable(_poolState.resizable);
+    setSelectable(_poolState.selectable);
+    setDraggable(_poolState.draggable);
+    setDroppable(_poolState.droppable);
+    setAcceptDrops(_poolState.acceptDrops);
+    setConnectable(_poolState.connectable);
+    setDragOrientation(_poolState.dragOrientation);
+    setDragged(false);
+}
+//-----------------------------------------------------------------------------
+
 } // ::qan
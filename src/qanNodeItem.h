@@ -37,11 +37,13 @@
 // Std headers
 #include <cstddef>  // std::size_t
 #include <array>
+#include <vector>
 
 // Qt headers
 #include <QQuickItem>
 #include <QPointF>
 #include <QPolygonF>
+#include <QTransform>
 #include <QDrag>
 #include <QPointer>
 
@@ -101,12 +103,15 @@ public:
     /*! \name Topology Management *///-----------------------------------------
     //@{
 public:
-    Q_PROPERTY(qan::Node* node READ getNode CONSTANT FINAL)
+    //! Item node, modified only when a pooled item is reused for another node (see qan::Graph::virtualized).
+    Q_PROPERTY(qan::Node* node READ getNode NOTIFY nodeChanged FINAL)
     auto        getNode() noexcept -> qan::Node*;
     auto        getNode() const noexcept -> const qan::Node*;
     auto        setNode(qan::Node* node) noexcept -> void;
 private:
     QPointer<qan::Node> _node{nullptr};
+signals:
+    void        nodeChanged();
 
 public:
     //! Secure shortcut to getNode().getGraph().
@@ -157,6 +162,77 @@ public:
     //-------------------------------------------------------------------------
 
 
+    /*! \name Culling Management *///------------------------------------------
+    //@{
+public:
+    /*! \brief True when the item is culled: it is outside graph cull rect and hidden (see qan::Graph::setCullRect()).
+     *
+     * Culled items are invisible, so they have no scene graph node, but are still referenced in graph
+     * spatial index. Culling only restore visibility of items that were visible when they were culled,
+     * use setItemVisible() to modify a potentially culled item visibility.
+     */
+    Q_PROPERTY(bool culled READ getCulled NOTIFY culledChanged FINAL)
+    inline bool     getCulled() const noexcept { return _culled; }
+    virtual void    setCulled(bool culled) noexcept;
+    //! Visibility restored when item is no longer culled (meaningless when item is not culled).
+    inline bool     getCulledVisible() const noexcept { return _culledVisible; }
+
+    /*! \brief Set item visibility, taking culling into account.
+     *
+     * When item is culled, \c visible is applied when the item is restored.
+     */
+    void            setItemVisible(bool visible) noexcept;
+private:
+    bool        _culled = false;
+    bool        _culledVisible = true;
+signals:
+    void        culledChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+
+    /*! \name Global Transform Management *///-------------------------------
+    //@{
+public:
+    /*! \brief Return transform from this item CS to \c containerItem CS (usually graph container item).
+     *
+     * Transform is cached until this item, or one of its parent items up to \c containerItem, is moved,
+     * resized, rotated, scaled or reparented. Equivalent to mapToItem(containerItem, ...) without
+     * walking the parent chain for every mapped point.
+     *
+     * \note Parent node items (groups, or nodes for ports) invalidate their children node items cache
+     * synchronously, before any other handler connected to their geometry signals is called.
+     */
+    const QTransform&   getGlobalTransform(const QQuickItem* containerItem) noexcept;
+
+    /*! \brief Return cached item global z, sum of this item and its parent items z (see qan::getItemGlobalZ_rec()).
+     *
+     * \note Cache is invalidated with global transform, \c containerItem and its parents z are expected to be static.
+     */
+    qreal               getGlobalZ(const QQuickItem* containerItem) noexcept;
+
+protected slots:
+    //! Invalidate cached global transform and z, called on this item or parent items geometry change.
+    void                invalidateGlobalTransform() noexcept;
+    //! Invalidate cached global transform and parent items connections, called when this item or a parent item is reparented.
+    void                invalidateGlobalTransformParents() noexcept;
+
+private:
+    //! Update parent items connections if necessary, then update cached global transform and z.
+    void                updateGlobalTransform(const QQuickItem* containerItem) noexcept;
+    //! Invalidate cached global transform of all node items (nodes, groups, ports) inside \c item.
+    static void         invalidateChildrenGlobalTransform(const QQuickItem& item) noexcept;
+
+    QTransform                              _globalTransform;
+    qreal                                   _globalZ = 0.;
+    bool                                    _globalTransformValid = false;
+    bool                                    _globalTransformParentsValid = false;
+    QPointer<const QQuickItem>              _globalTransformContainer;
+    std::vector<QMetaObject::Connection>    _globalTransformConnections;
+    //@}
+    //-------------------------------------------------------------------------
+
+
     /*! \name Selection Management *///----------------------------------------
     //@{
 public:
@@ -499,6 +575,43 @@ private:
     std::array<QPointer<QQuickItem>, dockCount> _dockItems;
     //@}
     //-------------------------------------------------------------------------
+
+    /*! \name Delegates Pool Management *///-----------------------------------
+    //@{
+protected:
+    //! Save item delegate default geometry and flags, restored by resetForPool().
+    virtual void    componentComplete() override;
+
+public:
+    /*! \brief Restore item delegate default geometry and flags, called when item is parked in graph delegates pool.
+     *
+     * Item is moved to origin, its size, z and interaction flags are restored to their value at delegate
+     * creation, so that a recycled item does not inherit previous node user state.
+     * \sa qan::Graph::delegatesPoolCapacity
+     */
+    virtual void    resetForPool() noexcept;
+private:
+    struct PoolState {
+        QSizeF          size;   // Invalid until component completion
+        qreal           z = 0.;
+        qreal           opacity = 1.;
+        qreal           scale = 1.;
+        qreal           rotation = 0.;
+        bool            enabled = true;
+        QSizeF          minimumSize{100., 45.};
+        qreal           ratio = -1.;
+        bool            resizable = true;
+        bool            selectable = true;
+        bool            draggable = true;
+        bool            droppable = true;
+        bool            acceptDrops = true;
+        Connectable     connectable = Connectable::Connectable;
+        DragOrientation dragOrientation = DragOrientation::DragAll;
+    };
+    //! Delegate default state, saved on component completion.
+    PoolState       _poolState;
+    //@}
+    //-------------------------------------------------------------------------
 };
 
 } // ::qan
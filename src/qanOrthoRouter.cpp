@@ -0,0 +1,579 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanOrthoRouter.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <queue>
+
+// QuickQanava headers
+#include "./qanOrthoRouter.h"
+
+namespace qan { // ::qan
+
+/* OrthoRouter Object Management *///------------------------------------------
+void    OrthoRouter::clear() noexcept
+{
+    _obstacles.clear();
+    _routes.clear();
+    _corridors.clear();
+}
+
+void    OrthoRouter::setMargin(qreal margin) noexcept
+{
+    if (margin >= 0. &&
+        !qFuzzyCompare(1. + margin, 1. + _margin)) {
+        _margin = margin;
+        for (auto& route: _routes)
+            route.second.dirty = true;
+    }
+}
+
+void    OrthoRouter::setBendPenalty(qreal bendPenalty) noexcept
+{
+    if (bendPenalty >= 0. &&
+        !qFuzzyCompare(1. + bendPenalty, 1. + _bendPenalty)) {
+        _bendPenalty = bendPenalty;
+        for (auto& route: _routes)
+            route.second.dirty = true;
+    }
+}
+
+void    OrthoRouter::setNudgeSpacing(qreal nudgeSpacing) noexcept
+{
+    if (nudgeSpacing >= 0. &&
+        !qFuzzyCompare(1. + nudgeSpacing, 1. + _nudgeSpacing)) {
+        _nudgeSpacing = nudgeSpacing;
+        for (auto& route: _routes)
+            route.second.dirty = true;
+    }
+}
+//-----------------------------------------------------------------------------
+
+
+/* Obstacles Management *///---------------------------------------------------
+std::vector<OrthoRouter::Key>   OrthoRouter::updateObstacle(Key key, const QRectF& rect) noexcept
+{
+    std::vector<Key> routes;
+    if (key == nullptr)
+        return routes;
+    const auto previous = _obstacles.getRect(key);
+    if (previous != nullptr) {
+        if (*previous == rect)
+            return routes;
+        collectCrossingRoutes(key, *previous, routes);
+    }
+    _obstacles.insert(key, rect);
+    collectCrossingRoutes(key, rect, routes);
+    std::sort(routes.begin(), routes.end());
+    routes.erase(std::unique(routes.begin(), routes.end()), routes.end());
+    for (const auto route: routes)
+        invalidateRoute(route);
+    return routes;
+}
+
+std::vector<OrthoRouter::Key>   OrthoRouter::removeObstacle(Key key) noexcept
+{
+    std::vector<Key> routes;
+    const auto previous = _obstacles.getRect(key);
+    if (previous == nullptr)
+        return routes;
+    collectCrossingRoutes(key, *previous, routes);
+    _obstacles.remove(key);
+    for (const auto route: routes)
+        invalidateRoute(route);
+    return routes;
+}
+
+std::vector<OrthoRouter::Key>   OrthoRouter::queryObstacles(const QRectF& rect) const noexcept
+{
+    std::vector<Key> obstacles;
+    _obstacles.query(rect, obstacles);
+    return obstacles;
+}
+
+void    OrthoRouter::collectCrossingRoutes(Key key, const QRectF& rect, std::vector<Key>& routes) const noexcept
+{
+    const auto obstacle = rect.adjusted(-_margin, -_margin, _margin, _margin);
+    std::vector<Key> candidates;
+    _corridors.query(obstacle, candidates);
+    for (const auto candidate: candidates) {
+        const auto routeIt = _routes.find(candidate);
+        if (routeIt == _routes.end())
+            continue;
+        const auto& route = routeIt->second;
+        if (route.src == key ||     // Routes connected to key are invalidated by their src/dst geometry change
+            route.dst == key)
+            continue;
+        const auto& path = route.path;
+        for (int s = 0; s < path.size() - 1; s++) {  // Refine corridor BR test with actual segments
+            const auto segmentBr = QRectF{path[s], path[s + 1]}.normalized().adjusted(-0.5, -0.5, 0.5, 0.5);
+            if (segmentBr.intersects(obstacle)) {
+                routes.push_back(candidate);
+                break;
+            }
+        }
+    }
+}
+//-----------------------------------------------------------------------------
+
+
+/* Routing Management *///-----------------------------------------------------
+QPolygonF   OrthoRouter::route(Key route, Key src, Key dst, const QRectF& srcRect, const QRectF& dstRect) noexcept
+{
+    const auto routeIt = _routes.find(route);
+    if (routeIt != _routes.end()) {
+        const auto& cached = routeIt->second;
+        if (!cached.dirty &&
+            cached.src == src && cached.dst == dst &&
+            cached.srcRect == srcRect && cached.dstRect == dstRect)
+            return cached.path;
+    }
+
+    _corridors.remove(route);   // Do not nudge route against its previous geometry
+    auto path = searchPath(src, dst, srcRect, dstRect);
+    nudgePath(route, path);
+
+    auto& r = _routes[route];
+    r.src = src;
+    r.dst = dst;
+    r.srcRect = srcRect;
+    r.dstRect = dstRect;
+    r.path = path;
+    r.dirty = false;
+    if (!path.isEmpty())
+        _corridors.insert(route, path.boundingRect().adjusted(-_margin, -_margin, _margin, _margin));
+    return path;
+}
+
+std::vector<QPolygonF>  OrthoRouter::routeAll(const std::vector<Request>& requests) noexcept
+{
+    std::vector<QPolygonF> paths;
+    paths.reserve(requests.size());
+    for (const auto& request: requests)
+        paths.push_back(route(request.route, request.src, request.dst,
+                              request.srcRect, request.dstRect));
+    return paths;
+}
+
+void    OrthoRouter::invalidateRoute(Key route) noexcept
+{
+    const auto routeIt = _routes.find(route);
+    if (routeIt != _routes.end())
+        routeIt->second.dirty = true;
+}
+
+void    OrthoRouter::removeRoute(Key route) noexcept
+{
+    _corridors.remove(route);
+    _routes.erase(route);
+}
+
+QPolygonF   OrthoRouter::getRoute(Key route) const noexcept
+{
+    const auto routeIt = _routes.find(route);
+    return routeIt != _routes.end() ? routeIt->second.path : QPolygonF{};
+}
+
+QPolygonF   OrthoRouter::simplePath(const QRectF& srcRect, const QRectF& dstRect) noexcept
+{
+    // Connect src and dst facing sides with a single Z shaped path, along the axis
+    // with the largest gap between src and dst.
+    const auto hGap = std::max(dstRect.left() - srcRect.right(), srcRect.left() - dstRect.right());
+    const auto vGap = std::max(dstRect.top() - srcRect.bottom(), srcRect.top() - dstRect.bottom());
+    if (hGap <= 0. && vGap <= 0.)
+        return QPolygonF{};
+    if (hGap >= vGap) {
+        const auto right = dstRect.left() > srcRect.right();
+        const QPointF p1{right ? srcRect.right() : srcRect.left(), srcRect.center().y()};
+        const QPointF p2{right ? dstRect.left() : dstRect.right(), dstRect.center().y()};
+        const auto mx = (p1.x() + p2.x()) / 2.;
+        return QPolygonF{{p1, QPointF{mx, p1.y()}, QPointF{mx, p2.y()}, p2}};
+    }
+    const auto down = dstRect.top() > srcRect.bottom();
+    const QPointF p1{srcRect.center().x(), down ? srcRect.bottom() : srcRect.top()};
+    const QPointF p2{dstRect.center().x(), down ? dstRect.top() : dstRect.bottom()};
+    const auto my = (p1.y() + p2.y()) / 2.;
+    return QPolygonF{{p1, QPointF{p1.x(), my}, QPointF{p2.x(), my}, p2}};
+}
+
+QPolygonF   OrthoRouter::searchPath(Key src, Key dst, const QRectF& srcRect, const QRectF& dstRect) const noexcept
+{
+    // PRECONDITIONS:
+        // srcRect and dstRect must be valid and must not intersect
+    if (srcRect.isEmpty() ||
+        dstRect.isEmpty())
+        return QPolygonF{};
+    if (srcRect.intersects(dstRect))
+        return QPolygonF{};
+
+    // Algorithm:
+    // 1. Generate a search window around src and dst, extend it to obstacles crossing it, collect obstacles.
+    //    Fall back to a simple route when there is too much obstacles.
+    // 2. Collect interesting points: obstacles corners, src/dst inflated corners and ports stubs
+    //    (ports projected at margin distance).
+    // 3. Generate maximal horizontal and vertical visibility segments from interesting points.
+    // 4. Generate sparse orthogonal visibility graph: vertices are segments intersections, arcs
+    //    link successive vertices on a segment. Src ports are linked to their stubs.
+    // 5. A* from src ports to dst ports with bend penalty, state is (vertex, direction).
+    // 6. Generate path and remove collinear points.
+    const auto m = _margin;
+    static constexpr qreal eps = 0.001;
+    static constexpr std::size_t maxObstacles = 1024;
+    static constexpr std::size_t maxVertices = 1 << 16;
+
+    // 1.
+    QRectF window = srcRect.united(dstRect).adjusted(-4. * m, -4. * m, 4. * m, 4. * m);
+    std::vector<Key> keys;
+    _obstacles.query(window, keys);
+    if (keys.size() > maxObstacles)
+        return simplePath(srcRect, dstRect);
+    for (const auto key: keys) {
+        if (key == src || key == dst)
+            continue;
+        window = window.united(_obstacles.getRect(key)->adjusted(-2. * m, -2. * m, 2. * m, 2. * m));
+    }
+    keys.clear();
+    _obstacles.query(window, keys);
+    if (keys.size() > maxObstacles)
+        return simplePath(srcRect, dstRect);
+    std::vector<QRectF> obstacles;
+    obstacles.reserve(keys.size());
+    for (const auto key: keys) {
+        if (key == src || key == dst)
+            continue;
+        const auto obstacle = _obstacles.getRect(key)->adjusted(-m, -m, m, m);
+        // Note: Obstacles overlapping src or dst (usually src or dst parent groups) can't be avoided.
+        if (obstacle.intersects(srcRect) ||
+            obstacle.intersects(dstRect))
+            continue;
+        obstacles.push_back(obstacle);
+    }
+    // Note: Obstacles interior is blocked (routes might follow obstacles border), src and dst
+    // border is also blocked.
+    const auto isBlocked = [&](const QPointF& p) -> bool {
+        for (const auto& obstacle: obstacles)
+            if (p.x() > obstacle.left() + eps && p.x() < obstacle.right() - eps &&
+                p.y() > obstacle.top() + eps  && p.y() < obstacle.bottom() - eps)
+                return true;
+        for (const auto& r: {srcRect, dstRect})
+            if (p.x() > r.left() - eps && p.x() < r.right() + eps &&
+                p.y() > r.top() - eps  && p.y() < r.bottom() + eps)
+                return true;
+        return !window.adjusted(-eps, -eps, eps, eps).contains(p);
+    };
+
+    // 2.
+    enum Direction : int { Right = 0, Down = 1, Left = 2, Up = 3 };
+    struct Port { QPointF point; QPointF stub; int direction; };
+    const auto generatePorts = [m](const QRectF& r) -> std::array<Port, 4> {
+        const auto c = r.center();
+        return {{ {QPointF{r.right(), c.y()},  QPointF{r.right() + m, c.y()},  Right},
+                  {QPointF{c.x(), r.bottom()}, QPointF{c.x(), r.bottom() + m}, Down},
+                  {QPointF{r.left(), c.y()},   QPointF{r.left() - m, c.y()},   Left},
+                  {QPointF{c.x(), r.top()},    QPointF{c.x(), r.top() - m},    Up} }};
+    };
+    const auto srcPorts = generatePorts(srcRect);
+    const auto dstPorts = generatePorts(dstRect);
+    std::vector<QPointF> points;
+    points.reserve(obstacles.size() * 4 + 16);
+    const auto addCorners = [&points](const QRectF& r) {
+        points.push_back(r.topLeft());      points.push_back(r.topRight());
+        points.push_back(r.bottomLeft());   points.push_back(r.bottomRight());
+    };
+    for (const auto& obstacle: obstacles)
+        addCorners(obstacle);
+    addCorners(srcRect.adjusted(-m, -m, m, m));
+    addCorners(dstRect.adjusted(-m, -m, m, m));
+    for (const auto& port: srcPorts)
+        points.push_back(port.stub);
+    for (const auto& port: dstPorts)
+        points.push_back(port.stub);
+    points.erase(std::remove_if(points.begin(), points.end(), isBlocked), points.end());
+
+    // 3.
+    struct Segment {
+        qreal   c;      // Segment y for horizontal segments, x for vertical segments
+        qreal   min;
+        qreal   max;
+        std::vector<int> vertices;
+    };
+    // Note: Visibility segments at the same coordinate are either equal or disjoint.
+    const auto generateSegment = [&](const QPointF& p, bool horizontal) -> Segment {
+        const auto c = horizontal ? p.y() : p.x();
+        const auto pc = horizontal ? p.x() : p.y();
+        auto min = horizontal ? window.left() : window.top();
+        auto max = horizontal ? window.right() : window.bottom();
+        const auto clip = [&](const QRectF& r, qreal inset) {
+            const auto rMin = horizontal ? r.top() : r.left();
+            const auto rMax = horizontal ? r.bottom() : r.right();
+            if (c <= rMin + inset || c >= rMax - inset)
+                return;
+            const auto rLow = horizontal ? r.left() : r.top();
+            const auto rHigh = horizontal ? r.right() : r.bottom();
+            if (rHigh <= pc + eps)
+                min = std::max(min, rHigh);
+            else if (rLow >= pc - eps)
+                max = std::min(max, rLow);
+        };
+        for (const auto& obstacle: obstacles)
+            clip(obstacle, eps);
+        clip(srcRect, -eps);
+        clip(dstRect, -eps);
+        return Segment{c, min, max, {}};
+    };
+    const auto generateSegments = [&](bool horizontal) -> std::vector<Segment> {
+        std::vector<Segment> segments;
+        segments.reserve(points.size());
+        for (const auto& point: points)
+            segments.push_back(generateSegment(point, horizontal));
+        std::sort(segments.begin(), segments.end(), [](const Segment& a, const Segment& b) {
+            return a.c < b.c || (a.c == b.c && a.min < b.min);
+        });
+        segments.erase(std::unique(segments.begin(), segments.end(), [](const Segment& a, const Segment& b) {
+            return std::fabs(a.c - b.c) < eps && std::fabs(a.min - b.min) < eps;
+        }), segments.end());
+        return segments;
+    };
+    auto hSegments = generateSegments(true);
+    auto vSegments = generateSegments(false);
+
+    // 4.
+    std::vector<QPointF>            vertices;
+    std::vector<std::array<int, 4>> arcs;   // Neighbour vertex by direction, -1 if none
+    for (auto& hSegment: hSegments) {       // Note: hSegments and vSegments are sorted by coordinate
+        auto vIt = std::lower_bound(vSegments.begin(), vSegments.end(), hSegment.min - eps,
+                                    [](const Segment& s, qreal x) { return s.c < x; });
+        for (; vIt != vSegments.end() && vIt->c <= hSegment.max + eps; ++vIt) {
+            if (hSegment.c < vIt->min - eps ||
+                hSegment.c > vIt->max + eps)
+                continue;
+            const auto vertex = static_cast<int>(vertices.size());
+            vertices.emplace_back(vIt->c, hSegment.c);
+            arcs.push_back({-1, -1, -1, -1});
+            if (!hSegment.vertices.empty()) {
+                arcs[hSegment.vertices.back()][Right] = vertex;
+                arcs[vertex][Left] = hSegment.vertices.back();
+            }
+            if (!vIt->vertices.empty()) {
+                arcs[vIt->vertices.back()][Down] = vertex;
+                arcs[vertex][Up] = vIt->vertices.back();
+            }
+            hSegment.vertices.push_back(vertex);
+            vIt->vertices.push_back(vertex);
+        }
+        if (vertices.size() > maxVertices)
+            return simplePath(srcRect, dstRect);
+    }
+    const auto findVertex = [&](const QPointF& p) -> int {
+        const auto hIt = std::lower_bound(hSegments.cbegin(), hSegments.cend(), p.y() - eps,
+                                          [](const Segment& s, qreal y) { return s.c < y; });
+        for (auto it = hIt; it != hSegments.cend() && it->c <= p.y() + eps; ++it)
+            for (const auto vertex: it->vertices)
+                if (std::fabs(vertices[vertex].x() - p.x()) < eps)
+                    return vertex;
+        return -1;
+    };
+    // Src ports are sources only, dst ports are goals only: they are not linked into the graph.
+    struct Stub { int stub; int port; int direction; };
+    std::vector<Stub> srcStubs, dstStubs;
+    for (const auto& [ports, stubs]: {std::make_pair(&srcPorts, &srcStubs),
+                                      std::make_pair(&dstPorts, &dstStubs)}) {
+        for (const auto& port: *ports) {
+            const auto stub = findVertex(port.stub);
+            if (stub < 0)
+                continue;
+            stubs->push_back(Stub{stub, static_cast<int>(vertices.size()), port.direction});
+            vertices.push_back(port.point);
+            arcs.push_back({-1, -1, -1, -1});
+        }
+    }
+
+    // 5.
+    const auto heuristic = [&](const QPointF& p) -> qreal {
+        auto h = std::numeric_limits<qreal>::max();
+        for (const auto& port: dstPorts)
+            h = std::min(h, std::fabs(port.point.x() - p.x()) + std::fabs(port.point.y() - p.y()));
+        return h;
+    };
+    const auto stateCount = vertices.size() * 4;
+    std::vector<qreal>  g(stateCount, std::numeric_limits<qreal>::max());
+    std::vector<int>    parents(stateCount, -1);
+    using Candidate = std::pair<qreal, int>;    // f, state
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> open;
+    const auto relax = [&](int state, int vertex, int neighbour, int direction, int d) {
+        const auto cost = g[state] + std::fabs(vertices[neighbour].x() - vertices[vertex].x()) +
+                                     std::fabs(vertices[neighbour].y() - vertices[vertex].y()) +
+                          (d != direction ? _bendPenalty : 0.);
+        const auto neighbourState = neighbour * 4 + d;
+        if (cost + eps < g[neighbourState]) {
+            g[neighbourState] = cost;
+            parents[neighbourState] = state;
+            open.emplace(cost + heuristic(vertices[neighbour]), neighbourState);
+        }
+    };
+    for (const auto& srcStub: srcStubs) {
+        const auto state = srcStub.port * 4 + srcStub.direction;
+        g[state] = 0.;
+        relax(state, srcStub.port, srcStub.stub, srcStub.direction, srcStub.direction);
+    }
+    int goal = -1;
+    while (!open.empty()) {
+        const auto [f, state] = open.top();
+        open.pop();
+        const auto vertex = state / 4;
+        const auto direction = state % 4;
+        if (f - heuristic(vertices[vertex]) > g[state] + eps)
+            continue;   // Outdated candidate
+        if (std::any_of(dstStubs.cbegin(), dstStubs.cend(),
+                        [vertex](const Stub& s) { return s.port == vertex; })) {
+            goal = state;
+            break;
+        }
+        for (int d = 0; d < 4; d++) {
+            if (d == (direction + 2) % 4)       // No U turn
+                continue;
+            const auto neighbour = arcs[vertex][d];
+            if (neighbour >= 0)
+                relax(state, vertex, neighbour, direction, d);
+        }
+        for (const auto& dstStub: dstStubs) {   // Enter dst from its stubs, toward dst
+            const auto inward = (dstStub.direction + 2) % 4;
+            if (dstStub.stub == vertex &&
+                inward != (direction + 2) % 4)
+                relax(state, vertex, dstStub.port, direction, inward);
+        }
+    }
+    if (goal < 0)
+        return QPolygonF{};
+
+    // 6.
+    QPolygonF path;
+    for (auto state = goal; state >= 0; state = parents[state]) {
+        const auto& p = vertices[state / 4];
+        if (path.size() >= 2) {     // Remove collinear points
+            const auto& a = path[path.size() - 2];
+            const auto& b = path[path.size() - 1];
+            if ((std::fabs(a.x() - b.x()) < eps && std::fabs(b.x() - p.x()) < eps) ||
+                (std::fabs(a.y() - b.y()) < eps && std::fabs(b.y() - p.y()) < eps)) {
+                path.last() = p;
+                continue;
+            }
+        }
+        path.append(p);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+void    OrthoRouter::nudgePath(Key route, QPolygonF& path) const noexcept
+{
+    // Algorithm:
+    // For every inner segment (first and last segment are connected to src and dst ports):
+    // 1. Collect other routes segments with the same orientation, at less than nudgeSpacing and
+    //    overlapping this segment.
+    // 2. Shift segment by +/- k * nudgeSpacing up to 0.8 * margin until there is no overlap.
+    //    Adjacent segments are orthogonal, shifting a segment only modify their length.
+    const auto n = path.size();
+    if (n < 4 ||
+        _nudgeSpacing <= 0.)
+        return;
+    static constexpr qreal eps = 0.001;
+    const auto spacing = _nudgeSpacing;
+    std::vector<Key> routes;
+    const auto overlaps = [&](QPointF a, QPointF b) -> bool {
+        const auto horizontal = std::fabs(a.y() - b.y()) < eps;
+        const auto segmentBr = QRectF{a, b}.normalized().adjusted(-spacing, -spacing, spacing, spacing);
+        routes.clear();
+        _corridors.query(segmentBr, routes);
+        for (const auto other: routes) {
+            if (other == route)
+                continue;
+            const auto routeIt = _routes.find(other);
+            if (routeIt == _routes.end())
+                continue;
+            const auto& otherPath = routeIt->second.path;
+            for (int s = 0; s < otherPath.size() - 1; s++) {
+                const auto& c = otherPath[s];
+                const auto& d = otherPath[s + 1];
+                if (horizontal) {
+                    if (std::fabs(c.y() - d.y()) > eps ||
+                        std::fabs(c.y() - a.y()) > spacing * 0.5)
+                        continue;
+                    if (std::min(std::max(a.x(), b.x()), std::max(c.x(), d.x())) -
+                        std::max(std::min(a.x(), b.x()), std::min(c.x(), d.x())) > eps)
+                        return true;
+                } else {
+                    if (std::fabs(c.x() - d.x()) > eps ||
+                        std::fabs(c.x() - a.x()) > spacing * 0.5)
+                        continue;
+                    if (std::min(std::max(a.y(), b.y()), std::max(c.y(), d.y())) -
+                        std::max(std::min(a.y(), b.y()), std::min(c.y(), d.y())) > eps)
+                        return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    const auto maxShift = 0.8 * _margin;
+    for (int s = 1; s < n - 2; s++) {
+        // 1.
+        const auto a = path[s];
+        const auto b = path[s + 1];
+        if (!overlaps(a, b))
+            continue;
+        // 2.
+        const auto horizontal = std::fabs(a.y() - b.y()) < eps;
+        const QPointF axis = horizontal ? QPointF{0., 1.} : QPointF{1., 0.};
+        for (int k = 1; k * spacing <= maxShift + eps; k++) {
+            const auto shift = axis * (k * spacing);
+            if (!overlaps(a + shift, b + shift)) {
+                path[s] = a + shift;
+                path[s + 1] = b + shift;
+                break;
+            }
+            if (!overlaps(a - shift, b - shift)) {
+                path[s] = a - shift;
+                path[s + 1] = b - shift;
+                break;
+            }
+        }
+    }
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
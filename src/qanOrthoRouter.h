@@ -0,0 +1,198 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanOrthoRouter.h
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <unordered_map>
+#include <vector>
+
+// Qt headers
+#include <QRectF>
+#include <QPointF>
+#include <QPolygonF>
+
+// QuickQanava headers
+#include "./qanSpatialIndex.h"
+
+namespace qan { // ::qan
+
+/*! \brief Orthogonal edge router with obstacle avoidance.
+ *
+ * Router is independent of QML and QuickQanava topology: obstacles and routes are identified
+ * with opaque keys (usually qan::Node and qan::Edge pointers), all geometry is expressed in a
+ * common coordinate system (usually graph container item CS).
+ *
+ * Algorithm:
+ *   \li Obstacles (node bounding rects inflated by \c margin) are stored in a spatial index (see qan::SpatialIndex).
+ *   \li For every route, a sparse orthogonal visibility graph is generated from obstacles
+ *       intersecting the route search window: horizontal and vertical visibility segments are
+ *       generated from obstacles corners and ports, graph vertices are segments intersections.
+ *       When the search window contains too many obstacles, a simple Z shaped route is used.
+ *   \li Path is searched using A* with a bend penalty, starting from source sides mid points and ending
+ *       on destination sides mid points.
+ *   \li Inner path segments are then nudged apart from already routed parallel overlapping segments.
+ *
+ * Routes are cached, updateObstacle() return the routes whose corridor intersect the modified
+ * obstacle, theses routes are invalidated and will be routed again on next route() call.
+ *
+ * \nosubgrouping
+ */
+class OrthoRouter
+{
+    /*! \name OrthoRouter Object Management *///-------------------------------
+    //@{
+public:
+    OrthoRouter() = default;
+    ~OrthoRouter() = default;
+    OrthoRouter(const OrthoRouter&) = delete;
+    OrthoRouter& operator=(const OrthoRouter&) = delete;
+    OrthoRouter(OrthoRouter&&) = default;
+    OrthoRouter& operator=(OrthoRouter&&) = default;
+
+    //! Opaque obstacle or route identifier.
+    using Key = const void*;
+
+    //! Clear all obstacles and routes.
+    void        clear() noexcept;
+
+public:
+    //! Minimum distance between a route and an obstacle (default to 10.).
+    void        setMargin(qreal margin) noexcept;
+    //! \copydoc setMargin()
+    qreal       getMargin() const noexcept { return _margin; }
+
+    //! Cost of a bend expressed in path length unit (default to 40.).
+    void        setBendPenalty(qreal bendPenalty) noexcept;
+    //! \copydoc setBendPenalty()
+    qreal       getBendPenalty() const noexcept { return _bendPenalty; }
+
+    //! Spacing between nudged parallel segments (default to 5.).
+    void        setNudgeSpacing(qreal nudgeSpacing) noexcept;
+    //! \copydoc setNudgeSpacing()
+    qreal       getNudgeSpacing() const noexcept { return _nudgeSpacing; }
+private:
+    qreal       _margin = 10.;
+    qreal       _bendPenalty = 40.;
+    qreal       _nudgeSpacing = 5.;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Obstacles Management *///----------------------------------------
+    //@{
+public:
+    /*! \brief Insert or update obstacle \c key with bounding rect \c rect.
+     *
+     * \return routes whose corridor intersect the obstacle previous or new geometry, routes using
+     * \c key as source or destination are not returned (they are invalidated anyway).
+     */
+    std::vector<Key>    updateObstacle(Key key, const QRectF& rect) noexcept;
+
+    //! Remove obstacle \c key, return routes whose corridor intersected the obstacle.
+    std::vector<Key>    removeObstacle(Key key) noexcept;
+
+    //! Return obstacles intersecting \c rect.
+    std::vector<Key>    queryObstacles(const QRectF& rect) const noexcept;
+
+    //! Return registered obstacle count.
+    int                 getObstacleCount() const noexcept { return static_cast<int>(_obstacles.getSize()); }
+
+private:
+    //! Obstacles bounding rects (not inflated).
+    qan::SpatialIndex   _obstacles;
+
+    //! Return routes (not using \c key as source or destination) whose corridor intersect \c rect.
+    void                collectCrossingRoutes(Key key, const QRectF& rect, std::vector<Key>& routes) const noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Routing Management *///------------------------------------------
+    //@{
+public:
+    struct Request {
+        Key     route = nullptr;
+        Key     src = nullptr;
+        Key     dst = nullptr;
+        QRectF  srcRect;
+        QRectF  dstRect;
+    };
+
+    /*! \brief Route \c route from \c srcRect to \c dstRect avoiding all obstacles except \c src and \c dst.
+     *
+     * If \c route has already been routed for the same source and destination geometry and has not been
+     * invalidated, cached route is returned.
+     *
+     * \return an orthogonal polyline starting on \c srcRect border and ending on \c dstRect border, or an empty
+     * polygon if no route could be found.
+     */
+    QPolygonF           route(Key route, Key src, Key dst, const QRectF& srcRect, const QRectF& dstRect) noexcept;
+
+    //! Route a batch of \c requests, return routes in \c requests order.
+    std::vector<QPolygonF>  routeAll(const std::vector<Request>& requests) noexcept;
+
+    //! Mark \c route as invalid, it will be routed again on next route() call.
+    void                invalidateRoute(Key route) noexcept;
+
+    //! Remove route \c route.
+    void                removeRoute(Key route) noexcept;
+
+    //! Return cached route for \c route or an empty polygon.
+    QPolygonF           getRoute(Key route) const noexcept;
+
+private:
+    struct Route {
+        Key         src = nullptr;
+        Key         dst = nullptr;
+        QRectF      srcRect;
+        QRectF      dstRect;
+        QPolygonF   path;
+        bool        dirty = false;
+    };
+    std::unordered_map<Key, Route>  _routes;
+    //! Routes corridors (path bounding rect).
+    qan::SpatialIndex               _corridors;
+
+    //! Generate a raw path (not nudged) from \c srcRect to \c dstRect.
+    QPolygonF           searchPath(Key src, Key dst, const QRectF& srcRect, const QRectF& dstRect) const noexcept;
+
+    //! Generate a Z shaped path (not avoiding obstacles) between \c srcRect and \c dstRect facing sides.
+    static QPolygonF    simplePath(const QRectF& srcRect, const QRectF& dstRect) noexcept;
+
+    //! Nudge \c path inner segments apart from already routed overlapping parallel segments.
+    void                nudgePath(Key route, QPolygonF& path) const noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
@@ -0,0 +1,184 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanPolygonIntersection.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <limits>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define QAN_SIMD_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define QAN_SIMD_NEON
+#endif
+
+// Qt headers
+#include <QLineF>
+
+// QuickQanava headers
+#include "./qanPolygonIntersection.h"
+
+namespace qan { // ::qan
+
+namespace impl { // ::qan::impl
+
+/*! \brief Minimal portable 2 lanes double vector, only operations required by intersection kernel are defined.
+ *
+ * Comparisons return a 2 bits mask, bit \c i is set when comparison is true for lane \c i.
+ * \note load2() deinterleave two consecutive points: \c x lanes contains points x, \c y lanes points y.
+ */
+#if defined(QAN_SIMD_SSE2)
+struct f64x2 {
+    __m128d v;
+    static inline f64x2 set1(double d) noexcept { return {_mm_set1_pd(d)}; }
+    static inline void  load2(const double* p, f64x2& x, f64x2& y) noexcept {
+        const __m128d p0 = _mm_loadu_pd(p);
+        const __m128d p1 = _mm_loadu_pd(p + 2);
+        x.v = _mm_unpacklo_pd(p0, p1);
+        y.v = _mm_unpackhi_pd(p0, p1);
+    }
+    friend inline f64x2 operator+(f64x2 a, f64x2 b) noexcept { return {_mm_add_pd(a.v, b.v)}; }
+    friend inline f64x2 operator-(f64x2 a, f64x2 b) noexcept { return {_mm_sub_pd(a.v, b.v)}; }
+    friend inline f64x2 operator*(f64x2 a, f64x2 b) noexcept { return {_mm_mul_pd(a.v, b.v)}; }
+    friend inline f64x2 operator/(f64x2 a, f64x2 b) noexcept { return {_mm_div_pd(a.v, b.v)}; }
+    //! Lanes where 0 <= a <= 1.
+    static inline int   inUnitRange(f64x2 a) noexcept {
+        return _mm_movemask_pd(_mm_and_pd(_mm_cmpge_pd(a.v, _mm_setzero_pd()),
+                                          _mm_cmple_pd(a.v, _mm_set1_pd(1.))));
+    }
+    //! Lanes where a is finite and not zero.
+    static inline int   nonZeroFinite(f64x2 a) noexcept {
+        const __m128d abs = _mm_andnot_pd(_mm_set1_pd(-0.), a.v);
+        return _mm_movemask_pd(_mm_and_pd(_mm_cmpgt_pd(abs, _mm_setzero_pd()),
+                                          _mm_cmplt_pd(abs, _mm_set1_pd(std::numeric_limits<double>::infinity()))));
+    }
+};
+#elif defined(QAN_SIMD_NEON)
+struct f64x2 {
+    float64x2_t v;
+    static inline f64x2 set1(double d) noexcept { return {vdupq_n_f64(d)}; }
+    static inline void  load2(const double* p, f64x2& x, f64x2& y) noexcept {
+        const float64x2x2_t xy = vld2q_f64(p);
+        x.v = xy.val[0];
+        y.v = xy.val[1];
+    }
+    friend inline f64x2 operator+(f64x2 a, f64x2 b) noexcept { return {vaddq_f64(a.v, b.v)}; }
+    friend inline f64x2 operator-(f64x2 a, f64x2 b) noexcept { return {vsubq_f64(a.v, b.v)}; }
+    friend inline f64x2 operator*(f64x2 a, f64x2 b) noexcept { return {vmulq_f64(a.v, b.v)}; }
+    friend inline f64x2 operator/(f64x2 a, f64x2 b) noexcept { return {vdivq_f64(a.v, b.v)}; }
+    static inline int   inUnitRange(f64x2 a) noexcept {
+        return toMask(vandq_u64(vcgeq_f64(a.v, vdupq_n_f64(0.)),
+                                vcleq_f64(a.v, vdupq_n_f64(1.))));
+    }
+    static inline int   nonZeroFinite(f64x2 a) noexcept {
+        const float64x2_t abs = vabsq_f64(a.v);
+        return toMask(vandq_u64(vcgtq_f64(abs, vdupq_n_f64(0.)),
+                                vcltq_f64(abs, vdupq_n_f64(std::numeric_limits<double>::infinity()))));
+    }
+private:
+    static inline int   toMask(uint64x2_t m) noexcept {
+        return static_cast<int>((vgetq_lane_u64(m, 0) & 1) | ((vgetq_lane_u64(m, 1) & 1) << 1));
+    }
+};
+#endif
+
+//! Scalar kernel, see QLineF::intersects().
+static int  findPolygonLineIntersectionScalar(const QLineF& line, const QPolygonF& polygon, int first) noexcept
+{
+    QPointF intersection;
+    for (auto p = first; p < polygon.length() - 1; ++p) {
+        const QLineF polyLine(polygon[p], polygon[p + 1]);
+        if (line.intersects(polyLine, &intersection) == QLineF::BoundedIntersection)
+            return p;
+    }
+    return -1;
+}
+
+} // ::qan::impl
+
+int     findPolygonLineIntersection(const QPointF& p1, const QPointF& p2, const QPolygonF& polygon) noexcept
+{
+    const QLineF line{p1, p2};
+    int first = 0;
+#if defined(QAN_SIMD_SSE2) || defined(QAN_SIMD_NEON)
+    if constexpr (std::is_same_v<qreal, double>) {
+        // Algorithm: Same equations and operations order than QLineF::intersects(), with segments
+        // [pi, pi+1] and [pi+1, pi+2] in lanes, so that results are identical to scalar kernel.
+            // a = p2 - p1
+            // b = pi - pi+1
+            // c = p1 - pi
+            // denominator = a.y * b.x - a.x * b.y    (non zero and finite)
+            // na = (b.y * c.x - b.x * c.y) * (1 / denominator)   in [0, 1]
+            // nb = (a.x * c.y - a.y * c.x) * (1 / denominator)   in [0, 1]
+        using impl::f64x2;
+        const auto  ax = f64x2::set1(p2.x() - p1.x());
+        const auto  ay = f64x2::set1(p2.y() - p1.y());
+        const auto  p1x = f64x2::set1(p1.x());
+        const auto  p1y = f64x2::set1(p1.y());
+        const auto  one = f64x2::set1(1.);
+        const auto  points = reinterpret_cast<const double*>(polygon.constData());
+        const auto  segmentCount = static_cast<int>(polygon.length()) - 1;
+        for (; first + 2 <= segmentCount; first += 2) {
+            f64x2 sx, sy, dx, dy;   // Segments source and destination points
+            f64x2::load2(points + 2 * first, sx, sy);
+            f64x2::load2(points + 2 * (first + 1), dx, dy);
+            const auto bx = sx - dx;
+            const auto by = sy - dy;
+            const auto cx = p1x - sx;
+            const auto cy = p1y - sy;
+            const auto denominator = ay * bx - ax * by;
+            const auto reciprocal = one / denominator;
+            const auto na = (by * cx - bx * cy) * reciprocal;
+            const auto nb = (ax * cy - ay * cx) * reciprocal;
+            const int mask = f64x2::nonZeroFinite(denominator) &
+                             f64x2::inUnitRange(na) &
+                             f64x2::inUnitRange(nb);
+            if (mask != 0)
+                return first + ((mask & 1) != 0 ? 0 : 1);
+        }
+    }
+#endif
+    return impl::findPolygonLineIntersectionScalar(line, polygon, first);   // Remaining segments
+}
+
+bool    polygonLineIntersection(const QPointF& p1, const QPointF& p2, const QPolygonF& polygon, QPointF& intersection) noexcept
+{
+    const auto p = findPolygonLineIntersection(p1, p2, polygon);
+    if (p < 0)
+        return false;
+    return QLineF{p1, p2}.intersects(QLineF{polygon[p], polygon[p + 1]}, &intersection) == QLineF::BoundedIntersection;
+}
+
+} // ::qan
@@ -0,0 +1,58 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanPolygonIntersection.h
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Qt headers
+#include <QPointF>
+#include <QPolygonF>
+
+namespace qan { // ::qan
+
+/*! \brief Return index of the first \c polygon segment with a bounded intersection with segment [p1, p2], -1 if none.
+ *
+ * Segment \c i is [polygon[i], polygon[i + 1]], intersection semantic is the same as QLineF::intersects()
+ * QLineF::BoundedIntersection. Segments are tested several at once with SSE2 (x86-64) or NEON (AArch64)
+ * 2 lanes double precision vectors, with a scalar fallback on other targets or when qreal is not double.
+ */
+int     findPolygonLineIntersection(const QPointF& p1, const QPointF& p2, const QPolygonF& polygon) noexcept;
+
+/*! \brief Intersect segment [p1, p2] with \c polygon, set \c intersection to the first intersection point and return true, false if there is no intersection.
+ *
+ * \c intersection is left unmodified when there is no intersection.
+ * \sa findPolygonLineIntersection()
+ */
+bool    polygonLineIntersection(const QPointF& p1, const QPointF& p2, const QPolygonF& polygon, QPointF& intersection) noexcept;
+
+} // ::qan
@@ -0,0 +1,408 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanRectNodeItem.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Qt headers
+#include <QGuiApplication>
+#include <QQuickWindow>
+#include <QSGNode>
+#include <QSGGeometryNode>
+#include <QSGVertexColorMaterial>
+#include <QFontMetricsF>
+#if QT_VERSION >= QT_VERSION_CHECK(6, 7, 0)
+#include <QSGTextNode>
+#else
+#include <QSGImageNode>
+#include <QPainter>
+#endif
+
+// QuickQanava headers
+#include "./qanRectNodeItem.h"
+#include "./qanNode.h"
+
+namespace qan { // ::qan
+
+/* RectNodeItem Object Management *///-----------------------------------------
+RectNodeItem::RectNodeItem(QQuickItem* parent) :
+    qan::NodeItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+    setSize(QSizeF{110., 50.});     // Same default size than Qan.Node
+
+    connect(this,   &qan::NodeItem::nodeChanged,
+            this,   &qan::RectNodeItem::onNodeChanged);
+    connect(this,   &qan::NodeItem::styleChanged,
+            this,   &qan::RectNodeItem::onStyleChanged);
+    connect(this,   &QQuickItem::widthChanged,
+            this,   &qan::RectNodeItem::onSizeChanged);
+    connect(this,   &QQuickItem::heightChanged,
+            this,   &qan::RectNodeItem::onSizeChanged);
+    onStyleChanged();   // Style has already been set in qan::NodeItem ctor
+}
+//-----------------------------------------------------------------------------
+
+
+/* Rendering Management *///---------------------------------------------------
+void    RectNodeItem::onNodeChanged()
+{
+    if (_labelNode)
+        disconnect(_labelNode.data(), nullptr, this, nullptr);
+    _labelNode = getNode();
+    if (_labelNode)
+        connect(_labelNode.data(),  &qan::Node::labelChanged,
+                this,               &qan::RectNodeItem::invalidateLabel);
+    invalidateLabel();
+}
+
+void    RectNodeItem::onStyleChanged()
+{
+    // Note: qan::NodeItem::setStyle() disconnect the previous style from this item.
+    const auto style = getStyle();
+    if (style != nullptr) {
+        connect(style,  &qan::NodeStyle::backRadiusChanged,     this,   &qan::RectNodeItem::invalidateBackground);
+        connect(style,  &qan::NodeStyle::backOpacityChanged,    this,   &qan::RectNodeItem::invalidateBackground);
+        connect(style,  &qan::NodeStyle::fillTypeChanged,       this,   &qan::RectNodeItem::invalidateBackground);
+        connect(style,  &qan::NodeStyle::backColorChanged,      this,   &qan::RectNodeItem::invalidateBackground);
+        connect(style,  &qan::NodeStyle::baseColorChanged,      this,   &qan::RectNodeItem::invalidateBackground);
+        connect(style,  &qan::NodeStyle::borderColorChanged,    this,   &qan::RectNodeItem::invalidateBackground);
+        connect(style,  &qan::NodeStyle::borderWidthChanged,    this,   &qan::RectNodeItem::invalidateBackground);
+        connect(style,  &qan::NodeStyle::backRadiusChanged,     this,   &qan::RectNodeItem::invalidateLabel);   // Label margin
+        connect(style,  &qan::NodeStyle::fontPointSizeChanged,  this,   &qan::RectNodeItem::invalidateLabel);
+        connect(style,  &qan::NodeStyle::fontBoldChanged,       this,   &qan::RectNodeItem::invalidateLabel);
+        connect(style,  &qan::NodeStyle::labelColorChanged,     this,   &qan::RectNodeItem::invalidateLabel);
+    }
+    invalidateBackground();
+    invalidateLabel();
+}
+
+void    RectNodeItem::onSizeChanged()
+{
+    setDefaultBoundingShape();      // Same behaviour than Qan.RectNodeTemplate
+    invalidateBackground();
+    invalidateLabel();
+}
+
+void    RectNodeItem::invalidateBackground()
+{
+    _backgroundDirty = true;
+    update();
+}
+
+void    RectNodeItem::invalidateLabel()
+{
+    _labelLayoutDirty = true;
+    polish();
+}
+
+QFont   RectNodeItem::getLabelFont() const
+{
+    auto font = QGuiApplication::font();
+    const auto style = getStyle();
+    if (style != nullptr) {
+        if (style->getFontPointSize() > 0)
+            font.setPointSize(style->getFontPointSize());
+        font.setBold(style->getFontBold());
+    }
+    return font;
+}
+
+//! Return \c color with \c opacity applied as a premultiplied colored vertex.
+static void setColoredPoint(QSGGeometry::ColoredPoint2D& v, const QPointF& p,
+                            const QColor& color, qreal opacity = 1.)
+{
+    const auto a = color.alphaF() * opacity;
+    v.set(static_cast<float>(p.x()), static_cast<float>(p.y()),
+          static_cast<uchar>(color.red() * a), static_cast<uchar>(color.green() * a),
+          static_cast<uchar>(color.blue() * a), static_cast<uchar>(255. * a));
+}
+
+//! Append \c r rounded rect contour with corner \c radius to \c contour, with a constant number of points whatever the radius.
+static void roundedRectContour(const QRectF& r, qreal radius, std::vector<QPointF>& contour)
+{
+    constexpr int   cornerSegments = 6;
+    constexpr qreal pi2 = 1.5707963267948966;
+    radius = std::clamp(radius, 0., std::min(r.width(), r.height()) / 2.);
+    const QPointF centers[4] = { {r.right() - radius, r.top() + radius},        // Clockwise starting from top right
+                                 {r.right() - radius, r.bottom() - radius},
+                                 {r.left() + radius, r.bottom() - radius},
+                                 {r.left() + radius, r.top() + radius} };
+    for (int c = 0; c < 4; c++) {
+        const auto start = -pi2 + c * pi2;
+        for (int s = 0; s <= cornerSegments; s++) {
+            const auto angle = start + s * pi2 / cornerSegments;
+            contour.emplace_back(centers[c].x() + radius * std::cos(angle),
+                                 centers[c].y() + radius * std::sin(angle));
+        }
+    }
+}
+
+//! Fill \c node geometry with \c style background and border triangles for a \c size item.
+static void updateBackgroundGeometry(QSGGeometryNode& node, const QSizeF& size, const qan::NodeStyle* style)
+{
+    // Algorithm:
+    // 1. Generate outer contour, and inner contour when there is a border.
+    // 2. Generate background as a triangle fan around center, colored with a vertical
+    //    gradient from base color to back color for FillGradient.
+    // 3. Generate border ring triangles between outer and inner contours.
+    const auto radius = style != nullptr ? style->getBackRadius() : 4.;
+    const auto opacity = style != nullptr ? style->getBackOpacity() : 1.;
+    const auto backColor = style != nullptr ? style->getBackColor() : QColor{Qt::white};
+    const auto baseColor = style != nullptr &&
+                           style->getFillType() == qan::NodeStyle::FillType::FillGradient ? style->getBaseColor() :
+                                                                                            backColor;
+    const auto borderColor = style != nullptr ? style->getBorderColor() : QColor{Qt::black};
+    const auto borderWidth = style != nullptr ? std::max(0., style->getBorderWidth()) : 1.;
+    const auto h = std::max(size.height(), 1.);
+    const auto fillColor = [&](const QPointF& p) {
+        const auto t = std::clamp(p.y() / h, 0., 1.);
+        return QColor::fromRgbF(baseColor.redF() + t * (backColor.redF() - baseColor.redF()),
+                                baseColor.greenF() + t * (backColor.greenF() - baseColor.greenF()),
+                                baseColor.blueF() + t * (backColor.blueF() - baseColor.blueF()),
+                                baseColor.alphaF() + t * (backColor.alphaF() - baseColor.alphaF()));
+    };
+
+    // 1.
+    std::vector<QPointF> outer;
+    std::vector<QPointF> inner;
+    const QRectF rect{QPointF{0., 0.}, size};
+    roundedRectContour(rect, radius, outer);
+    const auto hasBorder = borderWidth > 0. &&
+                           borderColor.alpha() > 0 &&
+                           size.width() > 2. * borderWidth &&
+                           size.height() > 2. * borderWidth;
+    if (hasBorder)
+        roundedRectContour(rect.adjusted(borderWidth, borderWidth, -borderWidth, -borderWidth),
+                           std::max(0., radius - borderWidth), inner);
+    const auto& fill = hasBorder ? inner : outer;
+    const auto n = static_cast<int>(outer.size());
+
+    auto geometry = node.geometry();
+    geometry->allocate(n * 3 + (hasBorder ? n * 6 : 0));
+    auto v = geometry->vertexDataAsColoredPoint2D();
+
+    // 2.
+    const auto center = rect.center();
+    for (int i = 0; i < n; i++) {
+        const auto& p1 = fill[i];
+        const auto& p2 = fill[(i + 1) % n];
+        setColoredPoint(*v++, center, fillColor(center), opacity);
+        setColoredPoint(*v++, p1, fillColor(p1), opacity);
+        setColoredPoint(*v++, p2, fillColor(p2), opacity);
+    }
+    // 3.
+    if (hasBorder) {
+        for (int i = 0; i < n; i++) {
+            const auto j = (i + 1) % n;
+            setColoredPoint(*v++, outer[i], borderColor);
+            setColoredPoint(*v++, outer[j], borderColor);
+            setColoredPoint(*v++, inner[i], borderColor);
+            setColoredPoint(*v++, inner[i], borderColor);
+            setColoredPoint(*v++, outer[j], borderColor);
+            setColoredPoint(*v++, inner[j], borderColor);
+        }
+    }
+    node.markDirty(QSGNode::DirtyGeometry);
+}
+
+//! Layout \c text in \c layout centered in \c width with at most \c maximumLineCount lines, last line is elided.
+static qreal layoutLabel(QTextLayout& layout, const QString& text, const QFont& font,
+                         qreal width, int maximumLineCount)
+{
+    QTextOption option{Qt::AlignHCenter};
+    option.setWrapMode(QTextOption::WrapAtWordBoundaryOrAnywhere);
+    const auto doLayout = [&](const QString& t) -> bool {   // Return true if t does not fit in maximumLineCount
+        layout.clearLayout();
+        layout.setText(t);
+        layout.setFont(font);
+        layout.setTextOption(option);
+        layout.beginLayout();
+        qreal y = 0.;
+        auto overflow = false;
+        while (true) {
+            auto line = layout.createLine();
+            if (!line.isValid())
+                break;
+            line.setLineWidth(width);
+            line.setPosition(QPointF{0., y});
+            y += line.height();
+            if (layout.lineCount() > maximumLineCount) {
+                overflow = true;
+                break;
+            }
+        }
+        layout.endLayout();
+        return overflow;
+    };
+    if (doLayout(text)) {
+        // Elide text after last visible line
+        const auto last = layout.lineAt(maximumLineCount - 1);
+        const QFontMetricsF metrics{font};
+        const auto elided = text.left(last.textStart()) +
+                            metrics.elidedText(text.mid(last.textStart()), Qt::ElideRight, width);
+        doLayout(elided);
+    }
+    qreal height = 0.;
+    for (int l = 0; l < layout.lineCount(); l++)
+        height += layout.lineAt(l).height();
+    return height;
+}
+
+void    RectNodeItem::updatePolish()
+{
+    if (!_labelLayoutDirty)
+        return;
+    // Algorithm:
+    // 1. Reset previous label.
+    // 2. Layout label text in a maximum of 3 lines, vertically centered.
+    // 3. With Qt < 6.7, rasterize label to an image, image texture is created in updatePaintNode().
+    _labelLayoutDirty = false;
+    _labelDirty = true;
+    update();
+
+    // 1.
+    _labelRect = QRectF{};
+#if QT_VERSION >= QT_VERSION_CHECK(6, 7, 0)
+    _labelLayout.reset();
+#else
+    _labelImage = QImage{};
+#endif
+    const auto style = getStyle();
+    const auto text = getNode() != nullptr ? getNode()->getLabel() : QString{};
+    const auto margin = (style != nullptr ? style->getBackRadius() : 4.) / 2.;
+    const auto labelWidth = width() - 2. * margin;
+    if (text.isEmpty() ||
+        labelWidth <= 0.)
+        return;
+
+    // 2.
+    const auto font = getLabelFont();
+    const auto labelColor = style != nullptr ? style->getLabelColor() : QColor{Qt::black};
+    auto layout = std::make_unique<QTextLayout>();
+    const auto labelHeight = layoutLabel(*layout, text, font, labelWidth, 3);
+    _labelRect = QRectF{QPointF{margin, std::max(margin, (height() - labelHeight) / 2.)},
+                        QSizeF{labelWidth, labelHeight}};
+#if QT_VERSION >= QT_VERSION_CHECK(6, 7, 0)
+    _labelLayout = std::move(layout);
+    _labelColor = labelColor;
+#else
+    // 3.
+    const auto dpr = window() != nullptr ? window()->effectiveDevicePixelRatio() : 1.;
+    QImage image{QSize{static_cast<int>(std::ceil(labelWidth * dpr)),
+                       static_cast<int>(std::ceil(labelHeight * dpr))},
+                 QImage::Format_ARGB32_Premultiplied};
+    if (image.isNull())
+        return;
+    image.setDevicePixelRatio(dpr);
+    image.fill(Qt::transparent);
+    {
+        QPainter painter{&image};
+        painter.setPen(labelColor);
+        layout->draw(&painter, QPointF{0., 0.});
+    }
+    _labelImage = std::move(image);
+#endif
+}
+
+QSGNode*    RectNodeItem::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data)
+    if (width() <= 0. || height() <= 0.) {
+        delete oldNode;
+        _backgroundDirty = _labelDirty = true;
+        return nullptr;
+    }
+    // Algorithm:
+    // 1. Create root node with a background geometry node (label node is appended when needed).
+    // 2. Update background when dirty.
+    // 3. Update label when dirty: layout has already been done in updatePolish(), label
+    //    node is recreated since text nodes can't be updated in place.
+    auto root = oldNode;
+    // 1.
+    if (root == nullptr) {
+        root = new QSGNode{};
+        auto backgroundNode = new QSGGeometryNode{};
+        auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_ColoredPoint2D(), 0};
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        backgroundNode->setGeometry(geometry);
+        backgroundNode->setFlag(QSGNode::OwnsGeometry);
+        backgroundNode->setMaterial(new QSGVertexColorMaterial{});
+        backgroundNode->setFlag(QSGNode::OwnsMaterial);
+        root->appendChildNode(backgroundNode);
+        _backgroundDirty = _labelDirty = true;
+    }
+    const auto style = getStyle();
+
+    // 2.
+    if (_backgroundDirty) {
+        updateBackgroundGeometry(*static_cast<QSGGeometryNode*>(root->firstChild()), size(), style);
+        _backgroundDirty = false;
+    }
+
+    // 3.
+    if (_labelDirty) {
+        _labelDirty = false;
+        if (root->childCount() > 1) {
+            auto labelNode = root->lastChild();
+            root->removeChildNode(labelNode);
+            delete labelNode;
+        }
+        if (_labelRect.isEmpty() ||
+            window() == nullptr)
+            return root;
+#if QT_VERSION >= QT_VERSION_CHECK(6, 7, 0)
+        if (_labelLayout) {
+            auto textNode = window()->createTextNode();
+            textNode->setColor(_labelColor);
+            textNode->addTextLayout(_labelRect.topLeft(), _labelLayout.get());
+            root->appendChildNode(textNode);
+        }
+#else
+        if (!_labelImage.isNull()) {
+            auto imageNode = window()->createImageNode();
+            imageNode->setTexture(window()->createTextureFromImage(_labelImage));
+            imageNode->setOwnsTexture(true);
+            imageNode->setRect(_labelRect);
+            root->appendChildNode(imageNode);
+        }
+#endif
+    }
+    return root;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
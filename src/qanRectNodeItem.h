@@ -0,0 +1,142 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanRectNodeItem.h
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Qt headers
+#include <QQuickItem>
+#include <QPointer>
+#include <QFont>
+#include <QTextLayout>
+#include <QImage>
+
+// Std headers
+#include <memory>
+
+// QuickQanava headers
+#include "./qanNodeItem.h"
+
+namespace qan { // ::qan
+
+/*! \brief Lightweight rectangular node item rendered from C++ with no QML sub items.
+ *
+ * Background, border and label are drawn in updatePaintNode(): background and border are
+ * batched in a single vertex colored geometry node, label is drawn with a scene graph
+ * text node using window shared glyph cache. Label text layout is done in GUI thread
+ * in updatePolish(), updatePaintNode() only build the scene graph nodes. Item is an opt-in alternative to Qan.Node default
+ * delegate for large and simple diagrams, it could be used as a node delegate with:
+ * \code
+ * Component {
+ *   id: lightNodeDelegate
+ *   Qan.RectNodeItem { }
+ * }
+ * // ...
+ * graph.insertNode(lightNodeDelegate)
+ * \endcode
+ *
+ * Following qan::NodeStyle properties are supported: \c backRadius, \c backOpacity, \c fillType,
+ * \c backColor, \c baseColor, \c borderColor, \c borderWidth, \c fontPointSize, \c fontBold and
+ * \c labelColor. Shadow and glow effects and in place label edition are not supported, use
+ * Qan.RectNodeTemplate when they are required.
+ *
+ * \note With Qt < 6.7, QSGTextNode is not available and label is rasterized in a per item
+ * texture: label glyphs are no longer shared and texture memory grows with node count, prefer
+ * Qt >= 6.7 for large graphs.
+ * \nosubgrouping
+ */
+class RectNodeItem : public qan::NodeItem
+{
+    /*! \name RectNodeItem Object Management *///------------------------------
+    //@{
+    Q_OBJECT
+    QML_NAMED_ELEMENT(RectNodeItem)
+public:
+    explicit RectNodeItem(QQuickItem* parent = nullptr);
+    virtual ~RectNodeItem() override = default;
+    RectNodeItem(const RectNodeItem&) = delete;
+    RectNodeItem& operator=(const RectNodeItem&) = delete;
+    RectNodeItem(RectNodeItem&&) = delete;
+    RectNodeItem& operator=(RectNodeItem&&) = delete;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Rendering Management *///----------------------------------------
+    //@{
+protected:
+    //! Layout label text in GUI thread when label is dirty.
+    virtual void        updatePolish() override;
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+
+protected slots:
+    //! Reconnect current node label.
+    void            onNodeChanged();
+    //! Reconnect current style properties.
+    void            onStyleChanged();
+    //! Invalidate background and label geometry on item resize.
+    void            onSizeChanged();
+    //! Invalidate background geometry and colors.
+    void            invalidateBackground();
+    //! Invalidate label layout.
+    void            invalidateLabel();
+
+private:
+    //! Return label font configured from current style.
+    QFont           getLabelFont() const;
+
+    //! True when background geometry must be regenerated in next updatePaintNode().
+    bool            _backgroundDirty = true;
+    //! True when label must be laid out again in next updatePolish().
+    bool            _labelLayoutDirty = true;
+    //! True when label node must be regenerated in next updatePaintNode().
+    bool            _labelDirty = true;
+    //! Label position and size in item coordinates, empty when there is no label to draw.
+    QRectF          _labelRect;
+#if QT_VERSION >= QT_VERSION_CHECK(6, 7, 0)
+    //! Label layout generated in updatePolish(), nullptr when there is no label to draw.
+    std::unique_ptr<QTextLayout>    _labelLayout;
+    //! Label color used when label layout was generated.
+    QColor          _labelColor;
+#else
+    //! Label rasterized in updatePolish(), null when there is no label to draw.
+    QImage          _labelImage;
+#endif
+    //! Last node monitored for label changes.
+    QPointer<qan::Node> _labelNode;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::RectNodeItem)
@@ -123,6 +123,16 @@ void    Selectable::setSelectionItem(QQuickItem* selectionItem) noexcept
     }
 }
 
+QQuickItem* Selectable::takeSelectionItem() noexcept
+{
+    if (!_selectionItem)
+        return nullptr;
+    const auto selectionItem = _selectionItem.data();
+    _selectionItem = nullptr;
+    emitSelectionItemChanged();
+    return selectionItem;
+}
+
 void    Selectable::configureSelectionItem()
 {
     if (_target &&
@@ -93,6 +93,8 @@ public:
     inline QQuickItem*  getSelectionItem() noexcept { return _selectionItem.data(); }
     //! \copydoc getSelectionItem()
     void                setSelectionItem(QQuickItem* selectionItem) noexcept;
+    //! Detach and return current selection item without destroying it (caller take item ownership), return nullptr if there is no selection item.
+    QQuickItem*         takeSelectionItem() noexcept;
 protected:
     //! \copydoc getSelectionItem()
     virtual void        emitSelectionItemChanged() = 0;
@@ -0,0 +1,213 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanSpatialIndex.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+
+// QuickQanava headers
+#include "./qanSpatialIndex.h"
+
+namespace qan { // ::qan
+
+/* SpatialIndex Object Management *///-----------------------------------------
+//! Return floor(\c v) clamped to a range where conversion to cell coordinates is defined (\c v must not be NaN).
+static inline std::int64_t  toCellCoordinate(qreal v) noexcept
+{
+    constexpr qreal maximum = 4503599627370496.;   // 2^52
+    return static_cast<std::int64_t>(std::floor(std::clamp(v, -maximum, maximum)));
+}
+
+//! Return true if \c rect position and size are finite.
+static inline bool  isFinite(const QRectF& rect) noexcept
+{
+    return std::isfinite(rect.x()) && std::isfinite(rect.y()) &&
+           std::isfinite(rect.width()) && std::isfinite(rect.height());
+}
+
+SpatialIndex::SpatialIndex(qreal cellSize) noexcept :
+    _cellSize{cellSize > 0. ? cellSize : 64.}
+{
+}
+
+void    SpatialIndex::insert(Key key, const QRectF& rect) noexcept
+{
+    if (key == nullptr)
+        return;
+    const auto r = rect.normalized();
+    if (!isFinite(r) ||
+        !std::isfinite(r.right()) ||
+        !std::isfinite(r.bottom())) {
+        remove(key);    // Note: Do not keep a stale rect for key
+        return;
+    }
+    const auto level = getLevel(r);
+    const auto s = getLevelCellSize(level);
+    const auto center = r.center();
+    const auto cell = getCell(toCellCoordinate(center.x() / s),
+                              toCellCoordinate(center.y() / s));
+    auto entryIt = _entries.find(key);
+    if (entryIt != _entries.end()) {
+        auto& entry = entryIt->second;
+        entry.rect = r;
+        if (entry.level == level &&
+            entry.cell == cell)
+            return;     // Fast path: rect moved inside its cell
+        remove(key);
+    }
+    _entries.emplace(key, Entry{r, level, cell});
+    _levels[level][cell].push_back(key);
+    _levelSizes[level]++;
+}
+
+bool    SpatialIndex::remove(Key key) noexcept
+{
+    const auto entryIt = _entries.find(key);
+    if (entryIt == _entries.end())
+        return false;
+    const auto& entry = entryIt->second;
+    auto& cells = _levels[entry.level];
+    const auto cellIt = cells.find(entry.cell);
+    if (cellIt != cells.end()) {
+        auto& keys = cellIt->second;
+        const auto keyIt = std::find(keys.begin(), keys.end(), key);
+        if (keyIt != keys.end()) {
+            *keyIt = keys.back();   // Note: Order of keys in a cell is not significant
+            keys.pop_back();
+        }
+        if (keys.empty())
+            cells.erase(cellIt);
+    }
+    _levelSizes[entry.level]--;
+    _entries.erase(entryIt);
+    return true;
+}
+
+const QRectF*   SpatialIndex::getRect(Key key) const noexcept
+{
+    const auto entryIt = _entries.find(key);
+    return entryIt != _entries.end() ? &entryIt->second.rect : nullptr;
+}
+
+void    SpatialIndex::query(const QRectF& rect, std::vector<Key>& keys) const noexcept
+{
+    // Algorithm:
+    // 1. Count cells intersecting rect for all non empty levels, fallback to a linear scan
+    //    if there is more cells to visit than indexed rects.
+    // 2. For every non empty level, visit cells whose loose bounds (cell inflated by half a cell
+    //    size) intersect rect and test cells rects.
+    const auto q = rect.normalized();
+    if (std::isnan(q.x()) || std::isnan(q.y()) ||
+        std::isnan(q.width()) || std::isnan(q.height()) ||
+        std::isnan(q.right()) || std::isnan(q.bottom()))
+        return;     // Note: Infinite query rects are allowed, their cell range is clamped
+    const auto intersects = [&q](const QRectF& r) -> bool {
+        return r.left() <= q.right() && q.left() <= r.right() &&
+               r.top() <= q.bottom() && q.top() <= r.bottom();
+    };
+    const auto getCellRange = [&q](qreal s) -> std::array<std::int64_t, 4> {
+        return {-toCellCoordinate(-(q.left() / s - 1.5)),      // ceil(v) == -floor(-v)
+                toCellCoordinate(q.right() / s + 0.5),
+                -toCellCoordinate(-(q.top() / s - 1.5)),
+                toCellCoordinate(q.bottom() / s + 0.5)};
+    };
+
+    // 1.
+    double cellCount = 0.;
+    for (int level = 0; level < levelCount; level++) {
+        if (_levelSizes[level] == 0)
+            continue;
+        const auto range = getCellRange(getLevelCellSize(level));
+        cellCount += static_cast<double>(range[1] - range[0] + 1) *
+                     static_cast<double>(range[3] - range[2] + 1);
+    }
+    if (cellCount > static_cast<double>(std::max<std::size_t>(64, _entries.size()))) {
+        for (const auto& entry: _entries)
+            if (intersects(entry.second.rect))
+                keys.push_back(entry.first);
+        return;
+    }
+
+    // 2.
+    for (int level = 0; level < levelCount; level++) {
+        if (_levelSizes[level] == 0)
+            continue;
+        const auto& cells = _levels[level];
+        const auto range = getCellRange(getLevelCellSize(level));
+        for (auto y = range[2]; y <= range[3]; y++)
+            for (auto x = range[0]; x <= range[1]; x++) {
+                const auto cellIt = cells.find(getCell(x, y));
+                if (cellIt == cells.end())
+                    continue;
+                for (const auto key: cellIt->second) {
+                    const auto entryIt = _entries.find(key);
+                    if (entryIt != _entries.end() &&
+                        intersects(entryIt->second.rect))
+                        keys.push_back(key);
+                }
+            }
+    }
+}
+
+void    SpatialIndex::query(const QPointF& point, std::vector<Key>& keys) const noexcept
+{
+    query(QRectF{point, QSizeF{0., 0.}}, keys);
+}
+
+void    SpatialIndex::clear() noexcept
+{
+    _entries.clear();
+    for (auto& cells: _levels)
+        cells.clear();
+    _levelSizes.fill(0);
+}
+
+int     SpatialIndex::getLevel(const QRectF& rect) const noexcept
+{
+    const auto extent = std::max(rect.width(), rect.height());
+    int level = 0;
+    while (level < levelCount - 1 &&
+           getLevelCellSize(level) < extent)
+        level++;
+    return level;
+}
+
+std::int64_t    SpatialIndex::getCell(std::int64_t x, std::int64_t y) noexcept
+{
+    return static_cast<std::int64_t>((static_cast<std::uint64_t>(x) << 32) |
+                                     static_cast<std::uint32_t>(y));
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,113 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    qanSpatialIndex.h
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Qt headers
+#include <QRectF>
+#include <QPointF>
+
+namespace qan { // ::qan
+
+/*! \brief Dynamic spatial index of bounding rects identified by opaque keys.
+ *
+ * Index is a hierarchical loose grid (equivalent to a loose quadtree without root bounds): a rect is
+ * stored once, at the level whose cell size fit the rect extent, in the cell containing the rect
+ * center. Cells bounds are inflated by half a cell size, so a query only has to visit a few cells
+ * per non empty level.
+ *
+ * Insertion, update and removal are O(1), point queries are O(levels) where levels is the log2
+ * of the largest to smallest rect size ratio. For very large query rects, index fallback to a
+ * linear scan.
+ *
+ * \note Index does not own keys, key lifetime must be managed by the user.
+ * \nosubgrouping
+ */
+class SpatialIndex
+{
+    /*! \name SpatialIndex Object Management *///------------------------------
+    //@{
+public:
+    using Key = const void*;
+
+    //! \c cellSize is the size of the finest level cells, rects smaller than \c cellSize are all stored at level 0.
+    explicit SpatialIndex(qreal cellSize = 64.) noexcept;
+    ~SpatialIndex() = default;
+    SpatialIndex(const SpatialIndex&) = default;
+    SpatialIndex& operator=(const SpatialIndex&) = default;
+
+public:
+    //! Insert \c key with bounding rect \c rect, or update \c key rect if \c key is already indexed (\c key is removed if \c rect is not finite).
+    void            insert(Key key, const QRectF& rect) noexcept;
+    //! Remove \c key, return false if \c key was not indexed.
+    bool            remove(Key key) noexcept;
+    //! Return \c key rect or nullptr if \c key is not indexed.
+    const QRectF*   getRect(Key key) const noexcept;
+
+    //! Append to \c keys the keys whose rect intersect \c rect (rect borders included).
+    void            query(const QRectF& rect, std::vector<Key>& keys) const noexcept;
+    //! Append to \c keys the keys whose rect contains \c point (rect borders included).
+    void            query(const QPointF& point, std::vector<Key>& keys) const noexcept;
+
+    std::size_t     getSize() const noexcept { return _entries.size(); }
+    void            clear() noexcept;
+
+private:
+    static constexpr int levelCount = 24;
+
+    struct Entry {
+        QRectF          rect;
+        int             level = 0;
+        std::int64_t    cell = 0;
+    };
+    qreal                                   _cellSize = 64.;
+    std::unordered_map<Key, Entry>          _entries;
+    //! Keys for every (level, cell).
+    std::array<std::unordered_map<std::int64_t, std::vector<Key>>, levelCount>  _levels;
+    std::array<std::size_t, levelCount>     _levelSizes{};
+
+    int                 getLevel(const QRectF& rect) const noexcept;
+    inline qreal        getLevelCellSize(int level) const noexcept { return _cellSize * static_cast<qreal>(std::int64_t{1} << level); }
+    static std::int64_t getCell(std::int64_t x, std::int64_t y) noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
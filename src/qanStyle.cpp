@@ -308,6 +308,39 @@ bool    EdgeStyle::setDashPattern(const QVector<qreal>& dashPattern) noexcept
 }
 
 const QVector<qreal>& EdgeStyle::getDashPattern() const noexcept { return _dashPattern; }
+
+bool    EdgeStyle::setEffectType(EffectType effectType) noexcept
+{
+    if (effectType != _effectType) {
+        _effectType = effectType;
+        emit effectTypeChanged();
+        emit styleModified();
+        return true;
+    }
+    return false;
+}
+
+bool    EdgeStyle::setEffectColor(QColor effectColor) noexcept
+{
+    if (_effectColor != effectColor) {
+        _effectColor = effectColor;
+        emit effectColorChanged();
+        emit styleModified();
+        return true;
+    }
+    return false;
+}
+
+bool    EdgeStyle::setEffectSpeed(qreal effectSpeed) noexcept
+{
+    if (!qFuzzyCompare(1. + _effectSpeed, 1. + effectSpeed)) {
+        _effectSpeed = effectSpeed;
+        emit effectSpeedChanged();
+        emit styleModified();
+        return true;
+    }
+    return false;
+}
 //-----------------------------------------------------------------------------
 
 } // ::qan
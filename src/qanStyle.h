@@ -471,6 +471,58 @@ protected:
 signals:
     //! \copydoc dashPattern
     void            dashPatternChanged();
+
+public:
+    /*! \brief Define animated effect used to draw edge line (either nothing, moving dashes, flow particles or a pulse hilight).
+     *
+     * Effects are animated in batched edges layer fragment shader (see qan::EdgeItem::batched and
+     * qan::EdgeEffectMaterial), they are ignored for edges drawn with a QML delegate and when
+     * QuickQanava is built without Qt ShaderTools.
+     */
+    enum class EffectType : unsigned int {
+        //! No animated effect.
+        EffectNone      = 0,
+        //! Dashes defined by \c dashPattern moving from source to destination.
+        EffectDash      = 1,
+        //! Particles (\c dashPattern dash length, spaced by \c dashPattern space length) drawn with \c effectColor flowing from source to destination.
+        EffectFlow      = 2,
+        //! Whole edge pulsing between \c lineColor and \c effectColor.
+        EffectPulse     = 3
+    };
+    Q_ENUM(EffectType)
+
+public:
+    //! \copydoc EffectType, default to EffectNone.
+    Q_PROPERTY(EffectType effectType READ getEffectType WRITE setEffectType NOTIFY effectTypeChanged FINAL)
+    bool                setEffectType(EffectType effectType) noexcept;
+    inline EffectType   getEffectType() const noexcept { return _effectType; }
+protected:
+    EffectType          _effectType = EffectType::EffectNone;
+signals:
+    void                effectTypeChanged();
+
+public:
+    //! Flow particles and pulse hilight color, default to white.
+    Q_PROPERTY(QColor effectColor READ getEffectColor WRITE setEffectColor NOTIFY effectColorChanged FINAL)
+    bool            setEffectColor(QColor effectColor) noexcept;
+    inline QColor   getEffectColor() const noexcept { return _effectColor; }
+protected:
+    QColor          _effectColor = QColor{255, 255, 255, 255};
+signals:
+    void            effectColorChanged();
+
+public:
+    /*! \brief Effect speed in pixels per second along edge line, default to 40.
+     *
+     * Pulse effect period is the time necessary to travel \c dashPattern length at \c effectSpeed.
+     */
+    Q_PROPERTY(qreal effectSpeed READ getEffectSpeed WRITE setEffectSpeed NOTIFY effectSpeedChanged FINAL)
+    bool            setEffectSpeed(qreal effectSpeed) noexcept;
+    inline qreal    getEffectSpeed() const noexcept { return _effectSpeed; }
+protected:
+    qreal           _effectSpeed = 40.;
+signals:
+    void            effectSpeedChanged();
     //@}
     //-------------------------------------------------------------------------
 };
@@ -486,3 +538,4 @@ Q_DECLARE_METATYPE(qan::NodeStyle::EffectType)
 QML_DECLARE_TYPE(qan::EdgeStyle)
 Q_DECLARE_METATYPE(qan::EdgeStyle::LineType)
 Q_DECLARE_METATYPE(qan::EdgeStyle::ArrowShape)
+Q_DECLARE_METATYPE(qan::EdgeStyle::EffectType)
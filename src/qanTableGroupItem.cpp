@@ -610,6 +610,21 @@ void    TableGroupItem::layoutCells()
     }
 }
 
+void    TableGroupItem::scheduleLayoutCells()
+{
+    auto graph = getGraph();
+    if (graph == nullptr) {
+        layoutCells();
+        return;
+    }
+    // Note: Use _cells as task key, item (this) is already qan::GroupItem::groupMoved() task key,
+    // using it would replace a pending group moved task.
+    graph->getFrameScheduler()->schedule(&_cells, [tableGroupItem = QPointer<qan::TableGroupItem>{this}]() {
+        if (tableGroupItem)
+            tableGroupItem->layoutCells();
+    }, qan::FrameScheduler::Priority::Normal);
+}
+
 bool    TableGroupItem::setGroup(qan::Group* group) noexcept
 {
     if (qan::GroupItem::setGroup(group)) {
@@ -626,11 +641,11 @@ bool    TableGroupItem::setGroup(qan::Group* group) noexcept
                 if (border)
                     border->setTableGroup(tableGroup);
             connect(tableGroup, &qan::TableGroup::cellSpacingChanged,
-                    this,       &qan::TableGroupItem::layoutCells);
+                    this,       &qan::TableGroupItem::scheduleLayoutCells);
             connect(tableGroup, &qan::TableGroup::cellMinimumSizeChanged,
-                    this,       &qan::TableGroupItem::layoutCells);
+                    this,       &qan::TableGroupItem::scheduleLayoutCells);
             connect(tableGroup, &qan::TableGroup::tablePaddingChanged,
-                    this,       &qan::TableGroupItem::layoutCells);
+                    this,       &qan::TableGroupItem::scheduleLayoutCells);
 
             // Set cell reference to group
             for (auto cell: _cells)
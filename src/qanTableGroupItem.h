@@ -122,6 +122,9 @@ public slots:
     //! Layout table cells, triggered when table style change.
     void        layoutCells();
 
+    //! Schedule a layoutCells() call in graph frame scheduler, coalescing table style changes occurring in the same frame.
+    void        scheduleLayoutCells();
+
 public:
     virtual bool            setGroup(qan::Group* group) noexcept override;
 protected:
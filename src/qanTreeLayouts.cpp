@@ -33,6 +33,7 @@
 //-----------------------------------------------------------------------------
 
 // Std headers
+#include <algorithm>
 #include <queue>
 #include <unordered_set>
 
@@ -174,16 +175,20 @@ void    RandomLayout::layout(qan::Node& root) noexcept
 
     auto outNodes = graph->collectSubNodes(QVector<qan::Node*>{&root}, false);
     outNodes.insert(&root);
+    std::vector<qan::Node*> nodes;
+    qan::LayoutGraph layoutGraph;
     for (auto n : outNodes) {
         auto node = const_cast<qan::Node*>(n);
         if (node->getItem() == nullptr)
             continue;
-        const auto nodeBr = node->getItem()->boundingRect();
-        qreal maxX = layoutRect.width() - nodeBr.width();       // Generate and set random x and y positions
-        qreal maxY = layoutRect.height() - nodeBr.height();     // within available layoutRect area
-        node->getItem()->setX(QRandomGenerator::global()->bounded(maxX) + layoutRect.left());
-        node->getItem()->setY(QRandomGenerator::global()->bounded(maxY) + layoutRect.top());
+        nodes.push_back(node);
+        layoutGraph.sizes.push_back(node->getItem()->boundingRect().size());
     }
+    qan::RandomLayoutEngine engine;
+    engine.layoutRect = layoutRect;
+    const auto result = engine.layout(layoutGraph);
+    for (std::size_t n = 0; n < nodes.size(); n++)
+        nodes[n]->getItem()->setPosition(result.positions[n]);
 }
 
 void    RandomLayout::layout(qan::Node* root) noexcept
@@ -215,86 +220,173 @@ const OrgTreeLayout::LayoutOrientation  OrgTreeLayout::getLayoutOrientation() co
 
 void    OrgTreeLayout::layout(qan::Node& root, qreal xSpacing, qreal ySpacing) noexcept
 {
-    // Note: Recursive variant of Reingold-Tilford algorithm with naive shifting (ie shifting
-    // based on the less space efficient sub tree bounding rect intersection...)
+    // Note: Layout is delegated to qan::OrgTreeLayoutEngine, layout state is saved for
+    // every node to allow latter updateLayout() calls.
 
     // Pre-condition: root must be a tree subgraph, this is not enforced in this algorithm,
-    // any circuit will lead to intinite recursion...
+    // circuits are ignored but will lead to invalid layouts...
+    if (root.getItem() == nullptr)
+        return;
+    invalidateLayout();
+    if (getLayoutOrientation() == LayoutOrientation::Undefined)
+        return;
+    _root = &root;
+    _stateOrientation = getLayoutOrientation();
+    _xSpacing = xSpacing;
+    _ySpacing = ySpacing;
+    runLayout(root, /*incremental*/false);
+}
 
-    // Algorithm:
-        // Traverse graph DFS aligning child nodes vertically
-        // At a given level: `shift` next node according to previous node sub-tree BR
-    auto layoutVert_rec = [xSpacing, ySpacing](auto&& self, auto& childNodes, QRectF br) -> QRectF {
-        const auto x = br.right() + xSpacing;
-        for (auto child: childNodes) {
-            child->getItem()->setX(x);
-            child->getItem()->setY(br.bottom() + ySpacing);
-            // Take into account this level maximum width
-            br = br.united(child->getItem()->boundingRect().translated(child->getItem()->position()));
-            const auto childBr = self(self, child->get_out_nodes(), br);
-            br.setBottom(childBr.bottom()); // Note: Do not take full child BR into account to avoid x drifting
-        }
-        return br;
-    };
+void    OrgTreeLayout::layout(qan::Node* root, qreal xSpacing, qreal ySpacing) noexcept
+{
+    if (root != nullptr)
+        layout(*root, xSpacing, ySpacing);
+}
+//-----------------------------------------------------------------------------
 
-    auto layoutHoriz_rec = [xSpacing, ySpacing](auto&& self, auto& childNodes, QRectF br) -> QRectF {
-        const auto y = br.bottom() + ySpacing;
-        for (auto child: childNodes) {
-            child->getItem()->setX(br.right() + xSpacing);
-            child->getItem()->setY(y);
-            // Take into account this level maximum width
-            br = br.united(child->getItem()->boundingRect().translated(child->getItem()->position()));
-            const auto childBr = self(self, child->get_out_nodes(), br);
-            br.setRight(childBr.right()); // Note: Do not take full child BR into account to avoid x drifting
-        }
-        return br;
-    };
 
-    auto layoutMixed_rec = [xSpacing, ySpacing, layoutHoriz_rec](auto&& self, auto& childNodes, QRectF br) -> QRectF {
-        auto childsAreLeafs = true;
-        for (const auto child: childNodes)
-            if (child->get_out_nodes().size() != 0) {
-                childsAreLeafs = false;
-                break;
-            }
-        if (childsAreLeafs)
-            return layoutHoriz_rec(self, childNodes, br);
-        else {
-            const auto x = br.right() + xSpacing;
-            for (auto child: childNodes) {
-                child->getItem()->setX(x);
-                child->getItem()->setY(br.bottom() + ySpacing);
-                // Take into account this level maximum width
-                br = br.united(child->getItem()->boundingRect().translated(child->getItem()->position()));
-                const auto childBr = self(self, child->get_out_nodes(), br);
-                br.setBottom(childBr.bottom()); // Note: Do not take full child BR into account to avoid x drifting
-            }
-        }
-        return br;
-    };
+/* OrgTreeLayout Incremental Layout *///---------------------------------------
+void    OrgTreeLayout::markDirty(qan::Node* node) noexcept
+{
+    if (node != nullptr)
+        _dirtyNodes.push_back(node);
+}
+
+void    OrgTreeLayout::updateLayout(qan::Node& root) noexcept
+{
+    // Algorithm:
+    // 1. Fallback to a full layout if there is no valid state for root.
+    // 2. Collect dirty nodes and their ancestors in _dirtyPaths.
+    // 3. Run layout, reusing (and eventually translating) subtrees with a valid state
+    //    that are not in _dirtyPaths.
+    if (root.getItem() == nullptr)
+        return;
 
-    // Note: QQuickItem boundingRect() is in item local CS, translate to "scene" CS.
-    switch (getLayoutOrientation()) {
-    case LayoutOrientation::Undefined: return;
-    case LayoutOrientation::Vertical:
-        layoutVert_rec(layoutVert_rec, root.get_out_nodes(),
-                       root.getItem()->boundingRect().translated(root.getItem()->position()));
-        break;
-    case LayoutOrientation::Horizontal:
-        layoutHoriz_rec(layoutHoriz_rec, root.get_out_nodes(),
-                        root.getItem()->boundingRect().translated(root.getItem()->position()));
-        break;
-    case LayoutOrientation::Mixed:
-        layoutMixed_rec(layoutMixed_rec, root.get_out_nodes(),
-                        root.getItem()->boundingRect().translated(root.getItem()->position()));
-        break;
+    // 1.
+    if (_root != &root ||
+        _stateOrientation != getLayoutOrientation()) {
+        layout(root, _xSpacing, _ySpacing);
+        return;
+    }
+
+    // 2.
+    _dirtyPaths.clear();
+    std::vector<const qan::Node*> nodes;
+    for (const auto& dirtyNode: _dirtyNodes)
+        if (dirtyNode)
+            nodes.push_back(dirtyNode.data());
+    _dirtyNodes.clear();
+    while (!nodes.empty()) {
+        const auto node = nodes.back();
+        nodes.pop_back();
+        if (!_dirtyPaths.insert(node).second)
+            continue;   // Already visited (non tree graph)
+        for (const auto inNode: node->get_in_nodes())
+            if (inNode != nullptr)
+                nodes.push_back(inNode);
     }
+
+    // 3.
+    runLayout(root, /*incremental*/true);
+    _dirtyPaths.clear();
 }
 
-void    OrgTreeLayout::layout(qan::Node* root, qreal xSpacing, qreal ySpacing) noexcept
+void    OrgTreeLayout::updateLayout(qan::Node* root) noexcept
 {
     if (root != nullptr)
-        layout(*root, xSpacing, ySpacing);
+        updateLayout(*root);
+}
+
+void    OrgTreeLayout::invalidateLayout() noexcept
+{
+    _states.clear();
+    _dirtyNodes.clear();
+    _dirtyPaths.clear();
+    _root = nullptr;
+    _stateOrientation = LayoutOrientation::Undefined;
+}
+
+void    OrgTreeLayout::runLayout(qan::Node& root, bool incremental) noexcept
+{
+    // Algorithm:
+    // 1. Generate a topology snapshot of root tree, nodes without items are ignored.
+    // 2. Generate engine state from cached states: a node is reusable if its item, size and
+    //    childs are unchanged and it is not in _dirtyPaths.
+    // 3. Run layout engine.
+    // 4. Apply positions to modified items and cache layout state.
+
+    // 1.
+    std::vector<qan::Node*> nodes;
+    qan::LayoutGraph graph;
+    std::unordered_map<const qan::Node*, int> indexes;
+    const auto insertNode = [&nodes, &graph, &indexes](qan::Node* node) -> std::pair<int, bool> {
+        const auto [index, inserted] = indexes.emplace(node, static_cast<int>(nodes.size()));
+        if (inserted) {
+            nodes.push_back(node);
+            graph.sizes.push_back(node->getItem()->size());
+            graph.positions.push_back(node->getItem()->position());
+        }
+        return {index->second, inserted};
+    };
+    insertNode(&root);
+    std::vector<int> stack{0};
+    while (!stack.empty()) {
+        const auto n = stack.back();
+        stack.pop_back();
+        for (const auto child: nodes[n]->get_out_nodes()) {
+            if (child == nullptr ||
+                child->getItem() == nullptr)
+                continue;
+            const auto [c, inserted] = insertNode(child);
+            graph.edges.emplace_back(n, c);
+            if (inserted)
+                stack.push_back(c);
+        }
+    }
+
+    // 2.
+    std::vector<qan::OrgTreeLayoutEngine::SubTreeState> layoutStates(nodes.size());
+    std::vector<bool> reusable(nodes.size(), false);
+    if (incremental) {
+        for (std::size_t n = 0; n < nodes.size(); n++) {
+            const auto state = _states.find(nodes[n]);
+            if (state == _states.end())
+                continue;
+            const auto& childNodes = nodes[n]->get_out_nodes();
+            layoutStates[n] = state->second.layoutState;
+            reusable[n] = state->second.item == nodes[n]->getItem() &&
+                          _dirtyPaths.find(nodes[n]) == _dirtyPaths.end() &&
+                          state->second.size == graph.sizes[n] &&
+                          state->second.childs.size() == static_cast<std::size_t>(childNodes.size()) &&
+                          std::equal(state->second.childs.cbegin(), state->second.childs.cend(), childNodes.cbegin());
+        }
+    }
+
+    // 3.
+    qan::OrgTreeLayoutEngine engine;
+    switch (_stateOrientation) {
+    case LayoutOrientation::Horizontal: engine.orientation = qan::OrgTreeLayoutEngine::Orientation::Horizontal; break;
+    case LayoutOrientation::Mixed:      engine.orientation = qan::OrgTreeLayoutEngine::Orientation::Mixed;      break;
+    default:                            engine.orientation = qan::OrgTreeLayoutEngine::Orientation::Vertical;   break;
+    }
+    engine.root = 0;
+    engine.xSpacing = _xSpacing;
+    engine.ySpacing = _ySpacing;
+    const auto result = engine.layout(graph, layoutStates, &reusable);
+
+    // 4.
+    for (std::size_t n = 0; n < nodes.size(); n++) {
+        const auto nodeItem = nodes[n]->getItem();
+        if (result.positions[n] != graph.positions[n])
+            nodeItem->setPosition(result.positions[n]);
+        if (!layoutStates[n].valid)
+            continue;   // Root and unreachable nodes
+        auto& state = _states[nodes[n]];
+        state.item = nodeItem;
+        state.size = graph.sizes[n];
+        state.childs.assign(nodes[n]->get_out_nodes().cbegin(), nodes[n]->get_out_nodes().cend());
+        state.layoutState = layoutStates[n];
+    }
 }
 //-----------------------------------------------------------------------------
 
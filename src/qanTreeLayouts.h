@@ -41,8 +41,14 @@
 #include <QSharedPointer>
 #include <QAbstractListModel>
 
+// Std headers
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 // QuickQanava headers
 #include "./qanGraph.h"
+#include "./qanLayoutEngines.h"
 
 
 namespace qan { // ::qan
@@ -76,6 +82,8 @@ public:
 
 
 /*! \brief Layout nodes randomly inside a bounding rect.
+ *
+ * QML adapter for qan::RandomLayoutEngine.
  * \nosubgrouping
  */
 class RandomLayout : public QObject
@@ -125,7 +133,12 @@ public:
  * respecting node ordering and working for n-ary trees.
  *
  * \note This layout does not enforces that the input graph is a tree, laying out
- * a non-tree graph might lead to infinite recursion.
+ * a non-tree graph might lead to invalid layouts.
+ *
+ * Layout state is kept between calls: after a first layout(), modified nodes could be
+ * signaled with markDirty() and updateLayout() will only move the affected subtrees.
+ *
+ * QML adapter for qan::OrgTreeLayoutEngine.
  *
  * \nosubgrouping
  */
@@ -181,8 +194,7 @@ public:
      * n beeing the number of nodes in root "tree subgraph".
      *
      * \note \c root must be a tree subgraph, this method will not enforce this condition,
-     * running this algorithm on a non tree subgraph might lead to inifinite recursions or
-     * invalid layouts.
+     * running this algorithm on a non tree subgraph might lead to invalid layouts.
      */
     void                layout(qan::Node& root, qreal xSpacing = 25., qreal ySpacing = 25.) noexcept;
 
@@ -190,6 +202,62 @@ public:
     Q_INVOKABLE void    layout(qan::Node* root, qreal xSpacing = 25., qreal ySpacing = 25.) noexcept;
     //@}
     //-------------------------------------------------------------------------
+
+    /*! \name OrgTreeLayout Incremental Layout *///-----------------------------
+    //@{
+public:
+    /*! \brief Mark \c node as modified since last layout() call, \c node subtree will be laid out again on next updateLayout().
+     *
+     * Mark a node dirty when its size change, or when child nodes are inserted or removed (mark
+     * the parent node in that case), modified node ancestors are automatically taken into account.
+     */
+    Q_INVOKABLE void    markDirty(qan::Node* node) noexcept;
+
+    /*! \brief Re-layout only the parts of the last laid out tree that have been modified.
+     *
+     * Layout state from last layout() or updateLayout() call is reused: subtrees with no dirty nodes
+     * (see markDirty()) are either left untouched, or translated as a whole when a modification
+     * before them in the tree shifted their position. Subtrees containing dirty nodes are laid out
+     * again using last layout() \c xSpacing and \c ySpacing.
+     *
+     * If \c root is not the last laid out root or if layoutOrientation has changed, a full layout()
+     * is applied.
+     */
+    void                updateLayout(qan::Node& root) noexcept;
+
+    //! QML invokable version of updateLayout().
+    Q_INVOKABLE void    updateLayout(qan::Node* root) noexcept;
+
+    //! Clear internal layout state, next updateLayout() will run a full layout().
+    Q_INVOKABLE void    invalidateLayout() noexcept;
+
+private:
+    //! Layout state for a node subtree, cached between layout() and updateLayout() calls.
+    struct SubTreeState {
+        //! Node item the state has been generated for (detect node destruction and address reuse).
+        QPointer<QQuickItem>                    item;
+        //! Node item size when laid out.
+        QSizeF                                  size;
+        //! Node out nodes when laid out.
+        std::vector<const qan::Node*>           childs;
+        //! Layout engine state for node subtree.
+        qan::OrgTreeLayoutEngine::SubTreeState  layoutState;
+    };
+
+    //! Snapshot \c root tree topology and items geometry, run layout engine and apply the result to items.
+    void    runLayout(qan::Node& root, bool incremental) noexcept;
+
+    std::unordered_map<const qan::Node*, SubTreeState>  _states;
+    std::vector<QPointer<qan::Node>>                    _dirtyNodes;
+    //! Dirty nodes and their ancestors, generated at updateLayout() beginning.
+    std::unordered_set<const qan::Node*>                _dirtyPaths;
+
+    QPointer<qan::Node>     _root;
+    LayoutOrientation       _stateOrientation = LayoutOrientation::Undefined;
+    qreal                   _xSpacing = 25.;
+    qreal                   _ySpacing = 25.;
+    //@}
+    //-------------------------------------------------------------------------
 };
 
 } // ::qan
@@ -0,0 +1,72 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    edgeeffect.frag
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+#version 440
+
+// Edge effect coordinate: x is arc length from edge source, y is position across line
+// in [-1, 1], or 2. for edge ends.
+layout(location = 0) in vec2 coord;
+
+layout(location = 0) out vec4 fragColor;
+
+layout(std140, binding = 0) uniform buf {
+    mat4    qt_Matrix;
+    float   qt_Opacity;
+    float   time;
+    float   speed;
+    int     effect;         // See qan::EdgeStyle::EffectType
+    vec4    color;
+    vec4    effectColor;
+    vec2    pattern;        // Dash (or particle) length and space length in pixels
+};
+
+void main()
+{
+    bool  line = abs(coord.y) <= 1.;
+    float period = max(pattern.x + pattern.y, 0.001);
+    float offset = mod(coord.x - time * speed, period);     // Pattern is moving from source to destination
+    vec4  c = color;
+    if (effect == 1) {              // EffectDash
+        if (line && offset > pattern.x)
+            discard;
+    } else if (effect == 2) {       // EffectFlow
+        if (line) {                 // Round particles centered on pattern dash
+            vec2 d = vec2((offset - pattern.x * 0.5) / max(pattern.x * 0.5, 0.001), coord.y);
+            c = mix(color, effectColor, 1. - smoothstep(0.6, 1., length(d)));
+        }
+    } else if (effect == 3) {       // EffectPulse
+        c = mix(color, effectColor, 0.5 + 0.5 * sin(6.2831853 * time * speed / period));
+    }
+    fragColor = c * qt_Opacity;
+}
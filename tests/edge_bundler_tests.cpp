@@ -0,0 +1,185 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    edge_bundler_tests.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <cmath>
+#include <random>
+#include <vector>
+
+// QuickQanava headers
+#include "../src/qanEdgeBundler.h"
+
+// Google Test
+#include <gtest/gtest.h>
+
+//! Return edge \c e polyline from \c polylines.
+static std::vector<QPointF> getPolyline(const qan::EdgeBundler::Polylines& polylines, std::size_t e)
+{
+    return std::vector<QPointF>(polylines.points.begin() + static_cast<std::ptrdiff_t>(polylines.offsets[e]),
+                                polylines.points.begin() + static_cast<std::ptrdiff_t>(polylines.offsets[e + 1]));
+}
+
+//! Return \c polyline point at half of its points.
+static QPointF getMiddle(const std::vector<QPointF>& polyline)
+{
+    return polyline[polyline.size() / 2];
+}
+
+static qreal distance(const QPointF& a, const QPointF& b)
+{
+    const auto d = b - a;
+    return std::sqrt(QPointF::dotProduct(d, d));
+}
+
+//! Return a root group containing two sibling groups A (index 1) and B (index 2).
+static qan::EdgeBundler::Hierarchy makeSiblingsHierarchy()
+{
+    qan::EdgeBundler::Hierarchy hierarchy;
+    hierarchy.parents = { -1, 0, 0 };
+    hierarchy.centers = { QPointF{500., 500.}, QPointF{100., 500.}, QPointF{900., 500.} };
+    return hierarchy;
+}
+
+//-----------------------------------------------------------------------------
+// qan::EdgeBundler tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_EdgeBundler, configuration)
+{
+    qan::EdgeBundler bundler;
+    bundler.setStrength(2.);
+    EXPECT_EQ(bundler.getStrength(), 1.);
+    bundler.setStrength(-1.);
+    EXPECT_EQ(bundler.getStrength(), 0.);
+    bundler.setSpanSegments(0);
+    EXPECT_EQ(bundler.getSpanSegments(), 1);
+}
+
+TEST(qan_EdgeBundler, root_edges)
+{
+    // TEST: Edges between root nodes are not bundled
+    qan::EdgeBundler bundler;
+    qan::EdgeBundler::Polylines polylines;
+    qan::EdgeBundler::Edge edge;
+    edge.p1 = QPointF{0., 0.};
+    edge.p2 = QPointF{100., 50.};
+    bundler.bundle(qan::EdgeBundler::Hierarchy{}, {edge}, polylines, 1);
+    ASSERT_EQ(polylines.offsets.size(), 2u);
+    const auto polyline = getPolyline(polylines, 0);
+    ASSERT_EQ(polyline.size(), 2u);
+    EXPECT_EQ(polyline.front(), edge.p1);
+    EXPECT_EQ(polyline.back(), edge.p2);
+}
+
+TEST(qan_EdgeBundler, bundles)
+{
+    // TEST: Polylines should start and end on edges ends, and edges crossing the same groups should
+    // be bundled together around their lowest common ancestor
+    qan::EdgeBundler bundler;
+    bundler.setStrength(1.);
+    const auto hierarchy = makeSiblingsHierarchy();
+    std::vector<qan::EdgeBundler::Edge> edges(2);
+    edges[0].src = edges[1].src = 1;
+    edges[0].dst = edges[1].dst = 2;
+    edges[0].p1 = QPointF{80., 300.};
+    edges[0].p2 = QPointF{920., 300.};
+    edges[1].p1 = QPointF{120., 700.};
+    edges[1].p2 = QPointF{880., 700.};
+    qan::EdgeBundler::Polylines polylines;
+    bundler.bundle(hierarchy, edges, polylines, 1);
+    ASSERT_EQ(polylines.offsets.size(), 3u);
+    EXPECT_EQ(polylines.offsets.front(), 0u);
+    EXPECT_EQ(polylines.offsets.back(), polylines.points.size());
+    const auto polyline0 = getPolyline(polylines, 0);
+    const auto polyline1 = getPolyline(polylines, 1);
+    ASSERT_GE(polyline0.size(), 3u);
+    ASSERT_GE(polyline1.size(), 3u);
+    EXPECT_EQ(polyline0.front(), edges[0].p1);
+    EXPECT_EQ(polyline0.back(), edges[0].p2);
+    EXPECT_EQ(polyline1.front(), edges[1].p1);
+    EXPECT_EQ(polyline1.back(), edges[1].p2);
+    // Straight lines middles are 400 apart, bundled lines should pass close to root group center
+    EXPECT_LT(distance(getMiddle(polyline0), getMiddle(polyline1)), 100.);
+    EXPECT_LT(distance(getMiddle(polyline0), hierarchy.centers[0]), 100.);
+}
+
+TEST(qan_EdgeBundler, zero_strength)
+{
+    // TEST: With a zero strength, bundled lines should be straight lines
+    qan::EdgeBundler bundler;
+    bundler.setStrength(0.);
+    std::vector<qan::EdgeBundler::Edge> edges(1);
+    edges[0].src = 1;
+    edges[0].dst = 2;
+    edges[0].p1 = QPointF{80., 300.};
+    edges[0].p2 = QPointF{920., 700.};
+    qan::EdgeBundler::Polylines polylines;
+    bundler.bundle(makeSiblingsHierarchy(), edges, polylines, 1);
+    const auto line = edges[0].p2 - edges[0].p1;
+    for (const auto& p : getPolyline(polylines, 0)) {
+        const auto v = p - edges[0].p1;
+        EXPECT_NEAR(line.x() * v.y() - line.y() * v.x(), 0., 0.001);
+    }
+}
+
+TEST(qan_EdgeBundler, parallel)
+{
+    // TEST: Parallel bundling should give the same result than single threaded bundling
+    std::mt19937 generator{11};
+    std::uniform_real_distribution<qreal> coordinate{0., 2000.};
+    qan::EdgeBundler::Hierarchy hierarchy;
+    for (int g = 0; g < 50; g++) {
+        hierarchy.parents.push_back(g == 0 ? -1 : static_cast<int>(generator() % g));
+        hierarchy.centers.emplace_back(coordinate(generator), coordinate(generator));
+    }
+    std::vector<qan::EdgeBundler::Edge> edges(5000);
+    for (auto& edge : edges) {
+        edge.src = static_cast<int>(generator() % 51) - 1;
+        edge.dst = static_cast<int>(generator() % 51) - 1;
+        edge.p1 = QPointF{coordinate(generator), coordinate(generator)};
+        edge.p2 = QPointF{coordinate(generator), coordinate(generator)};
+    }
+    qan::EdgeBundler bundler;
+    qan::EdgeBundler::Polylines single;
+    qan::EdgeBundler::Polylines parallel;
+    bundler.bundle(hierarchy, edges, single, 1);
+    bundler.bundle(hierarchy, edges, parallel, 4);
+    ASSERT_EQ(single.offsets, parallel.offsets);
+    ASSERT_EQ(single.points.size(), parallel.points.size());
+    for (std::size_t p = 0; p < single.points.size(); p++) {
+        ASSERT_EQ(single.points[p].x(), parallel.points[p].x());
+        ASSERT_EQ(single.points[p].y(), parallel.points[p].y());
+    }
+}
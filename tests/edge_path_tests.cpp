@@ -0,0 +1,311 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    edge_path_tests.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// Qt headers
+#include <QLineF>
+
+// QuickQanava headers
+#include "../src/qanEdgePath.h"
+
+// Google Test
+#include <gtest/gtest.h>
+
+//! Return point on cubic curve \c p1 \c c1 \c c2 \c p2 at parameter \c t.
+static QPointF cubicPoint(const QPointF& p1, const QPointF& c1, const QPointF& c2, const QPointF& p2, qreal t)
+{
+    const auto u = 1. - t;
+    return u * u * u * p1 + 3. * u * u * t * c1 + 3. * u * t * t * c2 + t * t * t * p2;
+}
+
+//! Return distance between \c p and polyline \c path.
+static qreal polylineDistance(const QPointF& p, const QPolygonF& path)
+{
+    qreal distance = std::numeric_limits<qreal>::max();
+    for (int s = 0; s < path.size() - 1; s++) {
+        const auto a = path.at(s);
+        const auto ab = path.at(s + 1) - a;
+        const auto ab2 = QPointF::dotProduct(ab, ab);
+        const auto t = ab2 > 0. ? std::clamp(QPointF::dotProduct(p - a, ab) / ab2, 0., 1.) : 0.;
+        distance = std::min(distance, QLineF{p, a + t * ab}.length());
+    }
+    return distance;
+}
+
+//! Return a (0, 0) (30, 0) (30, 40) polyline, with 70. length.
+static QPolygonF    makeElbow()
+{
+    QPolygonF path;
+    path << QPointF{0., 0.} << QPointF{30., 0.} << QPointF{30., 40.};
+    return path;
+}
+
+//-----------------------------------------------------------------------------
+// qan::flattenCubic() tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_EdgePath, flatten_cubic_tolerance)
+{
+    // TEST: Every point of the analytic curve should be within tolerance of the flattened path,
+    // flattened path should end on curve destination
+    const QPointF p1{0., 0.}, c1{0., 100.}, c2{100., 100.}, p2{100., 0.};
+    const qreal tolerance = 0.25;
+    QPolygonF path;
+    path << p1;
+    qan::flattenCubic(p1, c1, c2, p2, tolerance, 10, path);
+    ASSERT_GT(path.size(), 2);
+    EXPECT_LT(path.size(), 128);
+    EXPECT_EQ(path.first(), p1);
+    EXPECT_EQ(path.last(), p2);
+    for (int s = 0; s <= 1000; s++) {
+        const auto t = s / 1000.;
+        EXPECT_LE(polylineDistance(cubicPoint(p1, c1, c2, p2, t), path), tolerance) << "t=" << t;
+    }
+
+    // TEST: Smaller tolerance should generate more vertices
+    QPolygonF finePath;
+    finePath << p1;
+    qan::flattenCubic(p1, c1, c2, p2, tolerance / 10., 10, finePath);
+    EXPECT_GT(finePath.size(), path.size());
+}
+
+TEST(qan_EdgePath, flatten_cubic_flat)
+{
+    // TEST: A cubic with control points on its chord is flat: only destination is appended
+    QPolygonF path;
+    qan::flattenCubic(QPointF{0., 0.}, QPointF{10., 10.}, QPointF{20., 20.}, QPointF{30., 30.}, 0.25, 10, path);
+    ASSERT_EQ(path.size(), 1);
+    EXPECT_EQ(path.first(), QPointF(30., 30.));
+
+    // TEST: Subdivision stops at max depth, whatever the curve flatness
+    QPolygonF shallowPath;
+    qan::flattenCubic(QPointF{0., 0.}, QPointF{0., 100.}, QPointF{100., 100.}, QPointF{100., 0.}, 0.25, 0, shallowPath);
+    EXPECT_EQ(shallowPath.size(), 1);
+    QPolygonF depth2Path;
+    qan::flattenCubic(QPointF{0., 0.}, QPointF{0., 100.}, QPointF{100., 100.}, QPointF{100., 0.}, 0.25, 2, depth2Path);
+    EXPECT_EQ(depth2Path.size(), 4);
+}
+
+//-----------------------------------------------------------------------------
+// qan::pathPointAtLength() tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_EdgePath, path_lengths)
+{
+    // TEST: Lengths are cumulative arc lengths
+    std::vector<qreal> lengths;
+    qan::generatePathLengths(makeElbow(), lengths);
+    EXPECT_EQ(lengths, (std::vector<qreal>{0., 30., 70.}));
+    qan::generatePathLengths(QPolygonF{}, lengths);
+    EXPECT_TRUE(lengths.empty());
+}
+
+TEST(qan_EdgePath, point_at_length)
+{
+    // TEST: Points are interpolated along path segments, lengths out of path are clamped to path ends
+    const auto path = makeElbow();
+    std::vector<qreal> lengths;
+    qan::generatePathLengths(path, lengths);
+    EXPECT_EQ(qan::pathPointAtLength(path, lengths, 0.), QPointF(0., 0.));
+    EXPECT_EQ(qan::pathPointAtLength(path, lengths, 15.), QPointF(15., 0.));
+    EXPECT_EQ(qan::pathPointAtLength(path, lengths, 30.), QPointF(30., 0.));
+    EXPECT_EQ(qan::pathPointAtLength(path, lengths, 35.), QPointF(30., 5.));
+    EXPECT_EQ(qan::pathPointAtLength(path, lengths, 70.), QPointF(30., 40.));
+    EXPECT_EQ(qan::pathPointAtLength(path, lengths, -10.), QPointF(0., 0.));
+    EXPECT_EQ(qan::pathPointAtLength(path, lengths, 1000.), QPointF(30., 40.));
+
+    qreal t = -1.;
+    EXPECT_EQ(qan::pathSegmentAtLength(lengths, 35., t), 1);
+    EXPECT_DOUBLE_EQ(t, 5. / 40.);
+}
+
+TEST(qan_EdgePath, point_at_length_degenerated)
+{
+    // TEST: Empty paths and paths with invalid lengths return a null point, single point paths their point
+    std::vector<qreal> lengths;
+    EXPECT_EQ(qan::pathPointAtLength(QPolygonF{}, lengths, 10.), QPointF{});
+    EXPECT_EQ(qan::pathPointAtLength(makeElbow(), lengths, 10.), QPointF{});
+    QPolygonF point;
+    point << QPointF{5., 5.};
+    qan::generatePathLengths(point, lengths);
+    EXPECT_EQ(qan::pathPointAtLength(point, lengths, 10.), QPointF(5., 5.));
+
+    // TEST: Null segments do not generate NaN
+    QPolygonF nullSegment;
+    nullSegment << QPointF{5., 5.} << QPointF{5., 5.};
+    qan::generatePathLengths(nullSegment, lengths);
+    EXPECT_EQ(qan::pathPointAtLength(nullSegment, lengths, 0.), QPointF(5., 5.));
+}
+
+TEST(qan_EdgePath, sub_path)
+{
+    // TEST: Sub path starts and ends at interpolated points and keep inner vertices
+    const auto path = makeElbow();
+    std::vector<qreal> lengths;
+    qan::generatePathLengths(path, lengths);
+    QPolygonF expected;
+    expected << QPointF{10., 0.} << QPointF{30., 0.} << QPointF{30., 20.};
+    EXPECT_EQ(qan::subPath(path, lengths, 10., 50.), expected);
+    EXPECT_EQ(qan::subPath(path, lengths, 0., 70.), path);
+
+    // TEST: An empty section has at least 2 vertices
+    const auto section = qan::subPath(path, lengths, 35., 35.);
+    ASSERT_EQ(section.size(), 2);
+    EXPECT_EQ(section.first(), QPointF(30., 5.));
+    EXPECT_EQ(section.last(), QPointF(30., 5.));
+}
+
+//-----------------------------------------------------------------------------
+// qan::trimPath() tests (curved edges arrows trimming)
+//-----------------------------------------------------------------------------
+
+TEST(qan_EdgePath, trim_path)
+{
+    // TEST: Path is trimmed by arrows length at both ends, lengths are updated
+    auto path = makeElbow();
+    std::vector<qreal> lengths;
+    qan::generatePathLengths(path, lengths);
+    qan::trimPath(path, lengths, 10., 10.);
+    QPolygonF expected;
+    expected << QPointF{10., 0.} << QPointF{30., 0.} << QPointF{30., 30.};
+    EXPECT_EQ(path, expected);
+    EXPECT_EQ(lengths, (std::vector<qreal>{0., 20., 50.}));
+
+    // TEST: Only ends with an arrow are trimmed
+    path = makeElbow();
+    qan::generatePathLengths(path, lengths);
+    qan::trimPath(path, lengths, 0., 10.);
+    EXPECT_EQ(path.first(), QPointF(0., 0.));
+    EXPECT_EQ(path.last(), QPointF(30., 30.));
+    EXPECT_DOUBLE_EQ(lengths.back(), 60.);
+
+    // TEST: No trimming (or negative trimming) leave path unmodified
+    path = makeElbow();
+    qan::generatePathLengths(path, lengths);
+    qan::trimPath(path, lengths, 0., -10.);
+    EXPECT_EQ(path, makeElbow());
+    EXPECT_DOUBLE_EQ(lengths.back(), 70.);
+}
+
+TEST(qan_EdgePath, trim_path_overlap)
+{
+    // TEST: When arrows are longer than path, path collapse on source arrow base
+    auto path = makeElbow();
+    std::vector<qreal> lengths;
+    qan::generatePathLengths(path, lengths);
+    qan::trimPath(path, lengths, 50., 50.);
+    ASSERT_EQ(path.size(), 2);
+    EXPECT_EQ(path.first(), QPointF(30., 20.));
+    EXPECT_EQ(path.last(), QPointF(30., 20.));
+    EXPECT_DOUBLE_EQ(lengths.back(), 0.);
+
+    path = makeElbow();
+    qan::generatePathLengths(path, lengths);
+    qan::trimPath(path, lengths, 100., 0.);
+    ASSERT_EQ(path.size(), 2);
+    EXPECT_EQ(path.first(), QPointF(30., 40.));
+    EXPECT_EQ(path.last(), QPointF(30., 40.));
+
+    // TEST: Degenerated paths are not modified
+    QPolygonF point;
+    point << QPointF{5., 5.};
+    qan::generatePathLengths(point, lengths);
+    qan::trimPath(point, lengths, 10., 10.);
+    EXPECT_EQ(point.size(), 1);
+}
+
+//-----------------------------------------------------------------------------
+// qan::fanOffset() and qan::selfLoopArc() tests (parallel edges and self loops)
+//-----------------------------------------------------------------------------
+
+TEST(qan_EdgePath, fan_offset)
+{
+    // TEST: Fan edges are centered on fan line, orthogonal to it and separated by spacing
+    const QPointF src{0., 0.}, dst{100., 0.};
+    EXPECT_EQ(qan::fanOffset(src, dst, 0, 2, 10.), QPointF(0., -5.));
+    EXPECT_EQ(qan::fanOffset(src, dst, 1, 2, 10.), QPointF(0., 5.));
+    EXPECT_EQ(qan::fanOffset(src, dst, 1, 3, 10.), QPointF(0., 0.));
+
+    const QPointF diagonalDst{30., 40.};
+    QPointF sum{0., 0.};
+    for (int e = 0; e < 5; e++) {
+        const auto offset = qan::fanOffset(src, diagonalDst, e, 5, 12.);
+        EXPECT_NEAR(QPointF::dotProduct(offset, diagonalDst - src), 0., 1e-9);
+        EXPECT_NEAR(QLineF(QPointF{0., 0.}, offset).length(), std::abs(e - 2) * 12., 1e-9);
+        sum += offset;
+    }
+    EXPECT_NEAR(sum.x(), 0., 1e-9);
+    EXPECT_NEAR(sum.y(), 0., 1e-9);
+
+    // TEST: Reversed fan line reverse offsets side (edges with reversed direction use canonical fan line)
+    EXPECT_EQ(qan::fanOffset(dst, src, 0, 2, 10.), QPointF(0., 5.));
+
+    // TEST: Single edges and null fan lines have no offset
+    EXPECT_EQ(qan::fanOffset(src, dst, 0, 1, 10.), QPointF(0., 0.));
+    EXPECT_EQ(qan::fanOffset(src, src, 0, 2, 10.), QPointF(0., 0.));
+}
+
+TEST(qan_EdgePath, self_loop_arc)
+{
+    // TEST: Loop leaves item top side and enters its right side, outside of item
+    const QRectF br{0., 0., 100., 60.};
+    const auto arc = qan::selfLoopArc(br, 0, 12.);
+    EXPECT_DOUBLE_EQ(arc.p1.y(), br.top());
+    EXPECT_DOUBLE_EQ(arc.p1.x(), br.right() - 15.);
+    EXPECT_DOUBLE_EQ(arc.p2.x(), br.right());
+    EXPECT_DOUBLE_EQ(arc.p2.y(), br.top() + 15.);
+    EXPECT_DOUBLE_EQ(arc.c1.x(), arc.p1.x());
+    EXPECT_LT(arc.c1.y(), br.top());
+    EXPECT_DOUBLE_EQ(arc.c2.y(), arc.p2.y());
+    EXPECT_GT(arc.c2.x(), br.right());
+
+    // TEST: Loops of the same item are nested
+    const auto outer = qan::selfLoopArc(br, 1, 12.);
+    EXPECT_EQ(outer.p1, arc.p1);
+    EXPECT_EQ(outer.p2, arc.p2);
+    EXPECT_LT(outer.c1.y(), arc.c1.y());
+    EXPECT_GT(outer.c2.x(), arc.c2.x());
+
+    // TEST: Tiny items still have a visible loop
+    const auto tiny = qan::selfLoopArc(QRectF{0., 0., 2., 2.}, 0, 0.);
+    EXPECT_DOUBLE_EQ(tiny.p1.x(), -2.);
+    EXPECT_LE(tiny.c1.y(), -8.);
+    EXPECT_GE(tiny.c2.x(), 10.);
+}
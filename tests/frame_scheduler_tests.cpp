@@ -0,0 +1,200 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    frame_scheduler_tests.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <string>
+#include <vector>
+
+// Qt headers
+#include <QElapsedTimer>
+
+// QuickQanava headers
+#include "../src/qanFrameScheduler.h"
+
+// Google Test
+#include <gtest/gtest.h>
+
+// Note: Scheduler has no item, tasks are run by calling processTasks() directly, as it would be
+// from item window afterAnimating() signal.
+
+using Priority = qan::FrameScheduler::Priority;
+
+//-----------------------------------------------------------------------------
+// qan::FrameScheduler tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_FrameScheduler, coalescing)
+{
+    // TEST: Tasks scheduled with a pending key are coalesced, only last scheduled task is run,
+    // tasks with a nullptr key are never coalesced
+    qan::FrameScheduler scheduler;
+    int key;
+    std::vector<int> runs;
+    for (int t = 0; t < 3; t++)
+        scheduler.schedule(&key, [&runs, t]() { runs.push_back(t); });
+    scheduler.schedule(nullptr, [&runs]() { runs.push_back(10); });
+    scheduler.schedule(nullptr, [&runs]() { runs.push_back(11); });
+    EXPECT_TRUE(scheduler.hasPendingTasks());
+    scheduler.processTasks();
+    EXPECT_EQ(runs, (std::vector<int>{2, 10, 11}));     // Coalesced task keep its queue position
+    EXPECT_FALSE(scheduler.hasPendingTasks());
+
+    // TEST: Once run, a key could be scheduled again
+    runs.clear();
+    scheduler.schedule(&key, [&runs]() { runs.push_back(3); });
+    scheduler.processTasks();
+    EXPECT_EQ(runs, (std::vector<int>{3}));
+}
+
+TEST(qan_FrameScheduler, cancel)
+{
+    qan::FrameScheduler scheduler;
+    int key1, key2;
+    std::vector<int> runs;
+    scheduler.schedule(&key1, [&runs]() { runs.push_back(1); });
+    scheduler.schedule(&key2, [&runs]() { runs.push_back(2); });
+    scheduler.cancel(&key1);
+    scheduler.processTasks();
+    EXPECT_EQ(runs, (std::vector<int>{2}));
+
+    runs.clear();
+    scheduler.schedule(&key1, [&runs]() { runs.push_back(1); });
+    scheduler.schedule(nullptr, [&runs]() { runs.push_back(2); });
+    scheduler.clear();
+    EXPECT_FALSE(scheduler.hasPendingTasks());
+    scheduler.processTasks();
+    EXPECT_TRUE(runs.empty());
+}
+
+TEST(qan_FrameScheduler, priority)
+{
+    // TEST: Tasks are run by priority, High priority tasks scheduled from a High priority task are
+    // run in the same frame, while other tasks scheduled during a frame are run in next frame
+    qan::FrameScheduler scheduler;
+    std::string runs;
+    scheduler.schedule(nullptr, [&runs]() { runs += "L"; }, Priority::Low);
+    scheduler.schedule(nullptr, [&]() {
+        runs += "N";
+        scheduler.schedule(nullptr, [&runs]() { runs += "n"; }, Priority::Normal);
+    }, Priority::Normal);
+    scheduler.schedule(nullptr, [&]() {
+        runs += "H";
+        scheduler.schedule(nullptr, [&runs]() { runs += "h"; }, Priority::High);
+    }, Priority::High);
+    scheduler.processTasks();
+    EXPECT_EQ(runs, "HhNL");
+    EXPECT_TRUE(scheduler.hasPendingTasks());
+    scheduler.processTasks();
+    EXPECT_EQ(runs, "HhNLn");
+    EXPECT_FALSE(scheduler.hasPendingTasks());
+}
+
+TEST(qan_FrameScheduler, priority_change)
+{
+    // TEST: Scheduling a pending key with another priority move the task to its new priority queue
+    qan::FrameScheduler scheduler;
+    int key;
+    std::string runs;
+    scheduler.schedule(nullptr, [&runs]() { runs += "N"; }, Priority::Normal);
+    scheduler.schedule(&key, [&runs]() { runs += "l"; }, Priority::Low);
+    scheduler.schedule(&key, [&runs]() { runs += "h"; }, Priority::High);
+    scheduler.processTasks();
+    EXPECT_EQ(runs, "hN");
+}
+
+TEST(qan_FrameScheduler, budget)
+{
+    // TEST: Normal and Low priority tasks are not run when frame budget is exhausted, High priority
+    // tasks are always run
+    qan::FrameScheduler scheduler;
+    scheduler.setFrameBudget(0);
+    std::string runs;
+    scheduler.schedule(nullptr, [&runs]() { runs += "N"; }, Priority::Normal);
+    scheduler.schedule(nullptr, [&runs]() { runs += "H"; }, Priority::High);
+    scheduler.processTasks();
+    EXPECT_EQ(runs, "H");
+    EXPECT_TRUE(scheduler.hasPendingTasks());
+    scheduler.setFrameBudget(1000);
+    scheduler.processTasks();
+    EXPECT_EQ(runs, "HN");
+
+    // TEST: Tasks that do not fit in frame budget are carried into next frame, in order
+    scheduler.setFrameBudget(5);
+    runs.clear();
+    scheduler.schedule(nullptr, [&runs]() {
+        runs += "1";
+        QElapsedTimer timer;
+        timer.start();
+        while (timer.elapsed() < 20)    // Exhaust frame budget
+            ;
+    });
+    scheduler.schedule(nullptr, [&runs]() { runs += "2"; });
+    scheduler.schedule(nullptr, [&runs]() { runs += "3"; }, Priority::Low);
+    scheduler.processTasks();
+    EXPECT_EQ(runs, "1");
+    scheduler.processTasks();
+    EXPECT_EQ(runs, "123");
+}
+
+TEST(qan_FrameScheduler, incremental)
+{
+    // TEST: Incremental tasks are called once per frame with a deadline bounded by their budget
+    // until they return true
+    qan::FrameScheduler scheduler;
+    scheduler.setFrameBudget(1000);
+    int key;
+    int calls = 0;
+    qint64 maximumRemaining = 0;
+    scheduler.scheduleIncremental(&key, [&](const QDeadlineTimer& deadline) {
+        maximumRemaining = std::max(maximumRemaining, deadline.remainingTime());
+        return ++calls == 3;
+    }, Priority::Normal, 2);
+    for (int frame = 0; frame < 5; frame++)
+        scheduler.processTasks();
+    EXPECT_EQ(calls, 3);
+    EXPECT_LE(maximumRemaining, 2);
+    EXPECT_FALSE(scheduler.hasPendingTasks());
+
+    // TEST: An incremental task coalesced while pending is replaced
+    calls = 0;
+    int replacedCalls = 0;
+    scheduler.scheduleIncremental(&key, [&](const QDeadlineTimer&) { return ++calls > 10; });
+    scheduler.processTasks();
+    scheduler.scheduleIncremental(&key, [&](const QDeadlineTimer&) { ++replacedCalls; return true; });
+    scheduler.processTasks();
+    scheduler.processTasks();
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(replacedCalls, 1);
+}
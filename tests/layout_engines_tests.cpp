@@ -0,0 +1,438 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    layout_engines_tests.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// QuickQanava headers
+#include "../src/qanLayoutEngines.h"
+
+// Google Test
+#include <gtest/gtest.h>
+
+//! Return true if two nodes of \c graph laid out at \c positions overlap.
+static bool haveOverlappingNodes(const qan::LayoutGraph& graph, const std::vector<QPointF>& positions)
+{
+    for (int a = 0; a < graph.getNodeCount(); a++)
+        for (int b = a + 1; b < graph.getNodeCount(); b++)
+            if (QRectF{positions[a], graph.sizes[a]}.intersects(QRectF{positions[b], graph.sizes[b]}))
+                return true;
+    return false;
+}
+
+//! Return a binary tree graph with \c nodeCount nodes, node 0 is root.
+static qan::LayoutGraph makeTree(int nodeCount)
+{
+    qan::LayoutGraph graph;
+    graph.sizes.assign(static_cast<std::size_t>(nodeCount), QSizeF{50., 30.});
+    for (int n = 1; n < nodeCount; n++)
+        graph.edges.emplace_back((n - 1) / 2, n);
+    return graph;
+}
+
+//-----------------------------------------------------------------------------
+// qan::RandomLayoutEngine tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_RandomLayoutEngine, layout_rect)
+{
+    // TEST: Nodes should be laid out inside layout rect, and layout should be deterministic for a given seed
+    auto graph = makeTree(50);
+    qan::RandomLayoutEngine engine;
+    engine.layoutRect = QRectF{100., 100., 500., 400.};
+    engine.seed = 42;
+    const auto result = engine.layout(graph);
+    ASSERT_EQ(static_cast<int>(result.positions.size()), graph.getNodeCount());
+    for (int n = 0; n < graph.getNodeCount(); n++)
+        EXPECT_TRUE(engine.layoutRect.contains(QRectF{result.positions[n], graph.sizes[n]}));
+    const auto result2 = engine.layout(graph);
+    for (int n = 0; n < graph.getNodeCount(); n++)
+        EXPECT_EQ(result.positions[n], result2.positions[n]);
+}
+
+//-----------------------------------------------------------------------------
+// qan::LayeredLayoutEngine tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_LayeredLayoutEngine, empty)
+{
+    // TEST: Laying out an empty graph should return an empty result
+    const auto result = qan::LayeredLayoutEngine{}.layout(qan::LayoutGraph{});
+    EXPECT_TRUE(result.positions.empty());
+}
+
+TEST(qan_LayeredLayoutEngine, layers)
+{
+    // TEST: Edges destinations should be in a lower layer than their sources, nodes should not overlap
+    // and isolated nodes should be laid out below layers
+    qan::LayoutGraph graph;
+    graph.sizes.assign(7, QSizeF{60., 30.});
+    graph.edges = { {0, 1}, {0, 2}, {1, 3}, {2, 3}, {3, 4}, {0, 4} };     // Nodes 5 and 6 are isolated
+    qan::LayeredLayoutEngine engine;
+    const auto result = engine.layout(graph);
+    ASSERT_EQ(static_cast<int>(result.positions.size()), graph.getNodeCount());
+    EXPECT_EQ(result.edgePaths.size(), graph.edges.size());
+    for (const auto& [src, dst] : graph.edges)
+        EXPECT_GT(result.positions[dst].y(), result.positions[src].y());
+    EXPECT_FALSE(haveOverlappingNodes(graph, result.positions));
+    for (int n = 0; n < 5; n++) {
+        EXPECT_GE(result.positions[n].x(), 0.);
+        EXPECT_GE(result.positions[n].y(), 0.);
+        EXPECT_GT(result.positions[5].y(), result.positions[n].y() + graph.sizes[n].height());
+        EXPECT_GT(result.positions[6].y(), result.positions[n].y() + graph.sizes[n].height());
+    }
+}
+
+TEST(qan_LayeredLayoutEngine, cycles)
+{
+    // TEST: Cycles should be broken, all nodes should be laid out without overlap
+    qan::LayoutGraph graph;
+    graph.sizes.assign(4, QSizeF{60., 30.});
+    graph.edges = { {0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 3} };
+    const auto result = qan::LayeredLayoutEngine{}.layout(graph);
+    ASSERT_EQ(static_cast<int>(result.positions.size()), graph.getNodeCount());
+    EXPECT_FALSE(haveOverlappingNodes(graph, result.positions));
+}
+
+//-----------------------------------------------------------------------------
+// qan::OrgTreeLayoutEngine tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_OrgTreeLayoutEngine, tree)
+{
+    // TEST: Root should not move, childs should be laid out below their parent without overlap
+    auto graph = makeTree(15);
+    graph.positions.assign(15, QPointF{0., 0.});
+    graph.positions[0] = QPointF{100., 100.};
+    qan::OrgTreeLayoutEngine engine;
+    const auto result = engine.layout(graph);
+    ASSERT_EQ(static_cast<int>(result.positions.size()), graph.getNodeCount());
+    EXPECT_EQ(result.positions[0], graph.positions[0]);
+    for (const auto& [parent, child] : graph.edges)
+        EXPECT_GT(result.positions[child].y(), result.positions[parent].y());
+    EXPECT_FALSE(haveOverlappingNodes(graph, result.positions));
+}
+
+TEST(qan_OrgTreeLayoutEngine, unreachable_nodes)
+{
+    // TEST: Nodes not reachable from root should keep their position
+    auto graph = makeTree(3);
+    graph.sizes.push_back(QSizeF{50., 30.});
+    graph.positions = { {0., 0.}, {0., 0.}, {0., 0.}, {500., 500.} };
+    const auto result = qan::OrgTreeLayoutEngine{}.layout(graph);
+    ASSERT_EQ(result.positions.size(), 4u);
+    EXPECT_EQ(result.positions[3], QPointF(500., 500.));
+}
+
+TEST(qan_OrgTreeLayoutEngine, incremental)
+{
+    // TEST: Incremental layout with reused subtrees should give the same result than a full layout
+    qan::LayoutGraph graph;
+    graph.sizes.assign(5, QSizeF{50., 30.});
+    graph.positions.assign(5, QPointF{0., 0.});
+    graph.positions[0] = QPointF{100., 100.};
+    graph.edges = { {0, 1}, {0, 2}, {1, 3}, {1, 4} };
+    qan::OrgTreeLayoutEngine engine;
+    std::vector<qan::OrgTreeLayoutEngine::SubTreeState> states;
+    const auto result = engine.layout(graph, states);
+    ASSERT_EQ(states.size(), graph.sizes.size());
+
+    graph.positions = result.positions;
+    graph.sizes[3] = QSizeF{50., 100.};                    // Node 3 grow, node 2 subtree is shifted
+    const std::vector<bool> reusable{false, false, true, false, true};
+    const auto incremental = engine.layout(graph, states, &reusable);
+    const auto full = qan::OrgTreeLayoutEngine{}.layout(graph);
+    ASSERT_EQ(incremental.positions.size(), full.positions.size());
+    for (std::size_t n = 0; n < full.positions.size(); n++)
+        EXPECT_EQ(incremental.positions[n], full.positions[n]);
+    EXPECT_NE(incremental.positions[2], result.positions[2]);
+}
+
+//-----------------------------------------------------------------------------
+// qan::MultilevelLayoutEngine tests
+//-----------------------------------------------------------------------------
+
+//! Return a \c width x \c width grid graph.
+static qan::LayoutGraph makeGrid(int width)
+{
+    qan::LayoutGraph graph;
+    const auto nodeCount = width * width;
+    graph.sizes.assign(static_cast<std::size_t>(nodeCount), QSizeF{50., 30.});
+    for (int n = 0; n < nodeCount; n++) {
+        if ((n + 1) % width != 0)
+            graph.edges.emplace_back(n, n + 1);
+        if (n + width < nodeCount)
+            graph.edges.emplace_back(n, n + width);
+    }
+    return graph;
+}
+
+TEST(qan_MultilevelLayoutEngine, small_graphs)
+{
+    // TEST: Empty and single node graphs should be laid out without error
+    qan::MultilevelLayoutEngine engine;
+    EXPECT_TRUE(engine.layout(qan::LayoutGraph{}).positions.empty());
+    qan::LayoutGraph graph;
+    graph.sizes = { QSizeF{50., 30.} };
+    EXPECT_EQ(engine.layout(graph).positions.size(), 1u);
+}
+
+TEST(qan_MultilevelLayoutEngine, deterministic)
+{
+    // TEST: Layout should be deterministic for a given seed and thread count
+    const auto graph = makeGrid(20);
+    qan::MultilevelLayoutEngine engine;
+    engine.threadCount = 2;
+    engine.seed = 7;
+    const auto result = engine.layout(graph);
+    const auto result2 = engine.layout(graph);
+    ASSERT_EQ(static_cast<int>(result.positions.size()), graph.getNodeCount());
+    for (int n = 0; n < graph.getNodeCount(); n++)
+        EXPECT_EQ(result.positions[n], result2.positions[n]);
+}
+
+TEST(qan_MultilevelLayoutEngine, quality)
+{
+    // TEST: Layout should have (0, 0) as top left corner, and connected nodes should be
+    // much closer than random pairs of nodes
+    const auto graph = makeGrid(30);
+    const auto result = qan::MultilevelLayoutEngine{}.layout(graph);
+    ASSERT_EQ(static_cast<int>(result.positions.size()), graph.getNodeCount());
+    qreal left = result.positions[0].x();
+    qreal top = result.positions[0].y();
+    for (const auto& p : result.positions) {
+        left = std::min(left, p.x());
+        top = std::min(top, p.y());
+    }
+    EXPECT_NEAR(left, 0., 0.001);
+    EXPECT_NEAR(top, 0., 0.001);
+
+    const auto distance = [&result](int a, int b) {
+        const auto d = result.positions[a] - result.positions[b];
+        return std::sqrt(QPointF::dotProduct(d, d));
+    };
+    qreal edgeLength = 0.;
+    for (const auto& [src, dst] : graph.edges)
+        edgeLength += distance(src, dst);
+    edgeLength /= static_cast<qreal>(graph.edges.size());
+    qreal pairLength = 0.;
+    const auto nodeCount = graph.getNodeCount();
+    for (int n = 0; n < nodeCount; n++)
+        pairLength += distance(n, (n * 7919 + 13) % nodeCount);
+    pairLength /= static_cast<qreal>(nodeCount);
+    EXPECT_LT(edgeLength * 5., pairLength);
+}
+
+TEST(qan_MultilevelLayoutEngine, isolated_nodes)
+{
+    // TEST: Isolated nodes should be laid out in a grid below connected nodes, without overlap
+    auto graph = makeGrid(10);
+    const auto connectedCount = graph.getNodeCount();
+    graph.sizes.resize(static_cast<std::size_t>(connectedCount + 50), QSizeF{20., 20.});
+    const auto result = qan::MultilevelLayoutEngine{}.layout(graph);
+    ASSERT_EQ(static_cast<int>(result.positions.size()), graph.getNodeCount());
+    qreal bottom = 0.;
+    for (int n = 0; n < connectedCount; n++)
+        bottom = std::max(bottom, result.positions[n].y() + graph.sizes[n].height());
+    for (int n = connectedCount; n < graph.getNodeCount(); n++) {
+        EXPECT_GE(result.positions[n].y(), bottom);
+        const QRectF rect{result.positions[n], graph.sizes[n]};
+        for (int o = n + 1; o < graph.getNodeCount(); o++)
+            EXPECT_FALSE(rect.intersects(QRectF{result.positions[o], graph.sizes[o]}));
+    }
+}
+
+TEST(qan_MultilevelLayoutEngine, small_components)
+{
+    // TEST: Graphs with many small components should be laid out with connected nodes much
+    // closer than random pairs of nodes
+    qan::LayoutGraph graph;
+    constexpr int pairCount = 2000;
+    graph.sizes.assign(pairCount * 2, QSizeF{50., 30.});
+    for (int p = 0; p < pairCount; p++)
+        graph.edges.emplace_back(p * 2, p * 2 + 1);
+    const auto result = qan::MultilevelLayoutEngine{}.layout(graph);
+    ASSERT_EQ(static_cast<int>(result.positions.size()), graph.getNodeCount());
+    const auto distance = [&result](int a, int b) {
+        const auto d = result.positions[a] - result.positions[b];
+        return std::sqrt(QPointF::dotProduct(d, d));
+    };
+    qreal edgeLength = 0.;
+    qreal pairLength = 0.;
+    for (int p = 0; p < pairCount; p++) {
+        edgeLength += distance(p * 2, p * 2 + 1);
+        pairLength += distance(p * 2, (p * 7919 + 13) % (pairCount * 2));
+    }
+    EXPECT_LT(edgeLength * 5., pairLength);
+}
+
+//-----------------------------------------------------------------------------
+// qan::CompoundLayoutEngine tests
+//-----------------------------------------------------------------------------
+
+//! Return a compound graph: top level group G (0) with groups H1 (1) and H2 (2), H1 with nodes a (3) and b (4), H2 with node c (5), top level node d (6).
+static qan::LayoutGraph makeCompoundGraph(std::vector<int>& parents)
+{
+    qan::LayoutGraph graph;
+    parents = {-1, 0, 0, 1, 1, 2, -1};
+    graph.sizes = {QSizeF{10., 10.}, QSizeF{10., 10.}, QSizeF{10., 10.},
+                   QSizeF{50., 30.}, QSizeF{50., 30.}, QSizeF{50., 30.}, QSizeF{50., 30.}};
+    graph.positions = {QPointF{100., 200.}, QPointF{}, QPointF{}, QPointF{}, QPointF{}, QPointF{}, QPointF{400., 50.}};
+    graph.edges = {{3, 4},      // a -> b, laid out in H1
+                   {3, 5},      // a -> c, laid out in G as H1 -> H2
+                   {5, 6},      // c -> d, laid out in top level as G -> d
+                   {0, 3}};     // G -> a, ignored (both ends map to G in top level)
+    return graph;
+}
+
+TEST(qan_CompoundLayoutEngine, edge_level)
+{
+    // TEST: Edges are dispatched in their source and destination lowest common group
+    std::vector<int> parents;
+    makeCompoundGraph(parents);
+    EXPECT_EQ(qan::CompoundLayoutEngine::getEdgeLevel(parents, 3, 4), 1);
+    EXPECT_EQ(qan::CompoundLayoutEngine::getEdgeLevel(parents, 3, 5), 0);
+    EXPECT_EQ(qan::CompoundLayoutEngine::getEdgeLevel(parents, 5, 3), 0);
+    EXPECT_EQ(qan::CompoundLayoutEngine::getEdgeLevel(parents, 1, 5), 0);
+    EXPECT_EQ(qan::CompoundLayoutEngine::getEdgeLevel(parents, 5, 6), -1);
+    EXPECT_EQ(qan::CompoundLayoutEngine::getEdgeLevel(parents, 0, 3), -1);
+    EXPECT_EQ(qan::CompoundLayoutEngine::getEdgeLevel(parents, 3, 42), -1);
+
+    // TEST: Cyclic parents do not hang
+    EXPECT_EQ(qan::CompoundLayoutEngine::getEdgeLevel(std::vector<int>{1, 0, 0}, 0, 2), 0);
+}
+
+TEST(qan_CompoundLayoutEngine, group_resizing)
+{
+    // TEST: Groups are resized bottom-up to fit their content, including padding and container offset
+    std::vector<int> parents;
+    const auto graph = makeCompoundGraph(parents);
+    std::vector<QPointF> containerOffsets(graph.sizes.size(), QPointF{0., 0.});
+    containerOffsets[0] = QPointF{0., 25.};
+    qan::CompoundLayoutEngine engine;
+    std::vector<QSizeF> sizes;
+    const auto result = engine.layout(graph, parents, containerOffsets, sizes);
+    ASSERT_EQ(static_cast<int>(result.positions.size()), graph.getNodeCount());
+    ASSERT_EQ(static_cast<int>(sizes.size()), graph.getNodeCount());
+    EXPECT_EQ(sizes[5], graph.sizes[5]);    // Leaf nodes are not resized
+    EXPECT_EQ(sizes[2], QSizeF(50. + 2. * engine.groupPadding, 30. + 2. * engine.groupPadding));
+
+    const auto expectFit = [&](int group, const std::vector<int>& groupMembers) {
+        qreal right = 0.;
+        qreal bottom = 0.;
+        for (const auto m: groupMembers) {
+            EXPECT_GE(result.positions[m].x(), engine.groupPadding);
+            EXPECT_GE(result.positions[m].y(), engine.groupPadding);
+            right = std::max(right, result.positions[m].x() + sizes[m].width());
+            bottom = std::max(bottom, result.positions[m].y() + sizes[m].height());
+        }
+        EXPECT_DOUBLE_EQ(sizes[group].width(), containerOffsets[group].x() + right + engine.groupPadding);
+        EXPECT_DOUBLE_EQ(sizes[group].height(), containerOffsets[group].y() + bottom + engine.groupPadding);
+    };
+    expectFit(1, {3, 4});
+    expectFit(2, {5});
+    expectFit(0, {1, 2});       // Using H1 and H2 generated sizes
+    EXPECT_GT(sizes[0].height(), sizes[1].height() + sizes[2].height() + 25.);
+
+    // TEST: Top level nodes keep their bounding rect top left corner
+    EXPECT_DOUBLE_EQ(std::min(result.positions[0].x(), result.positions[6].x()), 100.);
+    EXPECT_DOUBLE_EQ(std::min(result.positions[0].y(), result.positions[6].y()), 50.);
+    EXPECT_FALSE(QRectF(result.positions[0], sizes[0]).intersects(QRectF(result.positions[6], sizes[6])));
+}
+
+TEST(qan_CompoundLayoutEngine, level_edges)
+{
+    // TEST: Edges are laid out in their lowest common group, mapped to group members
+    std::vector<int> parents;
+    auto graph = makeCompoundGraph(parents);
+    std::vector<QSizeF> sizes;
+    auto result = qan::CompoundLayoutEngine{}.layout(graph, parents, {}, sizes);
+    EXPECT_GE(result.positions[4].y(), result.positions[3].y() + sizes[3].height());   // a -> b in H1
+    EXPECT_GE(result.positions[2].y(), result.positions[1].y() + sizes[1].height());   // H1 -> H2 in G
+    EXPECT_GE(result.positions[6].y(), result.positions[0].y() + sizes[0].height());   // G -> d in top level
+
+    // TEST: Reversing the edge crossing H1 and H2 borders reverse H1 and H2 order in G
+    graph.edges[1] = {5, 3};
+    result = qan::CompoundLayoutEngine{}.layout(graph, parents, {}, sizes);
+    EXPECT_GE(result.positions[1].y(), result.positions[2].y() + sizes[2].height());
+}
+
+TEST(qan_CompoundLayoutEngine, flat_and_invalid_hierarchy)
+{
+    // TEST: Without hierarchy, compound layout is a layered layout
+    auto graph = makeTree(15);
+    const auto layered = qan::LayeredLayoutEngine{}.layout(graph);
+    const auto flat = qan::CompoundLayoutEngine{}.layout(graph);
+    ASSERT_EQ(flat.positions.size(), layered.positions.size());
+    for (std::size_t n = 0; n < flat.positions.size(); n++)
+        EXPECT_EQ(flat.positions[n], layered.positions[n]);
+
+    // TEST: Invalid and cyclic parents are laid out as top level nodes, nothing is resized
+    std::vector<QSizeF> sizes;
+    const std::vector<int> cyclic = {1, 0, 42};
+    graph.sizes.resize(3);
+    graph.edges.clear();
+    const auto result = qan::CompoundLayoutEngine{}.layout(graph, cyclic, {}, sizes);
+    EXPECT_EQ(sizes, graph.sizes);
+    EXPECT_FALSE(haveOverlappingNodes(graph, result.positions));
+}
+
+TEST(qan_CompoundLayoutEngine, parallel)
+{
+    // TEST: Parallel and sequential layouts of many independent groups are identical
+    qan::LayoutGraph graph;
+    std::vector<int> parents;
+    for (int g = 0; g < 64; g++) {
+        const auto group = graph.getNodeCount();
+        graph.sizes.push_back(QSizeF{10., 10.});
+        parents.push_back(-1);
+        for (int m = 0; m < 3 + g % 4; m++) {
+            graph.sizes.push_back(QSizeF{20. + m * 5., 20.});
+            parents.push_back(group);
+            if (m > 0)
+                graph.edges.emplace_back(graph.getNodeCount() - 2, graph.getNodeCount() - 1);
+        }
+    }
+    qan::CompoundLayoutEngine engine;
+    std::vector<QSizeF> parallelSizes;
+    const auto parallel = engine.layout(graph, parents, {}, parallelSizes);
+    engine.parallel = false;
+    std::vector<QSizeF> sequentialSizes;
+    const auto sequential = engine.layout(graph, parents, {}, sequentialSizes);
+    EXPECT_EQ(parallel.positions, sequential.positions);
+    EXPECT_EQ(parallelSizes, sequentialSizes);
+}
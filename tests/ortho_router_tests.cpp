@@ -0,0 +1,200 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    ortho_router_tests.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <cmath>
+#include <vector>
+
+// QuickQanava headers
+#include "../src/qanOrthoRouter.h"
+
+// Google Test
+#include <gtest/gtest.h>
+
+//! Return true if every \c path segment is horizontal or vertical.
+static bool isOrthogonal(const QPolygonF& path)
+{
+    for (int p = 0; p + 1 < path.size(); p++)
+        if (std::abs(path[p].x() - path[p + 1].x()) > 0.001 &&
+            std::abs(path[p].y() - path[p + 1].y()) > 0.001)
+            return false;
+    return true;
+}
+
+//! Return true if axis aligned segment [a, b] cross \c rect interior.
+static bool crossRect(const QPointF& a, const QPointF& b, const QRectF& rect)
+{
+    const auto left = std::min(a.x(), b.x());
+    const auto right = std::max(a.x(), b.x());
+    const auto top = std::min(a.y(), b.y());
+    const auto bottom = std::max(a.y(), b.y());
+    return left < rect.right() && right > rect.left() &&
+           top < rect.bottom() && bottom > rect.top();
+}
+
+//! Return true if \c path cross any of \c obstacles interior.
+static bool crossObstacles(const QPolygonF& path, const std::vector<QRectF>& obstacles)
+{
+    for (int p = 0; p + 1 < path.size(); p++)
+        for (const auto& obstacle : obstacles)
+            if (crossRect(path[p], path[p + 1], obstacle))
+                return true;
+    return false;
+}
+
+//! Return true if \c point is on \c rect border.
+static bool isOnBorder(const QPointF& point, const QRectF& rect)
+{
+    constexpr qreal tolerance = 0.5;
+    const auto inX = point.x() >= rect.left() - tolerance && point.x() <= rect.right() + tolerance;
+    const auto inY = point.y() >= rect.top() - tolerance && point.y() <= rect.bottom() + tolerance;
+    return (inX && (std::abs(point.y() - rect.top()) <= tolerance ||
+                    std::abs(point.y() - rect.bottom()) <= tolerance)) ||
+           (inY && (std::abs(point.x() - rect.left()) <= tolerance ||
+                    std::abs(point.x() - rect.right()) <= tolerance));
+}
+
+//-----------------------------------------------------------------------------
+// qan::OrthoRouter tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_OrthoRouter, route_free_space)
+{
+    // TEST: Routing without obstacles should return an orthogonal path from src border to dst border
+    qan::OrthoRouter router;
+    int src, dst, edge;
+    const QRectF srcRect{0., 0., 100., 50.};
+    const QRectF dstRect{300., 200., 100., 50.};
+    router.updateObstacle(&src, srcRect);
+    router.updateObstacle(&dst, dstRect);
+    const auto path = router.route(&edge, &src, &dst, srcRect, dstRect);
+    ASSERT_GE(path.size(), 2);
+    EXPECT_TRUE(isOrthogonal(path));
+    EXPECT_TRUE(isOnBorder(path.first(), srcRect));
+    EXPECT_TRUE(isOnBorder(path.last(), dstRect));
+    EXPECT_FALSE(crossObstacles(path, {srcRect, dstRect}));
+}
+
+TEST(qan_OrthoRouter, route_around_obstacle)
+{
+    // TEST: An obstacle between src and dst should be avoided with at least router margin
+    qan::OrthoRouter router;
+    int src, dst, obstacle, edge;
+    const QRectF srcRect{0., 0., 100., 50.};
+    const QRectF dstRect{400., 0., 100., 50.};
+    const QRectF obstacleRect{200., -100., 100., 250.};
+    router.updateObstacle(&src, srcRect);
+    router.updateObstacle(&dst, dstRect);
+    router.updateObstacle(&obstacle, obstacleRect);
+    EXPECT_EQ(router.getObstacleCount(), 3);
+    const auto path = router.route(&edge, &src, &dst, srcRect, dstRect);
+    ASSERT_GE(path.size(), 4);     // At least two bends to go around obstacle
+    EXPECT_TRUE(isOrthogonal(path));
+    EXPECT_TRUE(isOnBorder(path.first(), srcRect));
+    EXPECT_TRUE(isOnBorder(path.last(), dstRect));
+    const auto margin = router.getMargin() - 0.5;
+    EXPECT_FALSE(crossObstacles(path, {obstacleRect.adjusted(-margin, -margin, margin, margin)}));
+}
+
+TEST(qan_OrthoRouter, route_dense_grid)
+{
+    // TEST: Routing across a dense 30x30 obstacles grid should find a path avoiding all obstacles
+    qan::OrthoRouter router;
+    std::vector<int> keys(900);
+    std::vector<QRectF> obstacles;
+    for (int i = 0; i < 900; i++) {
+        obstacles.emplace_back((i % 30) * 150., (i / 30) * 150., 80., 80.);
+        router.updateObstacle(&keys[i], obstacles.back());
+    }
+    int edge;
+    const auto path = router.route(&edge, &keys[0], &keys[899], obstacles[0], obstacles[899]);
+    ASSERT_GE(path.size(), 2);
+    EXPECT_TRUE(isOrthogonal(path));
+    EXPECT_TRUE(isOnBorder(path.first(), obstacles[0]));
+    EXPECT_TRUE(isOnBorder(path.last(), obstacles[899]));
+    EXPECT_FALSE(crossObstacles(path, obstacles));
+}
+
+TEST(qan_OrthoRouter, invalidate_crossing_routes)
+{
+    // TEST: Moving an obstacle across a cached route should return this route, and route should then
+    // be generated again around the obstacle
+    qan::OrthoRouter router;
+    int src, dst, obstacle, edge;
+    const QRectF srcRect{0., 0., 100., 50.};
+    const QRectF dstRect{400., 0., 100., 50.};
+    router.updateObstacle(&src, srcRect);
+    router.updateObstacle(&dst, dstRect);
+    router.updateObstacle(&obstacle, QRectF{200., 500., 100., 100.});
+    const auto path = router.route(&edge, &src, &dst, srcRect, dstRect);
+    ASSERT_GE(path.size(), 2);
+    EXPECT_EQ(router.getRoute(&edge), path);
+
+    const QRectF obstacleRect{200., -50., 100., 150.};
+    const auto routes = router.updateObstacle(&obstacle, obstacleRect);
+    ASSERT_EQ(routes.size(), 1u);
+    EXPECT_EQ(routes[0], &edge);
+    const auto rerouted = router.route(&edge, &src, &dst, srcRect, dstRect);
+    ASSERT_GE(rerouted.size(), 2);
+    EXPECT_FALSE(crossObstacles(rerouted, {obstacleRect}));
+
+    // TEST: Inserting an obstacle far from route should not invalidate it
+    int far;
+    EXPECT_TRUE(router.updateObstacle(&far, QRectF{2000., 2000., 50., 50.}).empty());
+    EXPECT_EQ(router.getRoute(&edge), rerouted);
+}
+
+TEST(qan_OrthoRouter, route_all)
+{
+    // TEST: Batch routing should return one valid route per request, in requests order
+    qan::OrthoRouter router;
+    std::vector<int> nodes(4);
+    std::vector<int> edges(3);
+    const std::vector<QRectF> rects{ {0., 0., 80., 40.}, {300., 0., 80., 40.},
+                                     {0., 300., 80., 40.}, {300., 300., 80., 40.} };
+    for (std::size_t n = 0; n < nodes.size(); n++)
+        router.updateObstacle(&nodes[n], rects[n]);
+    std::vector<qan::OrthoRouter::Request> requests;
+    for (std::size_t e = 0; e < edges.size(); e++)
+        requests.push_back(qan::OrthoRouter::Request{&edges[e], &nodes[0], &nodes[e + 1], rects[0], rects[e + 1]});
+    const auto routes = router.routeAll(requests);
+    ASSERT_EQ(routes.size(), requests.size());
+    for (std::size_t e = 0; e < routes.size(); e++) {
+        ASSERT_GE(routes[e].size(), 2);
+        EXPECT_TRUE(isOrthogonal(routes[e]));
+        EXPECT_TRUE(isOnBorder(routes[e].first(), rects[0]));
+        EXPECT_TRUE(isOnBorder(routes[e].last(), rects[e + 1]));
+    }
+}
@@ -0,0 +1,124 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    polygon_intersection_tests.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <cmath>
+#include <random>
+
+// Qt headers
+#include <QLineF>
+
+// QuickQanava headers
+#include "../src/qanPolygonIntersection.h"
+
+// Google Test
+#include <gtest/gtest.h>
+
+//! Reference scalar kernel: first \c polygon segment with a QLineF::BoundedIntersection with [p1, p2].
+static int referenceIntersection(const QPointF& p1, const QPointF& p2, const QPolygonF& polygon, QPointF& intersection)
+{
+    const QLineF line{p1, p2};
+    for (int p = 0; p < polygon.size() - 1; ++p)
+        if (line.intersects(QLineF{polygon[p], polygon[p + 1]}, &intersection) == QLineF::BoundedIntersection)
+            return p;
+    return -1;
+}
+
+//-----------------------------------------------------------------------------
+// qan::findPolygonLineIntersection() tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_PolygonIntersection, degenerated_polygons)
+{
+    // TEST: Empty and single point polygons never intersect
+    EXPECT_EQ(qan::findPolygonLineIntersection(QPointF{0., 0.}, QPointF{10., 10.}, QPolygonF{}), -1);
+    QPolygonF point;
+    point << QPointF{5., 5.};
+    EXPECT_EQ(qan::findPolygonLineIntersection(QPointF{0., 0.}, QPointF{10., 10.}, point), -1);
+    QPointF intersection{-1., -1.};
+    EXPECT_FALSE(qan::polygonLineIntersection(QPointF{0., 0.}, QPointF{10., 10.}, point, intersection));
+    EXPECT_EQ(intersection, QPointF(-1., -1.));     // Unmodified when there is no intersection
+}
+
+TEST(qan_PolygonIntersection, rect)
+{
+    // TEST: A line from rect center to outside should intersect the crossed side
+    QPolygonF rect;
+    rect << QPointF{0., 0.} << QPointF{100., 0.} << QPointF{100., 50.} << QPointF{0., 50.} << QPointF{0., 0.};
+    QPointF intersection;
+    EXPECT_EQ(qan::findPolygonLineIntersection(QPointF{50., 25.}, QPointF{200., 25.}, rect), 1);
+    EXPECT_TRUE(qan::polygonLineIntersection(QPointF{50., 25.}, QPointF{200., 25.}, rect, intersection));
+    EXPECT_EQ(intersection, QPointF(100., 25.));
+    EXPECT_EQ(qan::findPolygonLineIntersection(QPointF{50., 25.}, QPointF{50., -100.}, rect), 0);
+    EXPECT_EQ(qan::findPolygonLineIntersection(QPointF{50., 25.}, QPointF{-10., 25.}, rect), 3);
+    EXPECT_EQ(qan::findPolygonLineIntersection(QPointF{10., 10.}, QPointF{20., 20.}, rect), -1);
+}
+
+TEST(qan_PolygonIntersection, scalar_equivalence)
+{
+    // TEST: Vectorized kernel should return exactly the same segment and intersection point than a
+    // scalar QLineF::intersects() loop, for every polygon size (vector lanes and scalar tail)
+    std::mt19937 generator{5};
+    std::uniform_real_distribution<qreal> coordinate{-100., 100.};
+    const auto randomPoint = [&]() { return QPointF{coordinate(generator), coordinate(generator)}; };
+    for (int i = 0; i < 20000; i++) {
+        QPolygonF polygon;
+        const auto size = static_cast<int>(generator() % 24);
+        for (int p = 0; p < size; p++)
+            polygon << (generator() % 8 == 0 && p > 0 ? polygon.last() : randomPoint());  // Some null segments
+        const auto p1 = randomPoint();
+        const auto p2 = generator() % 16 == 0 ? p1 : randomPoint();                     // Some null lines
+        QPointF expectedIntersection;
+        const auto expected = referenceIntersection(p1, p2, polygon, expectedIntersection);
+        ASSERT_EQ(qan::findPolygonLineIntersection(p1, p2, polygon), expected);
+        QPointF intersection;
+        ASSERT_EQ(qan::polygonLineIntersection(p1, p2, polygon, intersection), expected >= 0);
+        if (expected >= 0) {
+            ASSERT_EQ(intersection.x(), expectedIntersection.x());
+            ASSERT_EQ(intersection.y(), expectedIntersection.y());
+        }
+    }
+}
+
+TEST(qan_PolygonIntersection, collinear_segments)
+{
+    // TEST: Parallel and collinear segments never have a bounded intersection (same as QLineF)
+    QPolygonF polygon;
+    polygon << QPointF{0., 0.} << QPointF{100., 0.} << QPointF{200., 0.};
+    QPointF intersection;
+    EXPECT_EQ(qan::findPolygonLineIntersection(QPointF{-50., 0.}, QPointF{250., 0.}, polygon),
+              referenceIntersection(QPointF{-50., 0.}, QPointF{250., 0.}, polygon, intersection));
+    EXPECT_EQ(qan::findPolygonLineIntersection(QPointF{-50., 10.}, QPointF{250., 10.}, polygon), -1);
+}
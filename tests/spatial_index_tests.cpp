@@ -0,0 +1,205 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file    spatial_index_tests.cpp
+// \author	benoit@destrat.io
+// \date    2026 10 18
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+// QuickQanava headers
+#include "../src/qanSpatialIndex.h"
+
+// Google Test
+#include <gtest/gtest.h>
+
+//! Return true if \c a and \c b intersect, borders included.
+static bool intersects(const QRectF& a, const QRectF& b)
+{
+    return a.left() <= b.right() && b.left() <= a.right() &&
+           a.top() <= b.bottom() && b.top() <= a.bottom();
+}
+
+//-----------------------------------------------------------------------------
+// qan::SpatialIndex tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_SpatialIndex, empty)
+{
+    qan::SpatialIndex index;
+    EXPECT_EQ(index.getSize(), 0u);
+    std::vector<qan::SpatialIndex::Key> keys;
+    index.query(QRectF{-1000., -1000., 2000., 2000.}, keys);
+    EXPECT_TRUE(keys.empty());
+    int key;
+    EXPECT_FALSE(index.remove(&key));
+    EXPECT_EQ(index.getRect(&key), nullptr);
+}
+
+TEST(qan_SpatialIndex, insert_update_remove)
+{
+    // TEST: Inserting an existing key should update its rect, removed keys should no longer be returned
+    qan::SpatialIndex index;
+    int a, b;
+    index.insert(&a, QRectF{0., 0., 10., 10.});
+    index.insert(&b, QRectF{100., 100., 500., 20.});
+    EXPECT_EQ(index.getSize(), 2u);
+    ASSERT_NE(index.getRect(&a), nullptr);
+    EXPECT_EQ(*index.getRect(&a), QRectF(0., 0., 10., 10.));
+
+    std::vector<qan::SpatialIndex::Key> keys;
+    index.query(QPointF{5., 5.}, keys);
+    ASSERT_EQ(keys.size(), 1u);
+    EXPECT_EQ(keys[0], &a);
+
+    index.insert(&a, QRectF{1000., 1000., 10., 10.});
+    EXPECT_EQ(index.getSize(), 2u);
+    keys.clear();
+    index.query(QPointF{5., 5.}, keys);
+    EXPECT_TRUE(keys.empty());
+    index.query(QPointF{1005., 1005.}, keys);
+    ASSERT_EQ(keys.size(), 1u);
+    EXPECT_EQ(keys[0], &a);
+
+    keys.clear();
+    index.query(QPointF{550., 110.}, keys);     // Point query in a wide rect
+    ASSERT_EQ(keys.size(), 1u);
+    EXPECT_EQ(keys[0], &b);
+
+    EXPECT_TRUE(index.remove(&b));
+    EXPECT_FALSE(index.remove(&b));
+    keys.clear();
+    index.query(QPointF{550., 110.}, keys);
+    EXPECT_TRUE(keys.empty());
+    index.clear();
+    EXPECT_EQ(index.getSize(), 0u);
+}
+
+TEST(qan_SpatialIndex, borders)
+{
+    // TEST: Rect borders should be included in queries
+    qan::SpatialIndex index;
+    int key;
+    index.insert(&key, QRectF{0., 0., 100., 100.});
+    std::vector<qan::SpatialIndex::Key> keys;
+    index.query(QPointF{100., 100.}, keys);
+    EXPECT_EQ(keys.size(), 1u);
+    keys.clear();
+    index.query(QRectF{100., 50., 10., 10.}, keys);
+    EXPECT_EQ(keys.size(), 1u);
+    keys.clear();
+    index.query(QPointF{100.5, 100.}, keys);
+    EXPECT_TRUE(keys.empty());
+}
+
+TEST(qan_SpatialIndex, non_finite)
+{
+    // TEST: Rects with a non finite position or size should not be indexed (and should remove an already
+    // indexed key), huge and non finite queries should not fail
+    constexpr auto inf = std::numeric_limits<qreal>::infinity();
+    constexpr auto nan = std::numeric_limits<qreal>::quiet_NaN();
+    constexpr auto huge = std::numeric_limits<qreal>::max() / 4.;
+    qan::SpatialIndex index;
+    int a, b, c;
+    for (const auto& rect : {QRectF{inf, 0., 10., 10.}, QRectF{0., -inf, 10., 10.},
+                             QRectF{0., 0., inf, 10.},  QRectF{0., 0., 10., inf},
+                             QRectF{nan, 0., 10., 10.}, QRectF{huge * 3., 0., huge * 2., 10.}}) {
+        index.insert(&a, rect);
+        EXPECT_EQ(index.getSize(), 0u);
+    }
+    index.insert(&a, QRectF{0., 0., 10., 10.});
+    index.insert(&a, QRectF{0., 0., 10., inf});
+    EXPECT_EQ(index.getSize(), 0u);
+    EXPECT_EQ(index.getRect(&a), nullptr);
+
+    index.insert(&a, QRectF{0., 0., 10., 10.});
+    index.insert(&b, QRectF{huge, -huge, 10., 10.});
+    index.insert(&c, QRectF{-1e300, 1e300, 1e300, 10.});
+    EXPECT_EQ(index.getSize(), 3u);
+    std::vector<qan::SpatialIndex::Key> keys;
+    index.query(QRectF{-1., -1., 2., 2.}, keys);
+    EXPECT_EQ(keys, std::vector<qan::SpatialIndex::Key>{&a});
+    keys.clear();
+    index.query(QPointF{huge + 5., -huge + 5.}, keys);
+    EXPECT_EQ(keys, std::vector<qan::SpatialIndex::Key>{&b});
+    keys.clear();
+    index.query(QRectF{-huge, -huge, inf, inf}, keys);
+    EXPECT_EQ(keys.size(), 3u);
+    keys.clear();
+    index.query(QRectF{nan, 0., 10., 10.}, keys);
+    index.query(QRectF{0., 0., nan, 10.}, keys);
+    index.query(QRectF{-inf, -inf, inf, inf}, keys);    // Note: right and bottom are NaN
+    EXPECT_TRUE(keys.empty());
+}
+
+TEST(qan_SpatialIndex, random_operations)
+{
+    // TEST: Random insertions, updates, removals and queries (including very large rects and queries)
+    // should return exactly the keys returned by a linear scan, without duplicates
+    std::mt19937 generator{3};
+    std::uniform_real_distribution<qreal> position{-5000., 5000.};
+    std::uniform_real_distribution<qreal> size{0., 600.};
+    qan::SpatialIndex index;
+    std::unordered_map<qan::SpatialIndex::Key, QRectF> rects;
+    std::vector<int> keys(3000);
+    for (int i = 0; i < 20000; i++) {
+        const qan::SpatialIndex::Key key = &keys[generator() % keys.size()];
+        const auto operation = generator() % 10;
+        if (operation < 6) {
+            const QRectF rect{position(generator), position(generator),
+                              size(generator) * (generator() % 20 == 0 ? 50. : 1.), size(generator)};
+            index.insert(key, rect);
+            rects[key] = rect;
+        } else if (operation < 7) {
+            EXPECT_EQ(index.remove(key), rects.erase(key) > 0);
+        } else {
+            const QRectF query{position(generator), position(generator),
+                               generator() % 2 ? 0. : size(generator) * (generator() % 10 == 0 ? 30. : 1.),
+                               size(generator)};
+            std::vector<qan::SpatialIndex::Key> result;
+            index.query(query, result);
+            const std::set<qan::SpatialIndex::Key> found(result.begin(), result.end());
+            EXPECT_EQ(found.size(), result.size());
+            std::set<qan::SpatialIndex::Key> expected;
+            for (const auto& [k, rect] : rects)
+                if (intersects(rect, query))
+                    expected.insert(k);
+            EXPECT_EQ(found, expected);
+        }
+    }
+    EXPECT_EQ(index.getSize(), rects.size());
+}